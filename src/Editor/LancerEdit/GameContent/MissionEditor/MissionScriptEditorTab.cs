@@ -32,6 +32,8 @@ public sealed partial class MissionScriptEditorTab : GameContentTab
     private int nextId;
     private NodeId contextNodeId = 0;
     private readonly Queue<(NodeId Id, Vector2 Pos)> nodeRelocationQueue = [];
+    // Layout needs the node sizes, so it runs once the first frame has been drawn
+    private bool pendingAutoLayout;
 
     private readonly MissionScriptDocument missionIni;
     public string FileSaveLocation;
@@ -40,6 +42,7 @@ public sealed partial class MissionScriptEditorTab : GameContentTab
     EditorUndoBuffer undoBuffer = new();
 
     private bool renderHistory = false;
+    private bool renderMinimap = true;
 
     public MissionScriptEditorTab(GameDataContext gameData, MainWindow win, string file)
     {
@@ -67,15 +70,12 @@ public sealed partial class MissionScriptEditorTab : GameContentTab
         Queue<(Node Source, string Target, bool Input)> toLink = new();
 
         var triggerNodes = new Dictionary<string, NodeMissionTrigger>(StringComparer.OrdinalIgnoreCase);
-        Dictionary<NodeMissionTrigger, int> counts = new Dictionary<NodeMissionTrigger, int>();
-
 
         foreach (var t in iniTriggers)
         {
             var n = new NodeMissionTrigger(t, this);
             triggerNodes[t.Nickname] = n;
             nodes.Add(n);
-            counts[n] = 0;
             foreach (var c in n.Actions)
             {
                 if (c is ActActivateNodeTrigger or ActDeactivateNodeTrigger or ActSave)
@@ -117,14 +117,9 @@ public sealed partial class MissionScriptEditorTab : GameContentTab
             {
                 TryLinkNodes(x.Source, target, LinkType.Trigger, out _);
             }
-
-            counts[target]++;
         }
 
-        if (!ReadSavedPositions(file))
-        {
-            AutoPositionNodes(triggerNodes, counts);
-        }
+        pendingAutoLayout = !ReadSavedPositions(file);
 
         SetupLookups();
     }
@@ -172,69 +167,6 @@ public sealed partial class MissionScriptEditorTab : GameContentTab
         return count > 0;
     }
 
-    void AutoPositionNodes(
-        Dictionary<string, NodeMissionTrigger> triggerNodes,
-        Dictionary<NodeMissionTrigger, int> counts)
-    {
-        var columns = new List<List<NodeMissionTrigger>>();
-
-        HashSet<NodeMissionTrigger> setColumns = new HashSet<NodeMissionTrigger>();
-
-        columns.Add(new List<NodeMissionTrigger>());
-
-        void IterateChildren(NodeMissionTrigger triggerNode, int index)
-        {
-            while (columns.Count <= index)
-                columns.Add(new List<NodeMissionTrigger>());
-            foreach (var c in triggerNode.Actions)
-            {
-                if (c is ActActivateNodeTrigger or ActDeactivateNodeTrigger or ActSave)
-                {
-                    var triggerTarget = c switch
-                    {
-                        ActActivateNodeTrigger act => act.Data.Trigger,
-                        ActDeactivateNodeTrigger deactivate => deactivate.Data.Trigger,
-                        ActSave save => save.Data.Trigger,
-                        _ => throw new InvalidCastException()
-                    };
-                    if (!triggerNodes.TryGetValue(triggerTarget, out var target))
-                    {
-                        continue;
-                    }
-
-                    if (!setColumns.Contains(target))
-                    {
-                        setColumns.Add(target);
-                        columns[index].Add(target);
-                        IterateChildren(target, index + 1);
-                    }
-                }
-            }
-        }
-
-        foreach (var startNode in counts.Where(x => x.Value == 0)
-                     .Select(x => x.Key))
-        {
-            setColumns.Add(startNode);
-            columns[0].Add(startNode);
-            IterateChildren(startNode, 1);
-        }
-
-        for (int i = 0; i < columns.Count; i++)
-        {
-            float totalHeight = 0;
-            foreach (var item in columns[i])
-                totalHeight += item.EstimateHeight();
-            float cHeight = -(totalHeight / 2);
-            for (int j = 0; j < columns[i].Count; j++)
-            {
-                var x = (i * 1000);
-                nodeRelocationQueue.Enqueue((columns[i][j].Id, new Vector2(x, cHeight)));
-                cHeight += columns[i][j].EstimateHeight();
-            }
-        }
-    }
-
     public override void OnHotkey(Hotkeys hk, bool shiftPressed)
     {
         switch (hk)
@@ -290,6 +222,11 @@ public sealed partial class MissionScriptEditorTab : GameContentTab
     {
         NodeEditor.SetCurrentEditor(context);
         NodeEditor.Begin("Node Editor", Vector2.Zero);
+        unsafe
+        {
+            // Text is unreadable below this, draw triggers as titled boxes
+            NodeEditor.GetStyle()->LodZoomThreshold = 0.35f;
+        }
 
         var cursorTopLeft = ImGui.GetCursorScreenPos();
 
@@ -298,10 +235,13 @@ public sealed partial class MissionScriptEditorTab : GameContentTab
             nodeEditActions.Dequeue()();
         }
 
-        while (nodeRelocationQueue.Count > 0)
+        if (nodeRelocationQueue.Count > 0)
         {
-            var node = nodeRelocationQueue.Dequeue();
-            NodeEditor.SetNodePosition(node.Id, node.Pos);
+            var ids = new NodeId[nodeRelocationQueue.Count];
+            var positions = new Vector2[ids.Length];
+            for (int i = 0; i < ids.Length; i++)
+                (ids[i], positions[i]) = nodeRelocationQueue.Dequeue();
+            NodeEditor.SetNodePositions(ids, positions);
         }
 
         var lookups = new NodeLookups() { MissionIni = missionIni };
@@ -388,7 +328,16 @@ public sealed partial class MissionScriptEditorTab : GameContentTab
 
         ImGui.PopStyleVar();
         NodeEditor.Resume();
+        if (renderMinimap)
+        {
+            NodeEditor.ShowMinimap();
+        }
         NodeEditor.End();
+        if (pendingAutoLayout)
+        {
+            NodeEditor.AutoLayout();
+            pendingAutoLayout = false;
+        }
         NodeEditor.SetCurrentEditor(null);
 
         if (nodeMouseActions.Count > 0)
@@ -745,19 +694,29 @@ public sealed partial class MissionScriptEditorTab : GameContentTab
 
         // Fetch locations from node editor state
         var savedNodes = new List<SavedNode>();
+        var triggers = nodes.OfType<NodeMissionTrigger>().ToArray();
+        var comments = nodes.OfType<CommentNode>().ToArray();
+        var ids = new NodeId[triggers.Length + comments.Length];
+        var positions = new Vector2[ids.Length];
+        for (int i = 0; i < triggers.Length; i++)
+            ids[i] = triggers[i].Id;
+        for (int i = 0; i < comments.Length; i++)
+            ids[triggers.Length + i] = comments[i].Id;
+
         NodeEditor.SetCurrentEditor(context);
-        foreach (var trigger in nodes.OfType<NodeMissionTrigger>())
+        NodeEditor.GetNodePositions(ids, positions);
+        NodeEditor.SetCurrentEditor(null);
+
+        for (int i = 0; i < triggers.Length; i++)
         {
-            savedNodes.Add(SavedNode.FromTrigger(NodeEditor.GetNodePosition(trigger.Id), trigger));
+            savedNodes.Add(SavedNode.FromTrigger(positions[i], triggers[i]));
         }
 
-        foreach (var node in nodes.OfType<CommentNode>())
+        for (int i = 0; i < comments.Length; i++)
         {
-            savedNodes.Add(SavedNode.FromComment(NodeEditor.GetNodePosition(node.Id), node));
+            savedNodes.Add(SavedNode.FromComment(positions[triggers.Length + i], comments[i]));
         }
 
-        NodeEditor.SetCurrentEditor(null);
-
         missionIni.Save(FileSaveLocation, gameData, nodes.OfType<NodeMissionTrigger>(), savedNodes);
 
         return new EditResult<bool>(true);
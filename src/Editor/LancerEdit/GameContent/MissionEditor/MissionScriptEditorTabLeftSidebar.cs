@@ -43,6 +43,12 @@ public sealed partial class MissionScriptEditorTab
             renderHistory = !renderHistory;
         }
 
+        ImGui.SameLine();
+        if (ImGuiExt.ToggleButton("Minimap", renderMinimap))
+        {
+            renderMinimap = !renderMinimap;
+        }
+
         ImGui.AlignTextToFramePadding();
         ImGui.Text("Navigate To: ");
         ImGui.SameLine();
@@ -99,18 +99,7 @@ public class NodeMissionTrigger : Node
         ImGui.EndGroup();
     }
 
-    private float[]? cachedHeightsCond;
-    private float[]? cachedHeightsAct;
-
-    private static float GetHeight(float[] cache, float fh, int index)
-    {
-        if (cache == null || index >= cache.Length ||
-            cache[index] < float.Epsilon)
-            return fh;
-        return cache[index];
-    }
-
-    private void RenderConditions(bool clipped, bool usePins, float szPin, float szContent, float pad,
+    private void RenderConditions(bool usePins, float szPin, float szContent, float pad,
         GameDataContext gameData, PopupManager popups, EditorUndoBuffer undoBuffer, ref NodePopups nodePopups,
         ref NodeLookups nodeLookups)
     {
@@ -121,8 +110,6 @@ public class NodeMissionTrigger : Node
             ImGui.TableSetupColumn("##content", ImGuiTableColumnFlags.WidthFixed, szContent);
         }
 
-        var fh = ImGui.GetFrameHeightWithSpacing();
-
         KeyValuePair<int, int>? nodeSwap = null;
 
         for(var i = 0; i < Conditions.Count; i++)
@@ -146,49 +133,31 @@ public class NodeMissionTrigger : Node
                 ImGui.TableNextColumn();
             }
 
-            if (clipped)
+            bool c = StartChild(i, Conditions, out var remove, out var reorder);
+
+            if (reorder == -1)
             {
-                ImGui.Dummy(new Vector2(1, GetHeight(cachedHeightsCond, fh, i)));
+                nodeSwap = new KeyValuePair<int, int>(i, i - 1);
             }
-            else
+            else if (reorder == 1)
             {
-                if (cachedHeightsCond == null || cachedHeightsCond.Length != Conditions.Count)
-                {
-                    cachedHeightsCond = new float[Conditions.Count];
-                }
-
-                var sp = ImGui.GetCursorPosY();
-                bool c = StartChild(i, Conditions, out var remove, out var reorder);
-
-                if (reorder == -1)
-                {
-                    nodeSwap = new KeyValuePair<int, int>(i, i - 1);
-                }
-                else if (reorder == 1)
-                {
-                    nodeSwap = new KeyValuePair<int, int>(i, i + 1);
-                }
-
-                if (c)
-                {
-                    ImGui.PushID(i);
-                    ImGui.Dummy(new Vector2(1, 4)); //pad
-                    e.RenderContent(gameData, popups, undoBuffer, ref nodePopups, ref nodeLookups);
-                    ImGui.Dummy(new Vector2(1, 4)); //pad
-                    ImGui.PopID();
-                }
+                nodeSwap = new KeyValuePair<int, int>(i, i + 1);
+            }
 
-                EndChild(c);
-                if (remove)
-                {
-                    tab.DeleteCondition(this, i);
-                    i--;
-                }
+            if (c)
+            {
+                ImGui.PushID(i);
+                ImGui.Dummy(new Vector2(1, 4)); //pad
+                e.RenderContent(gameData, popups, undoBuffer, ref nodePopups, ref nodeLookups);
+                ImGui.Dummy(new Vector2(1, 4)); //pad
+                ImGui.PopID();
+            }
 
-                if (cachedHeightsCond != null && i < cachedHeightsCond.Length && i >= 0)
-                {
-                    cachedHeightsCond[i] = ImGui.GetCursorPosY() - sp;
-                }
+            EndChild(c);
+            if (remove)
+            {
+                tab.DeleteCondition(this, i);
+                i--;
             }
         }
 
@@ -203,12 +172,10 @@ public class NodeMissionTrigger : Node
         }
     }
 
-    void RenderActions(bool clipped, bool usePins, float szPin, float szContent, float pad,
+    void RenderActions(bool usePins, float szPin, float szContent, float pad,
         GameDataContext gameData, PopupManager popups, EditorUndoBuffer undoBuffer, ref NodePopups nodePopups,
         ref NodeLookups nodeLookups)
     {
-        var fh = ImGui.GetFrameHeightWithSpacing();
-
         if (usePins)
         {
             ImGui.BeginTable("##actions", 2, ImGuiTableFlags.PreciseWidths, new Vector2(szPin + szContent + pad, 0));
@@ -227,46 +194,31 @@ public class NodeMissionTrigger : Node
                 ImGui.TableNextColumn();
             }
 
-            if (clipped)
+            bool c = StartChild(i, Actions, out var remove, out var reorder);
+
+            if (reorder == -1)
             {
-                ImGui.Dummy(new Vector2(1, GetHeight(cachedHeightsAct, fh, i)));
+                nodeSwap = new KeyValuePair<int, int>(i, i - 1);
             }
-            else
+            else if (reorder == 1)
             {
-                if (cachedHeightsAct == null || cachedHeightsAct.Length != Actions.Count)
-                    cachedHeightsAct = new float[Actions.Count];
-                var sp = ImGui.GetCursorPosY();
-                bool c = StartChild(i, Actions, out var remove, out var reorder);
-
-                if (reorder == -1)
-                {
-                    nodeSwap = new KeyValuePair<int, int>(i, i - 1);
-                }
-                else if (reorder == 1)
-                {
-                    nodeSwap = new KeyValuePair<int, int>(i, i + 1);
-                }
-
-                if (c)
-                {
-                    ImGui.PushID(i);
-                    ImGui.Dummy(new Vector2(1, 4) ); //pad
-                    e.RenderContent(gameData, popups, undoBuffer, ref nodePopups, ref nodeLookups);
-                    ImGui.Dummy(new Vector2(1, 4)); //pad
-                    ImGui.PopID();
-                }
+                nodeSwap = new KeyValuePair<int, int>(i, i + 1);
+            }
 
-                EndChild(c);
-                if (remove)
-                {
-                    tab.DeleteAction(this, i);
-                    i--;
-                }
+            if (c)
+            {
+                ImGui.PushID(i);
+                ImGui.Dummy(new Vector2(1, 4) ); //pad
+                e.RenderContent(gameData, popups, undoBuffer, ref nodePopups, ref nodeLookups);
+                ImGui.Dummy(new Vector2(1, 4)); //pad
+                ImGui.PopID();
+            }
 
-                if (cachedHeightsAct != null && i < cachedHeightsAct.Length && i >= 0)
-                {
-                    cachedHeightsAct[i] = ImGui.GetCursorPosY() - sp;
-                }
+            EndChild(c);
+            if (remove)
+            {
+                tab.DeleteAction(this, i);
+                i--;
             }
 
             if (usePins)
@@ -297,15 +249,6 @@ public class NodeMissionTrigger : Node
         }
     }
 
-    public float EstimateHeight()
-    {
-        var iHeight = 24;
-
-        var maxItems = Math.Max(Conditions.Count, Actions.Count);
-
-        return (maxItems * iHeight * 1.85f) + iHeight * 7; //7 controls + 1.85x items
-    }
-
     public override bool OnContextMenu(PopupManager popups, EditorUndoBuffer undoBuffer)
     {
         if (ImGui.MenuItem("Add Action"))
@@ -345,7 +288,12 @@ public class NodeMissionTrigger : Node
 
 
         var iconSize  = new Vector2(24);
-        var nb = NodeBuilder.Begin(Id, suspend);
+        var nb = NodeBuilder.Begin(Id, suspend, Name);
+        if (nb.Culled)
+        {
+            nb.Dispose();
+            return;
+        }
 
         nb.Header(Color);
 
@@ -389,26 +337,19 @@ public class NodeMissionTrigger : Node
             return;
         }
 
-        if (nb.Clipped)
-        {
-            ImGui.Dummy(new(180, ImGui.GetFrameHeightWithSpacing() * 3 + ImGui.GetFrameHeight()));
-        }
-        else
-        {
-            ImGui.PushItemWidth(180);
-            ImGui.AlignTextToFramePadding();
-            ImGui.Text("ID");
-            ImGui.SameLine();
-            Controls.InputItemNickname("##id", undoBuffer, Data,
-                (n, _) => {
-                    var node = tab.GetTrigger(n);
-                    return node != null && node != this; },
-                (_, o, u) => tab.OnRenameTrigger(this, o, u));
-            nb.Popups.StringCombo("System", undoBuffer, () => ref Data.System, gameData.SystemsByName, true);
-            Controls.CheckboxUndo("Repeatable", undoBuffer, () => ref Data.Repeatable);
-            nb.Popups.Combo("Initial State", undoBuffer, () => ref Data.InitState);
-            ImGui.PopItemWidth();
-        }
+        ImGui.PushItemWidth(180);
+        ImGui.AlignTextToFramePadding();
+        ImGui.Text("ID");
+        ImGui.SameLine();
+        Controls.InputItemNickname("##id", undoBuffer, Data,
+            (n, _) => {
+                var node = tab.GetTrigger(n);
+                return node != null && node != this; },
+            (_, o, u) => tab.OnRenameTrigger(this, o, u));
+        nb.Popups.StringCombo("System", undoBuffer, () => ref Data.System, gameData.SystemsByName, true);
+        Controls.CheckboxUndo("Repeatable", undoBuffer, () => ref Data.Repeatable);
+        nb.Popups.Combo("Initial State", undoBuffer, () => ref Data.InitState);
+        ImGui.PopItemWidth();
 
         // Draw conditions/actions
         ImGui.BeginTable("##trigger", 2, ImGuiTableFlags.PreciseWidths, new Vector2(szLeft + szRight + 8 * pad, 0));
@@ -417,9 +358,9 @@ public class NodeMissionTrigger : Node
         ImGui.TableHeadersRow();
         ImGui.TableNextRow();
         ImGui.TableNextColumn();
-        RenderConditions(nb.Clipped, conditionPin, szPin, szContent, pad, gameData, popup, undoBuffer, ref nb.Popups, ref lookups);
+        RenderConditions(conditionPin, szPin, szContent, pad, gameData, popup, undoBuffer, ref nb.Popups, ref lookups);
         ImGui.TableNextColumn();
-        RenderActions(nb.Clipped ,actionPin, szPin, szContent, pad, gameData, popup, undoBuffer, ref nb.Popups, ref lookups);
+        RenderActions(actionPin, szPin, szContent, pad, gameData, popup, undoBuffer, ref nb.Popups, ref lookups);
         ImGui.EndTable();
         nb.Dispose();
 
@@ -65,6 +65,14 @@ public class SystemEditorTab : GameContentTab
         new DropdownOption("Walkthrough", Icons.StreetView, CameraModes.Walkthrough)
     };
 
+    private int pivotMode = 1;
+    private static readonly DropdownOption[] pivotModes =
+    {
+        new DropdownOption("Centroid", Icons.Bullseye, GuizmoPivot.Centroid),
+        new DropdownOption("Individual Origins", Icons.Cubes, GuizmoPivot.IndividualOrigins),
+        new DropdownOption("Active Object", Icons.Cube, GuizmoPivot.Active)
+    };
+
     public PopupManager Popups = new PopupManager();
 
     public EditorUndoBuffer UndoBuffer = new EditorUndoBuffer();
@@ -223,6 +231,7 @@ public class SystemEditorTab : GameContentTab
             if (render3d)
             {
                 tb.DropdownButtonItem("Camera Mode", ref cameraMode, camModes);
+                tb.DropdownButtonItem("Pivot", ref pivotMode, pivotModes);
             }
             else
             {
@@ -1724,6 +1733,7 @@ public class SystemEditorTab : GameContentTab
         new List<(GameObject Object, Transform3D Transform)>();
 
     private bool manipulatingObjects = false;
+    private Matrix4x4[] selectionMatrices = new Matrix4x4[16];
 
     unsafe bool ManipulateObjects()
     {
@@ -1732,10 +1742,16 @@ public class SystemEditorTab : GameContentTab
             var v = camera.View;
             var p = camera.Projection;
             var mode = ImGui.GetIO().KeyCtrl ? GuizmoMode.WORLD : GuizmoMode.LOCAL;
-            Matrix4x4 delta = Matrix4x4.Identity;
-            GuizmoOp op;
-            if ((op = ImGuizmo.Manipulate(ref v, ref p, GuizmoOperation.TRANSLATE | GuizmoOperation.ROTATE_AXIS, mode,
-                    ref ObjectsList.SelectedTransform, out delta)) != GuizmoOp.Nothing && !delta.IsIdentity)
+            var count = ObjectsList.Selection.Count;
+            if (selectionMatrices.Length < count)
+                selectionMatrices = new Matrix4x4[count];
+            // Selection[0] is the active object
+            selectionMatrices[0] = ObjectsList.SelectedTransform;
+            for (int i = 1; i < count; i++)
+                selectionMatrices[i] = ObjectsList.Selection[i].LocalTransform.Matrix();
+            if (ImGuizmo.ManipulateBatch(ref v, ref p, GuizmoOperation.TRANSLATE | GuizmoOperation.ROTATE_AXIS, mode,
+                    (GuizmoPivot)pivotModes[pivotMode].Tag, selectionMatrices.AsSpan(0, count), 0,
+                    out var delta) != GuizmoOp.Nothing && !delta.IsIdentity)
             {
                 if (!manipulatingObjects)
                 {
@@ -1744,10 +1760,10 @@ public class SystemEditorTab : GameContentTab
                     manipulatingObjects = true;
                 }
 
-                for (int i = 0; i < ObjectsList.Selection.Count; i++)
+                ObjectsList.SelectedTransform = selectionMatrices[0];
+                for (int i = 0; i < count; i++)
                 {
-                    ObjectsList.Selection[i]
-                        .SetLocalTransform(Transform3D.FromMatrix(ImGuizmo.ApplyDelta(ObjectsList.Selection[i].LocalTransform.Matrix(), delta, op)));
+                    ObjectsList.Selection[i].SetLocalTransform(Transform3D.FromMatrix(selectionMatrices[i]));
                 }
             }
 
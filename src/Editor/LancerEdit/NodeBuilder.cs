@@ -50,10 +50,12 @@ public struct NodeBuilder : IDisposable
     public NodeStage CurrentStage;
 
     public NodePopups Popups;
-    public bool Clipped;
+    // Node is off screen or drawn at level of detail.
+    // Submit nothing else and call End() straight away.
+    public bool Culled;
 
 
-    public static NodeBuilder Begin(NodeId id, NodeSuspendState suspend)
+    public static NodeBuilder Begin(NodeId id, NodeSuspendState suspend, string title = null)
     {
         NodeEditor.PushStyleVar(StyleVar.NodePadding, new Vector4(8,4,8,8));
         NodeEditor.BeginNode(id);
@@ -64,16 +66,12 @@ public struct NodeBuilder : IDisposable
             HeaderColor = ImGui.GetColorU32(Color4.Blue),
         };
 
+        if (title != null)
+            NodeEditor.SetNodeTitle(title);
         bp.Popups = NodePopups.Begin(id, suspend);
-        bp.SetStage(NodeStage.Begin);
-
-        var pos = NodeEditor.GetNodePosition(id);
-        var min = NodeEditor.CanvasToScreen(pos);
-        var max = NodeEditor.CanvasToScreen(pos + new Vector2(800, 1000));
-        var io = ImGui.GetIO();
-        var rect = new RectangleF(min.X, min.Y, max.X - min.X, max.Y - min.Y);
-        var screen = new RectangleF(0, 0, io.DisplaySize.X, io.DisplaySize.Y);
-        bp.Clipped = !screen.Intersects(rect);
+        bp.Culled = NodeEditor.IsNodeCulled(id);
+        if (!bp.Culled)
+            bp.SetStage(NodeStage.Begin);
         return bp;
     }
 
@@ -129,6 +127,16 @@ public struct NodeBuilder : IDisposable
     public void Dispose() => End();
     public unsafe void End()
     {
+        if (Culled)
+        {
+            NodeEditor.SkipNodeContents();
+            NodeEditor.EndNode();
+            ImGui.PopID();
+            NodeEditor.PopStyleVar();
+            Popups.End();
+            return;
+        }
+
         SetStage(NodeStage.End);
         NodeEditor.EndNode();
         if (ImGui.IsItemVisible())
@@ -1,3 +1,4 @@
+using System;
 using ImGuiNET;
 using LibreLancer;
 using LibreLancer.ContentEdit;
@@ -18,6 +19,27 @@ public class HexEditorPopup : PopupWindow
         this.node = node;
         data = node.Data.ShallowCopy();
         mem = new MemoryEditor();
+        if (node.Name.Equals("VMeshData", StringComparison.OrdinalIgnoreCase) && data.Length >= 16)
+            AddVMeshOverlay();
+    }
+
+    void AddVMeshOverlay()
+    {
+        var header = mem.AddStruct("VMeshData", 16);
+        mem.AddStructField(header, "MeshType", ImGuiDataType.U32, 0, 1, MemoryEditorFieldFlags.Hex);
+        mem.AddStructField(header, "SurfaceType", ImGuiDataType.U32, 4, 1, MemoryEditorFieldFlags.Hex);
+        mem.AddStructField(header, "MeshCount", ImGuiDataType.U16, 8);
+        mem.AddStructField(header, "IndexCount", ImGuiDataType.U16, 10);
+        mem.AddStructField(header, "FVF", ImGuiDataType.U16, 12, 1, MemoryEditorFieldFlags.Hex);
+        mem.AddStructField(header, "VertexCount", ImGuiDataType.U16, 14);
+        var mesh = mem.AddStruct("TMeshHeader", 12);
+        mem.AddStructField(mesh, "MaterialCrc", ImGuiDataType.U32, 0, 1, MemoryEditorFieldFlags.Hex);
+        mem.AddStructField(mesh, "StartVertex", ImGuiDataType.U16, 4);
+        mem.AddStructField(mesh, "EndVertex", ImGuiDataType.U16, 6);
+        mem.AddStructField(mesh, "NumRefVertices", ImGuiDataType.U16, 8);
+        mem.AddStructField(mesh, "Padding", ImGuiDataType.U16, 10, 1, MemoryEditorFieldFlags.Hex);
+        mem.AddStructOverlay(header, 0);
+        mem.AddStructOverlay(mesh, 16, BitConverter.ToUInt16(data, 8));
     }
 
     public override void Draw(bool appearing)
@@ -31,7 +53,7 @@ public class HexEditorPopup : PopupWindow
         ImGui.SameLine(ImGui.GetWindowWidth() - 60 * ImGuiHelper.Scale);
         if (ImGui.Button("Cancel")) ImGui.CloseCurrentPopup();
         ImGui.PushFont(ImGuiHelper.SystemMonospace, 0);
-        mem.DrawContents(data, data.Length);
+        mem.DrawContents(data, data.Length, node.Data);
         ImGui.PopFont();
     }
 
@@ -3,7 +3,9 @@
 // LICENSE, which is part of this source code package
 
 using System;
+using System.Collections.Generic;
 using System.Runtime.InteropServices;
+using System.Text;
 using ImGuiNET;
 
 namespace LibreLancer.ImUI;
@@ -27,6 +29,9 @@ public class ColorTextEdit : IDisposable
     [DllImport("cimgui")]
     static extern void igExtTextEditorSetText(IntPtr textedit, IntPtr text);
 
+    [DllImport("cimgui")]
+    static extern int igExtTextEditorGetInvalidUtf8(IntPtr textedit, out nuint firstOffset);
+
     [DllImport("cimgui")]
     static extern void igExtTextEditorGetCoordinates(IntPtr textedit, out int x, out int y);
 
@@ -45,6 +50,21 @@ public class ColorTextEdit : IDisposable
     [DllImport("cimgui")]
     static extern void igExtTextEditorSetReadOnly(IntPtr textedit, bool readOnly);
 
+    [DllImport("cimgui")]
+    static extern void igExtTextEditorSetAutoComplete(IntPtr textedit, int enabled);
+
+    [DllImport("cimgui")]
+    static extern unsafe void igExtTextEditorAddAutoCompleteWords(IntPtr textedit, byte* words, nuint size);
+
+    [DllImport("cimgui")]
+    static extern void igExtTextEditorClearAutoCompleteWords(IntPtr textedit);
+
+    [DllImport("cimgui")]
+    static extern void igExtTextEditorSetAppendOnly(IntPtr textedit, int enabled, int maxLines);
+
+    [DllImport("cimgui")]
+    static extern unsafe void igExtTextEditorAppendText(IntPtr textedit, byte* text, nuint size);
+
     private IntPtr textedit;
     private bool textChanged = false;
     private int lastUndoIndex = 0;
@@ -60,6 +80,30 @@ public class ColorTextEdit : IDisposable
         igExtTextEditorSetText(textedit, (IntPtr)ptr);
     }
 
+    // Log view: text can only be appended, the oldest lines are dropped past maxLines (0 = unlimited)
+    public void SetAppendOnly(bool appendOnly, int maxLines = 0)
+    {
+        igExtTextEditorSetAppendOnly(textedit, appendOnly ? 1 : 0, maxLines);
+    }
+
+    public unsafe void AppendText(ReadOnlySpan<byte> utf8)
+    {
+        fixed (byte* ptr = utf8)
+        {
+            igExtTextEditorAppendText(textedit, ptr, (nuint)utf8.Length);
+        }
+    }
+
+    public void AppendText(string text) => AppendText(Encoding.UTF8.GetBytes(text));
+
+    // Number of malformed UTF-8 sequences in the text given to SetText/AppendText (shown as U+FFFD)
+    public int GetInvalidUtf8(out long firstOffset)
+    {
+        var count = igExtTextEditorGetInvalidUtf8(textedit, out var offset);
+        firstOffset = (long)offset;
+        return count;
+    }
+
     public string GetText()
     {
         var ptr = igExtTextEditorGetText(textedit);
@@ -88,6 +132,27 @@ public class ColorTextEdit : IDisposable
     {
         igExtTextEditorSetReadOnly(textedit, readOnly);
     }
+
+    public void SetAutoComplete(bool enabled)
+    {
+        igExtTextEditorSetAutoComplete(textedit, enabled ? 1 : 0);
+    }
+
+    // Words are sent in one newline separated buffer so large nickname lists cost a single transition
+    public unsafe void AddAutoCompleteWords(IEnumerable<string> words)
+    {
+        var bytes = Encoding.UTF8.GetBytes(string.Join('\n', words));
+        fixed (byte* ptr = bytes)
+        {
+            igExtTextEditorAddAutoCompleteWords(textedit, ptr, (nuint)bytes.Length);
+        }
+    }
+
+    public void ClearAutoCompleteWords()
+    {
+        igExtTextEditorClearAutoCompleteWords(textedit);
+    }
+
     public Point GetCoordinates()
     {
         igExtTextEditorGetCoordinates(textedit, out int x, out int y);
@@ -0,0 +1,100 @@
+// MIT License - Copyright (c) Callum McGing
+// This file is subject to the terms and conditions defined in
+// LICENSE, which is part of this source code package
+
+using System;
+using System.Runtime.InteropServices;
+using System.Text;
+
+namespace LibreLancer.ImUI;
+
+/// <summary>
+/// An expression compiled once and applied to many rows of values,
+/// e.g. "x*1.1+50" over the positions of every selected object.
+/// </summary>
+public unsafe class ExpressionProgram : IDisposable
+{
+    [DllImport("cimgui")]
+    static extern IntPtr igExtExpressionProgramCreate(byte* text, byte** columns, int columnCount);
+
+    [DllImport("cimgui")]
+    static extern int igExtExpressionProgramEvaluate(IntPtr program, double* bindings, int stride, int count,
+        double* results, byte* errors);
+
+    [DllImport("cimgui")]
+    static extern void igExtExpressionProgramFree(IntPtr program);
+
+    IntPtr handle;
+
+    /// <summary>
+    /// Names of the values read from each row, in row order.
+    /// </summary>
+    public readonly string[] Columns;
+
+    ExpressionProgram(IntPtr handle, string[] columns)
+    {
+        this.handle = handle;
+        Columns = columns;
+    }
+
+    /// <summary>
+    /// Compiles text with the given column names. Names that aren't columns resolve
+    /// to registered expression variables, or locals starting at zero.
+    /// </summary>
+    /// <returns>null if the text does not parse</returns>
+    public static ExpressionProgram? Compile(string text, params string[] columns)
+    {
+        var strings = new byte[columns.Length + 1][];
+        strings[0] = Encoding.UTF8.GetBytes(text + "\0");
+        for (int i = 0; i < columns.Length; i++)
+            strings[i + 1] = Encoding.UTF8.GetBytes(columns[i] + "\0");
+        var pins = new GCHandle[strings.Length];
+        byte** names = stackalloc byte*[Math.Max(columns.Length, 1)];
+        try
+        {
+            for (int i = 0; i < strings.Length; i++)
+                pins[i] = GCHandle.Alloc(strings[i], GCHandleType.Pinned);
+            for (int i = 0; i < columns.Length; i++)
+                names[i] = (byte*) pins[i + 1].AddrOfPinnedObject();
+            var h = igExtExpressionProgramCreate((byte*) pins[0].AddrOfPinnedObject(), names, columns.Length);
+            return h == IntPtr.Zero ? null : new ExpressionProgram(h, columns);
+        }
+        finally
+        {
+            foreach (var p in pins)
+                if (p.IsAllocated) p.Free();
+        }
+    }
+
+    /// <summary>
+    /// Evaluates one row per result. Row i is read from bindings[i * Columns.Length].
+    /// errors[i] is set to 1 where the result is NaN or infinite.
+    /// </summary>
+    /// <returns>The number of rows with errors</returns>
+    public int Evaluate(ReadOnlySpan<double> bindings, Span<double> results, Span<byte> errors = default)
+    {
+        if (handle == IntPtr.Zero) throw new ObjectDisposedException(nameof(ExpressionProgram));
+        int stride = Columns.Length;
+        if (bindings.Length < results.Length * stride)
+            throw new ArgumentException("Not enough bindings for results", nameof(bindings));
+        if (!errors.IsEmpty && errors.Length < results.Length)
+            throw new ArgumentException("errors must be empty or hold one flag per result", nameof(errors));
+        fixed (double* b = bindings, r = results)
+        fixed (byte* e = errors)
+        {
+            return igExtExpressionProgramEvaluate(handle, b, stride, results.Length, r, errors.IsEmpty ? null : e);
+        }
+    }
+
+    public void Dispose()
+    {
+        if (handle != IntPtr.Zero)
+        {
+            igExtExpressionProgramFree(handle);
+            handle = IntPtr.Zero;
+        }
+        GC.SuppressFinalize(this);
+    }
+
+    ~ExpressionProgram() => Dispose();
+}
@@ -91,6 +91,74 @@ public static unsafe class ImGuiExt
             return igExtInputIntPreview((IntPtr) ni, (IntPtr) np, ref value) != 0;
     }
 
+    [DllImport("cimgui")]
+    static extern int igExtExpressionSetVariable(byte* name, double value);
+
+    [DllImport("cimgui")]
+    static extern int igExtExpressionRegisterFunction(byte* name,
+        delegate* unmanaged<double*, int, IntPtr, double> callback, IntPtr userdata);
+
+    [DllImport("cimgui", EntryPoint = "igExtExpressionFlushCache")]
+    public static extern void FlushExpressionCache();
+
+    [DllImport("cimgui")]
+    static extern int igExtExpressionEvaluate(byte* text, out double result);
+
+    public delegate double ExpressionFunction(ReadOnlySpan<double> args);
+
+    // Indexed by the userdata passed to native code, keeps the delegates alive.
+    // One slot per function name, re-registering a name replaces its delegate.
+    private static readonly List<ExpressionFunction> expressionFunctions = new();
+    private static readonly Dictionary<string, int> expressionFunctionSlots = new();
+
+    [UnmanagedCallersOnly]
+    static double CallExpressionFunction(double* args, int count, IntPtr userdata) =>
+        expressionFunctions[(int) userdata](new ReadOnlySpan<double>(args, count));
+
+    /// <summary>
+    /// Sets a named value usable in the expressions typed into InputFloat/InputInt etc.
+    /// Updating an existing name does not recompile cached expressions.
+    /// </summary>
+    public static bool SetExpressionVariable(string name, double value)
+    {
+        Span<byte> nbytes = stackalloc byte[128];
+        using var native_name = new UTF8ZHelper(nbytes, name);
+        fixed (byte* n = native_name.ToUTF8Z())
+            return igExtExpressionSetVariable(n, value) != 0;
+    }
+
+    public static bool RegisterExpressionFunction(string name, ExpressionFunction function)
+    {
+        Span<byte> nbytes = stackalloc byte[128];
+        using var native_name = new UTF8ZHelper(nbytes, name);
+        bool existing = expressionFunctionSlots.TryGetValue(name, out int slot);
+        if (!existing)
+            slot = expressionFunctions.Count;
+        fixed (byte* n = native_name.ToUTF8Z())
+        {
+            if (igExtExpressionRegisterFunction(n, &CallExpressionFunction, slot) == 0)
+                return false;
+        }
+        if (existing)
+        {
+            expressionFunctions[slot] = function;
+        }
+        else
+        {
+            expressionFunctions.Add(function);
+            expressionFunctionSlots[name] = slot;
+        }
+        return true;
+    }
+
+    public static bool EvaluateExpression(string text, out double result)
+    {
+        Span<byte> tbytes = stackalloc byte[512];
+        using var native_text = new UTF8ZHelper(tbytes, text);
+        fixed (byte* t = native_text.ToUTF8Z())
+            return igExtExpressionEvaluate(t, out result) != 0;
+    }
+
     public static bool ToggleButton(string text, bool v, bool enabled = true)
     {
         ImGui.BeginDisabled(!enabled);
@@ -44,6 +44,13 @@ public enum GuizmoOp
     Scale
 }
 
+public enum GuizmoPivot
+{
+    Centroid,
+    IndividualOrigins,
+    Active
+}
+
 public class ImGuizmo
 {
     [DllImport("cimgui", EntryPoint = "igGuizmoBeginFrame")]
@@ -97,6 +104,24 @@ public class ImGuizmo
         }
     }
 
+    [DllImport("cimgui", EntryPoint = "igGuizmoManipulateBatch")]
+    static unsafe extern GuizmoOp igGuizmoManipulateBatch(ref Matrix4x4 view, ref Matrix4x4 projection, GuizmoOperation operation,
+        GuizmoMode mode, GuizmoPivot pivot, Matrix4x4* matrices, int count, int active, Matrix4x4* delta);
+
+    /// <summary>
+    /// Manipulates all matrices with one gizmo. The change is applied natively about the pivot,
+    /// delta is the world space transform applied this frame.
+    /// </summary>
+    public static unsafe GuizmoOp ManipulateBatch(ref Matrix4x4 view, ref Matrix4x4 projection,
+        GuizmoOperation operation, GuizmoMode mode, GuizmoPivot pivot, Span<Matrix4x4> matrices, int active,
+        out Matrix4x4 delta)
+    {
+        fixed (Matrix4x4* m = matrices, d = &delta)
+        {
+            return igGuizmoManipulateBatch(ref view, ref projection, operation, mode, pivot, m, matrices.Length, active, d);
+        }
+    }
+
     [DllImport("cimgui", EntryPoint = "igGuizmoSetDrawlist")]
     public static extern void SetDrawlist();
 }
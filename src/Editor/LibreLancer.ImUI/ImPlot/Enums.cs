@@ -172,6 +172,8 @@ public enum ImPlotHeatmapFlags
 {
     None = 0,
     ColMajor = 1024,
+    SkipMin = 2048,
+    Texture = 4096,
 }
 
 [Flags]
@@ -183,6 +185,8 @@ public enum ImPlotHistogramFlags
     Density = 4096,
     NoOutliers = 8192,
     ColMajor = 16384,
+    SkipEmpty = 32768,
+    Texture = 65536,
 }
 
 public enum ImPlotImageFlags
@@ -228,6 +232,9 @@ public enum ImPlotLineFlags
     SkipNaN = 4096,
     NoClip = 8192,
     Shaded = 16384,
+    Decimate = 32768,
+    DecimateLTTB = 65536,
+    SortedX = 131072,
 }
 
 [Flags]
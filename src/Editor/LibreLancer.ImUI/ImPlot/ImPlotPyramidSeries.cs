@@ -0,0 +1,91 @@
+using System;
+using System.Runtime.InteropServices;
+using ImGuiNET;
+
+namespace LibreLancer.ImUI.ImPlot;
+
+/// <summary>
+/// Append-only (x, y) series for long histories. A min/max/mean pyramid is kept
+/// alongside the samples so zooming and panning cost scales with plot width rather
+/// than with the number of samples in view. X values must be non-decreasing.
+/// </summary>
+public sealed unsafe class ImPlotPyramidSeries : IDisposable
+{
+    [DllImport("cimgui")]
+    static extern IntPtr ImPlotPyramidSeries_Create();
+
+    [DllImport("cimgui")]
+    static extern void ImPlotPyramidSeries_Destroy(IntPtr series);
+
+    [DllImport("cimgui")]
+    static extern void ImPlotPyramidSeries_Clear(IntPtr series);
+
+    [DllImport("cimgui")]
+    static extern void ImPlotPyramidSeries_Reserve(IntPtr series, int capacity);
+
+    [DllImport("cimgui")]
+    static extern void ImPlotPyramidSeries_Push(IntPtr series, double x, double y);
+
+    [DllImport("cimgui")]
+    static extern void ImPlotPyramidSeries_PushBatch(IntPtr series, double* xs, double* ys, int count);
+
+    [DllImport("cimgui")]
+    static extern int ImPlotPyramidSeries_GetCount(IntPtr series);
+
+    [DllImport("cimgui")]
+    static extern byte ImPlotPyramidSeries_GetBounds(IntPtr series, ImPlotRect* bounds);
+
+    [DllImport("cimgui")]
+    static extern int ImPlotPyramidSeries_Plot(IntPtr series, byte* label_id, ImPlotSpec spec);
+
+    private IntPtr handle;
+
+    public int Count => ImPlotPyramidSeries_GetCount(handle);
+
+    public ImPlotPyramidSeries()
+    {
+        handle = ImPlotPyramidSeries_Create();
+    }
+
+    public void Reserve(int capacity) => ImPlotPyramidSeries_Reserve(handle, capacity);
+
+    public void Push(double x, double y) => ImPlotPyramidSeries_Push(handle, x, y);
+
+    public void Push(ReadOnlySpan<double> xs, ReadOnlySpan<double> ys)
+    {
+        if (xs.Length != ys.Length)
+            throw new ArgumentException("xs and ys must be the same length");
+        fixed (double* xp = xs)
+        fixed (double* yp = ys)
+            ImPlotPyramidSeries_PushBatch(handle, xp, yp, xs.Length);
+    }
+
+    public void Clear() => ImPlotPyramidSeries_Clear(handle);
+
+    public bool TryGetBounds(out ImPlotRect bounds)
+    {
+        fixed (ImPlotRect* b = &bounds)
+            return ImPlotPyramidSeries_GetBounds(handle, b) != 0;
+    }
+
+    /// <summary>
+    /// Plots the visible range. Zoomed out, the min/max envelope is filled with
+    /// the fill color and the bucket mean drawn with the line color.
+    /// </summary>
+    /// <returns>The pyramid level drawn, 0 being the raw samples.</returns>
+    public int Plot(string label_id, ImPlotSpec? spec = null)
+    {
+        using var label_id_u8 = new UTF8ZHelper(stackalloc byte[128], label_id ?? "");
+        var spec_spec = spec ?? new ImPlotSpec();
+        fixed (byte* label_id_ptr = label_id_u8.ToUTF8Z())
+            return ImPlotPyramidSeries_Plot(handle, label_id_ptr, spec_spec);
+    }
+
+    public void Dispose()
+    {
+        if (handle == IntPtr.Zero)
+            return;
+        ImPlotPyramidSeries_Destroy(handle);
+        handle = IntPtr.Zero;
+    }
+}
@@ -0,0 +1,100 @@
+using System;
+using System.Runtime.InteropServices;
+using ImGuiNET;
+
+namespace LibreLancer.ImUI.ImPlot;
+
+/// <summary>
+/// Fixed capacity (x, y) sample buffer for streaming plots. Pushing past capacity
+/// overwrites the oldest sample. Plotting reads the native storage directly and
+/// Y bounds are tracked incrementally, so per-frame cost scales with new samples only.
+/// </summary>
+public sealed unsafe class ImPlotRingSeries : IDisposable
+{
+    [DllImport("cimgui")]
+    static extern IntPtr ImPlotRingSeries_Create(int capacity);
+
+    [DllImport("cimgui")]
+    static extern void ImPlotRingSeries_Destroy(IntPtr series);
+
+    [DllImport("cimgui")]
+    static extern void ImPlotRingSeries_Clear(IntPtr series);
+
+    [DllImport("cimgui")]
+    static extern void ImPlotRingSeries_Push(IntPtr series, double x, double y);
+
+    [DllImport("cimgui")]
+    static extern void ImPlotRingSeries_PushBatch(IntPtr series, double* xs, double* ys, int count);
+
+    [DllImport("cimgui")]
+    static extern int ImPlotRingSeries_GetCount(IntPtr series);
+
+    [DllImport("cimgui")]
+    static extern byte ImPlotRingSeries_GetBounds(IntPtr series, ImPlotRect* bounds);
+
+    [DllImport("cimgui")]
+    static extern void ImPlotRingSeries_PlotLine(IntPtr series, byte* label_id, ImPlotSpec spec);
+
+    [DllImport("cimgui")]
+    static extern void ImPlotRingSeries_PlotShaded(IntPtr series, byte* label_id, double yref, ImPlotSpec spec);
+
+    private IntPtr handle;
+
+    public int Capacity { get; }
+
+    public int Count => ImPlotRingSeries_GetCount(handle);
+
+    public ImPlotRingSeries(int capacity)
+    {
+        if (capacity <= 0)
+            throw new ArgumentOutOfRangeException(nameof(capacity));
+        Capacity = capacity;
+        handle = ImPlotRingSeries_Create(capacity);
+    }
+
+    public void Push(double x, double y) => ImPlotRingSeries_Push(handle, x, y);
+
+    public void Push(ReadOnlySpan<double> xs, ReadOnlySpan<double> ys)
+    {
+        if (xs.Length != ys.Length)
+            throw new ArgumentException("xs and ys must be the same length");
+        fixed (double* xp = xs)
+        fixed (double* yp = ys)
+            ImPlotRingSeries_PushBatch(handle, xp, yp, xs.Length);
+    }
+
+    public void Clear() => ImPlotRingSeries_Clear(handle);
+
+    /// <summary>
+    /// X spans the oldest to newest sample, Y is the min/max of the window (NaN ignored).
+    /// </summary>
+    public bool TryGetBounds(out ImPlotRect bounds)
+    {
+        fixed (ImPlotRect* b = &bounds)
+            return ImPlotRingSeries_GetBounds(handle, b) != 0;
+    }
+
+    public void PlotLine(string label_id, ImPlotSpec? spec = null)
+    {
+        using var label_id_u8 = new UTF8ZHelper(stackalloc byte[128], label_id ?? "");
+        var spec_spec = spec ?? new ImPlotSpec();
+        fixed (byte* label_id_ptr = label_id_u8.ToUTF8Z())
+            ImPlotRingSeries_PlotLine(handle, label_id_ptr, spec_spec);
+    }
+
+    public void PlotShaded(string label_id, double yref = 0, ImPlotSpec? spec = null)
+    {
+        using var label_id_u8 = new UTF8ZHelper(stackalloc byte[128], label_id ?? "");
+        var spec_spec = spec ?? new ImPlotSpec();
+        fixed (byte* label_id_ptr = label_id_u8.ToUTF8Z())
+            ImPlotRingSeries_PlotShaded(handle, label_id_ptr, yref, spec_spec);
+    }
+
+    public void Dispose()
+    {
+        if (handle == IntPtr.Zero)
+            return;
+        ImPlotRingSeries_Destroy(handle);
+        handle = IntPtr.Zero;
+    }
+}
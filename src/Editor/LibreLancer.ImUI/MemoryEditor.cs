@@ -14,6 +14,27 @@ public class MemoryEditor : IDisposable
 
     [DllImport("cimgui")]
     static extern void igExtMemoryEditDrawContents(IntPtr memedit, IntPtr mem_data_void_ptr, IntPtr mem_size, IntPtr base_display_addr);
+
+    [DllImport("cimgui")]
+    static extern void igExtMemoryEditDrawContentsDiff(IntPtr memedit, IntPtr mem_data_void_ptr, IntPtr mem_size, IntPtr diff_data_ptr, IntPtr diff_size, IntPtr base_display_addr);
+
+    [DllImport("cimgui")]
+    static extern void igExtMemoryEditDrawSource(IntPtr memedit, IntPtr source, IntPtr base_display_addr, [MarshalAs(UnmanagedType.U1)] bool read_only);
+
+    [DllImport("cimgui")]
+    static extern unsafe int igExtMemoryEditAddStruct(IntPtr memedit, byte* name, IntPtr size);
+
+    [DllImport("cimgui")]
+    static extern unsafe void igExtMemoryEditAddStructField(IntPtr memedit, int struct_id, byte* name, ImGuiDataType data_type, IntPtr offset, int count, MemoryEditorFieldFlags flags);
+
+    [DllImport("cimgui")]
+    static extern void igExtMemoryEditAddStructOverlay(IntPtr memedit, int struct_id, IntPtr addr, IntPtr count);
+
+    [DllImport("cimgui")]
+    static extern void igExtMemoryEditClearStructOverlays(IntPtr memedit);
+
+    [DllImport("cimgui")]
+    static extern void igExtMemoryEditClearStructs(IntPtr memedit);
     IntPtr nativePtr;
 
     public MemoryEditor()
@@ -35,6 +56,59 @@ public class MemoryEditor : IDisposable
         }
     }
 
+    /// <summary>
+    /// Draws mem_data with bytes that differ from diff_reference highlighted.
+    /// </summary>
+    public unsafe void DrawContents(byte[] mem_data, int mem_size, byte[] diff_reference, int base_display_addr = 0)
+    {
+        if (disposed) throw new ObjectDisposedException("MemoryEditor");
+        fixed(byte *ptr = mem_data)
+        fixed(byte *diff = diff_reference)
+        {
+            igExtMemoryEditDrawContentsDiff(nativePtr, (IntPtr)ptr, (IntPtr)mem_size, (IntPtr)diff, (IntPtr)(diff_reference?.Length ?? 0), (IntPtr)base_display_addr);
+        }
+    }
+
+    /// <summary>
+    /// Draws a paged source, only the visible rows are read. Edits are recorded in the source's patches.
+    /// </summary>
+    public void DrawContents(MemoryEditorPagedSource source, bool readOnly = false, long base_display_addr = 0)
+    {
+        if (disposed) throw new ObjectDisposedException("MemoryEditor");
+        igExtMemoryEditDrawSource(nativePtr, source.NativePtr, (IntPtr)base_display_addr, readOnly);
+    }
+
+    /// <summary>
+    /// Registers a struct template, fields are added with AddStructField. Returns the struct id.
+    /// </summary>
+    public unsafe int AddStruct(string name, int size)
+    {
+        using var name_u8 = new UTF8ZHelper(stackalloc byte[128], name ?? "");
+        fixed (byte* name_ptr = name_u8.ToUTF8Z())
+            return igExtMemoryEditAddStruct(nativePtr, name_ptr, (IntPtr)size);
+    }
+
+    public unsafe void AddStructField(int structId, string name, ImGuiDataType type, int offset, int count = 1,
+        MemoryEditorFieldFlags flags = MemoryEditorFieldFlags.None)
+    {
+        using var name_u8 = new UTF8ZHelper(stackalloc byte[128], name ?? "");
+        fixed (byte* name_ptr = name_u8.ToUTF8Z())
+            igExtMemoryEditAddStructField(nativePtr, structId, name_ptr, type, (IntPtr)offset, count, flags);
+    }
+
+    /// <summary>
+    /// Lays count consecutive instances of a struct over the data at addr. Later overlays draw over earlier ones.
+    /// </summary>
+    public void AddStructOverlay(int structId, long addr, long count = 1) =>
+        igExtMemoryEditAddStructOverlay(nativePtr, structId, (IntPtr)addr, (IntPtr)count);
+
+    public void ClearStructOverlays() => igExtMemoryEditClearStructOverlays(nativePtr);
+
+    /// <summary>
+    /// Removes all struct templates and overlays.
+    /// </summary>
+    public void ClearStructs() => igExtMemoryEditClearStructs(nativePtr);
+
     bool disposed = false;
     public void Dispose()
     {
@@ -42,4 +116,14 @@ public class MemoryEditor : IDisposable
         igExtMemoryEditFree(nativePtr);
         disposed = true;
     }
-}
\ No newline at end of file
+}
+
+[Flags]
+public enum MemoryEditorFieldFlags
+{
+    None = 0,
+    // Display a S8/U8 array as text up to the first null
+    String = 1 << 0,
+    // Display integers in hexadecimal
+    Hex = 1 << 1
+}
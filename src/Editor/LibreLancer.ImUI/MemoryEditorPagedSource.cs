@@ -0,0 +1,98 @@
+using System;
+using System.IO;
+using System.Runtime.InteropServices;
+
+namespace ImGuiNET;
+
+/// <summary>
+/// Data for MemoryEditor that is read in pages on demand instead of held in one array.
+/// Recently used pages are cached natively, edits are kept as a patch list until applied.
+/// </summary>
+public unsafe class MemoryEditorPagedSource : IDisposable
+{
+    [DllImport("cimgui")]
+    static extern IntPtr igExtMemoryEditSourceCreate(IntPtr read_callback, IntPtr user_data, UIntPtr size, UIntPtr page_size, int page_count);
+
+    [DllImport("cimgui")]
+    static extern void igExtMemoryEditSourceInvalidate(IntPtr source);
+
+    [DllImport("cimgui")]
+    static extern int igExtMemoryEditSourceGetPatchCount(IntPtr source);
+
+    [DllImport("cimgui")]
+    static extern int igExtMemoryEditSourceGetPatches(IntPtr source, UIntPtr* addrs, byte* values, int count);
+
+    [DllImport("cimgui")]
+    static extern void igExtMemoryEditSourceClearPatches(IntPtr source);
+
+    [DllImport("cimgui")]
+    static extern void igExtMemoryEditSourceFree(IntPtr source);
+
+    delegate UIntPtr NativeReadFunc(IntPtr user_data, UIntPtr offset, IntPtr buffer, UIntPtr size);
+
+    public delegate int ReadFunc(long offset, Span<byte> buffer);
+
+    internal IntPtr NativePtr;
+    private NativeReadFunc nativeRead; //Keep delegate alive for the native side
+    private ReadFunc read;
+
+    public long Size { get; }
+
+    public int PatchCount => igExtMemoryEditSourceGetPatchCount(NativePtr);
+
+    /// <param name="read">Fills the buffer from offset and returns the number of bytes read</param>
+    public MemoryEditorPagedSource(ReadFunc read, long size, int pageSize = 64 * 1024, int pageCount = 64)
+    {
+        if ((long)pageSize * pageCount > int.MaxValue)
+            throw new ArgumentOutOfRangeException(nameof(pageSize), "pageSize * pageCount must not exceed int.MaxValue bytes");
+        this.read = read;
+        Size = size;
+        nativeRead = (_, offset, buffer, count) =>
+            (UIntPtr)this.read((long)offset, new Span<byte>((void*)buffer, (int)count));
+        NativePtr = igExtMemoryEditSourceCreate(Marshal.GetFunctionPointerForDelegate(nativeRead), IntPtr.Zero,
+            (UIntPtr)size, (UIntPtr)pageSize, pageCount);
+        if (NativePtr == IntPtr.Zero)
+            throw new InvalidOperationException("igExtMemoryEditSourceCreate failed");
+    }
+
+    /// <summary>
+    /// Reads from a seekable stream, e.g. a FileStream or MemoryMappedViewStream.
+    /// </summary>
+    public MemoryEditorPagedSource(Stream stream, int pageSize = 64 * 1024, int pageCount = 64)
+        : this((offset, buffer) =>
+        {
+            stream.Seek(offset, SeekOrigin.Begin);
+            return stream.ReadAtLeast(buffer, buffer.Length, false);
+        }, stream.Length, pageSize, pageCount)
+    {
+    }
+
+    /// <summary>
+    /// Drops cached pages, call when the underlying data changes. Patches are kept.
+    /// </summary>
+    public void Invalidate() => igExtMemoryEditSourceInvalidate(NativePtr);
+
+    public (long Offset, byte Value)[] GetPatches()
+    {
+        var count = PatchCount;
+        var addrs = new UIntPtr[count];
+        var values = new byte[count];
+        fixed (UIntPtr* a = addrs)
+        fixed (byte* v = values)
+            count = igExtMemoryEditSourceGetPatches(NativePtr, a, v, count);
+        var patches = new (long, byte)[count];
+        for (int i = 0; i < count; i++)
+            patches[i] = ((long)addrs[i], values[i]);
+        return patches;
+    }
+
+    public void ClearPatches() => igExtMemoryEditSourceClearPatches(NativePtr);
+
+    bool disposed = false;
+    public void Dispose()
+    {
+        if (disposed) return;
+        igExtMemoryEditSourceFree(NativePtr);
+        disposed = true;
+    }
+}
@@ -31,6 +31,7 @@ public enum StyleVar
     SnapLinkToPinDir,
     HoveredNodeBorderOffset,
     SelectedNodeBorderOffset,
+    LodZoomThreshold,
 
     Count
 }
@@ -72,6 +73,21 @@ public enum FlowDirection
     Backward
 }
 
+public enum LayoutMode
+{
+    Auto,
+    Layered,
+    ForceDirected
+}
+
+public enum MinimapLocation
+{
+    TopLeft,
+    TopRight,
+    BottomLeft,
+    BottomRight
+}
+
 public enum CanvasSizeMode
 {
     FitVerticalView,
@@ -0,0 +1,25 @@
+using System.Numerics;
+
+namespace LibreLancer.ImUI.NodeEditor;
+
+public unsafe struct LayoutOptions
+{
+    public LayoutMode Mode;
+    public Vector2 Spacing;               // gap between layers (x) and between nodes in a layer (y)
+    public float ComponentSpacing;        // gap between disconnected parts of the graph
+    public int SweepIterations;           // barycenter sweeps per ordering trial
+    public int OrderingTrials;            // independent crossing minimisation runs, best is kept
+    public int ForceIterations;
+    public float MaxReversedEdgeRatio;    // Auto mode falls back to force directed above this share of cycle edges
+    public int ThreadCount;               // 0 uses the hardware concurrency
+
+    public static LayoutOptions Default
+    {
+        get
+        {
+            LayoutOptions options;
+            NodeEditorNative.axLayoutOptions_Init(&options);
+            return options;
+        }
+    }
+}
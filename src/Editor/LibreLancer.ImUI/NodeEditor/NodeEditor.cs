@@ -66,6 +66,25 @@ public static unsafe class NodeEditor
     public static void Group(Vector2 size) => axGroup(&size);
     public static void EndNode() => axEndNode();
 
+    /// <summary>
+    /// True when the node's contents don't need submitting this frame, because it is
+    /// off screen or the editor is zoomed out past Style.LodZoomThreshold.
+    /// </summary>
+    public static bool IsNodeCulled(NodeId nodeId) => axIsNodeCulled(nodeId) != 0;
+    public static bool IsLodActive() => axIsLodActive() != 0;
+
+    public static void SetNodeTitle(string title)
+    {
+        using var titleptr = UnsafeHelpers.StringToNativeUTF8(title);
+        axSetNodeTitle((IntPtr)titleptr);
+    }
+
+    /// <summary>
+    /// Call between BeginNode and EndNode instead of submitting contents.
+    /// The node keeps its size and pins from the last frame they were submitted.
+    /// </summary>
+    public static void SkipNodeContents() => axSkipNodeContents();
+
     public static bool BeginGroupHint(NodeId nodeId) => axBeginGroupHint(nodeId) != 0;
     public static Vector2 GetGroupMin()
     {
@@ -195,6 +214,72 @@ public static unsafe class NodeEditor
         return x;
     }
 
+    public static void SetNodePositions(ReadOnlySpan<NodeId> nodeIds, ReadOnlySpan<Vector2> editorPositions)
+    {
+        if (editorPositions.Length < nodeIds.Length)
+            throw new ArgumentException("Not enough positions for nodes", nameof(editorPositions));
+        fixed (NodeId* a = nodeIds)
+        fixed (Vector2* b = editorPositions)
+            axSetNodePositions((IntPtr*)a, b, nodeIds.Length);
+    }
+
+    public static void SetGroupSizes(ReadOnlySpan<NodeId> nodeIds, ReadOnlySpan<Vector2> sizes)
+    {
+        if (sizes.Length < nodeIds.Length)
+            throw new ArgumentException("Not enough sizes for nodes", nameof(sizes));
+        fixed (NodeId* a = nodeIds)
+        fixed (Vector2* b = sizes)
+            axSetGroupSizes((IntPtr*)a, b, nodeIds.Length);
+    }
+
+    public static void GetNodePositions(ReadOnlySpan<NodeId> nodeIds, Span<Vector2> positions)
+    {
+        if (positions.Length < nodeIds.Length)
+            throw new ArgumentException("Not enough positions for nodes", nameof(positions));
+        fixed (NodeId* a = nodeIds)
+        fixed (Vector2* b = positions)
+            axGetNodePositions((IntPtr*)a, b, nodeIds.Length);
+    }
+
+    public static void GetNodeSizes(ReadOnlySpan<NodeId> nodeIds, Span<Vector2> sizes)
+    {
+        if (sizes.Length < nodeIds.Length)
+            throw new ArgumentException("Not enough sizes for nodes", nameof(sizes));
+        fixed (NodeId* a = nodeIds)
+        fixed (Vector2* b = sizes)
+            axGetNodeSizes((IntPtr*)a, b, nodeIds.Length);
+    }
+
+    /// <summary>
+    /// Fills nodeIds and rects (min x, min y, max x, max y in canvas space) for every node,
+    /// or only the nodes overlapping the view.
+    /// </summary>
+    /// <returns>The number of nodes written</returns>
+    public static int GetNodeRects(Span<NodeId> nodeIds, Span<Vector4> rects, bool visibleOnly = false)
+    {
+        fixed (NodeId* a = nodeIds)
+        fixed (Vector4* b = rects)
+            return axGetNodeRects((IntPtr*)a, b, Math.Min(nodeIds.Length, rects.Length), visibleOnly ? 1 : 0);
+    }
+
+    /// <summary>
+    /// Arranges every node. Call after End() once the nodes have been submitted, so sizes and links are known.
+    /// </summary>
+    public static void AutoLayout() => AutoLayout(LayoutOptions.Default);
+
+    public static void AutoLayout(LayoutOptions options) => axAutoLayout(&options);
+
+    /// <summary>
+    /// Places only nodeIds, next to the nodes they link to. All other nodes keep their positions.
+    /// </summary>
+    public static void AutoLayoutNodes(ReadOnlySpan<NodeId> nodeIds) => AutoLayoutNodes(nodeIds, LayoutOptions.Default);
+
+    public static void AutoLayoutNodes(ReadOnlySpan<NodeId> nodeIds, LayoutOptions options)
+    {
+        fixed (NodeId* a = nodeIds)
+            axAutoLayoutNodes((IntPtr*)a, nodeIds.Length, &options);
+    }
+
     public static void CenterNodeOnScreen(NodeId nodeId) => axCenterNodeOnScreen(nodeId);
     public static void SetNodeZPosition(NodeId nodeId, float z) => axSetNodeZPosition(nodeId, z);
     public static float GetNodeZPosition(NodeId nodeId) => axGetNodeZPosition(nodeId);
@@ -251,6 +336,9 @@ public static unsafe class NodeEditor
     public static void NavigateToContent(float duration = -1) => axNavigateToContent(duration);
     public static void NavigateToSelection(bool zoomIn = false, float duration = -1) => axNavigateToSelection(zoomIn ? 1 : 0, duration);
 
+    public static void ShowMinimap(float sizeFraction = 0.2f, MinimapLocation location = MinimapLocation.BottomRight) =>
+        axShowMinimap(sizeFraction, location);
+
     public static bool ShowNodeContextMenu(out NodeId nodeId)
     {
         fixed (NodeId* a = &nodeId)
@@ -36,6 +36,8 @@ public class NodeEditorConfig : NativeObject, IDisposable
     private ConfigLoadSettings? loadSettings;
     private Func<IntPtr, IntPtr, UIntPtr, SaveReasonFlags, IntPtr, int>? saveNodeSettings;
     private Func<IntPtr, IntPtr, IntPtr, UIntPtr>? loadNodeSettings;
+    private ConfigSaveSettings? saveSettingsBinary;
+    private ConfigLoadSettings? loadSettingsBinary;
     private ConfigNodeDraggedHook? nodeDraggedHook;
     private ConfigNodeResizedHook? nodeResizedHook;
 
@@ -82,6 +84,26 @@ public class NodeEditorConfig : NativeObject, IDisposable
         axConfig_set_LoadNodeSettings(Handle, Marshal.GetFunctionPointerForDelegate(cb));
     }
 
+    /// <summary>
+    /// Receives the settings of every changed node as one binary buffer. Buffers may be
+    /// appended to each other and returned as one from SetLoadSettingsBinary.
+    /// Replaces SetSaveSettings and SetSaveNodeSettings.
+    /// </summary>
+    public void SetSaveSettingsBinary(ConfigSaveSettings cb)
+    {
+        saveSettingsBinary = cb;
+        axConfig_set_SaveSettingsBinary(Handle, Marshal.GetFunctionPointerForDelegate(cb));
+    }
+
+    /// <summary>
+    /// Called with a null buffer for the size, then with a buffer to fill.
+    /// </summary>
+    public void SetLoadSettingsBinary(ConfigLoadSettings cb)
+    {
+        loadSettingsBinary = cb;
+        axConfig_set_LoadSettingsBinary(Handle, Marshal.GetFunctionPointerForDelegate(cb));
+    }
+
     public void SetNodeDraggedHook(ConfigNodeDraggedHook cb)
     {
         nodeDraggedHook = cb;
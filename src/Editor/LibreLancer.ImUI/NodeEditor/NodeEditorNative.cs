@@ -12,6 +12,8 @@ using axConfigSaveSettings = System.IntPtr;
 using axConfigLoadSettings = System.IntPtr;
 using axConfigSaveNodeSettings = System.IntPtr;
 using axConfigLoadNodeSettings = System.IntPtr;
+using axConfigSaveSettingsBinary = System.IntPtr;
+using axConfigLoadSettingsBinary = System.IntPtr;
 using axConfigNodeDraggedHook = System.IntPtr;
 using axConfigNodeResizedHook = System.IntPtr;
 
@@ -65,6 +67,18 @@ static unsafe partial class NodeEditorNative
     [LibraryImport("cimgui")]
     public static partial void axConfig_set_LoadNodeSettings(IntPtr config, axConfigLoadNodeSettings loadNodeSettings);
 
+    [LibraryImport("cimgui")]
+    public static partial axConfigSaveSettingsBinary axConfig_get_SaveSettingsBinary(IntPtr config);
+
+    [LibraryImport("cimgui")]
+    public static partial void axConfig_set_SaveSettingsBinary(IntPtr config, axConfigSaveSettingsBinary saveSettingsBinary);
+
+    [LibraryImport("cimgui")]
+    public static partial axConfigLoadSettingsBinary axConfig_get_LoadSettingsBinary(IntPtr config);
+
+    [LibraryImport("cimgui")]
+    public static partial void axConfig_set_LoadSettingsBinary(IntPtr config, axConfigLoadSettingsBinary loadSettingsBinary);
+
 
     [LibraryImport("cimgui")]
     public static partial axConfigNodeDraggedHook axConfig_get_NodeDraggedHook(IntPtr config);
@@ -201,6 +215,18 @@ static unsafe partial class NodeEditorNative
     [LibraryImport("cimgui")]
     public static partial void axEndNode();
 
+    [LibraryImport("cimgui")]
+    public static partial int axIsNodeCulled(axNodeId nodeId);
+
+    [LibraryImport("cimgui")]
+    public static partial int axIsLodActive();
+
+    [LibraryImport("cimgui")]
+    public static partial void axSetNodeTitle(IntPtr title);
+
+    [LibraryImport("cimgui")]
+    public static partial void axSkipNodeContents();
+
     [LibraryImport("cimgui")]
     public static partial int axBeginGroupHint(axNodeId nodeId);
 
@@ -299,6 +325,30 @@ static unsafe partial class NodeEditorNative
     [LibraryImport("cimgui")]
     public static partial float axGetNodeZPosition(axNodeId nodeId); // Returns node z position, defaults is 0.0f
 
+    [LibraryImport("cimgui")]
+    public static partial void axSetNodePositions(axNodeId* nodeIds, Vector2* editorPositions, int count);
+
+    [LibraryImport("cimgui")]
+    public static partial void axSetGroupSizes(axNodeId* nodeIds, Vector2* sizes, int count);
+
+    [LibraryImport("cimgui")]
+    public static partial void axGetNodePositions(axNodeId* nodeIds, Vector2* positions, int count);
+
+    [LibraryImport("cimgui")]
+    public static partial void axGetNodeSizes(axNodeId* nodeIds, Vector2* sizes, int count);
+
+    [LibraryImport("cimgui")]
+    public static partial int axGetNodeRects(axNodeId* nodeIds, Vector4* rects, int size, int visibleOnly);
+
+    [LibraryImport("cimgui")]
+    public static partial void axLayoutOptions_Init(LayoutOptions* options);
+
+    [LibraryImport("cimgui")]
+    public static partial void axAutoLayout(LayoutOptions* options);
+
+    [LibraryImport("cimgui")]
+    public static partial void axAutoLayoutNodes(axNodeId* nodeIds, int count, LayoutOptions* options);
+
     [LibraryImport("cimgui")]
     public static partial void axRestoreNodeState(axNodeId nodeId);
 
@@ -371,6 +421,9 @@ static unsafe partial class NodeEditorNative
     [LibraryImport("cimgui")]
     public static partial void axNavigateToSelection(int zoomIn, float duration);
 
+    [LibraryImport("cimgui")]
+    public static partial void axShowMinimap(float sizeFraction, MinimapLocation location);
+
     [LibraryImport("cimgui")]
     public static partial int axShowNodeContextMenu(axNodeId* nodeId);
 
@@ -31,5 +31,6 @@ public unsafe struct Style
     public float   GroupBorderWidth;
     public float   HighlightConnectedLinks;
     public float   SnapLinkToPinDir; // when true link will start on the line defined by pin direction
+    public float   LodZoomThreshold; // below this view scale nodes are drawn as titled rectangles and links as coarse curves, 0 disables
     public fixed float  _Colors[(int)StyleColor.Count * 4];
 }
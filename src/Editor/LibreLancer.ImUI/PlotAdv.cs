@@ -9,28 +9,35 @@ namespace LibreLancer.ImUI;
 public static unsafe class PlotAdv
 {
     [DllImport("cimgui")]
-    static extern int igExtPlot(
+    static extern int igExtPlotArray(
         int plotType,
         byte* label,
-        delegate* unmanaged<IntPtr, int, float> values_getter,
-        delegate* unmanaged<IntPtr, int, IntPtr, int> get_tooltip,
-        IntPtr data,
+        float* values,
+        float* xs,
         int values_count,
         int values_offset,
+        int stride,
+        delegate* unmanaged<IntPtr, int, IntPtr, int> get_tooltip,
+        IntPtr data,
         byte* overlay_text,
         float scale_min,
         float scale_max,
         float size_x,
         float size_y);
 
-    [UnmanagedCallersOnly]
-    static float GetValue(IntPtr data, int index) => ((float*) data)[index];
-
     delegate int NativeTooltipFunc(IntPtr data, int index, IntPtr buffer);
 
     public static void PlotLines(string label, ReadOnlySpan<float> values, Func<int, float, string?>? get_tooltip,
-        string overlay_text, float scaleMin, float scaleMax, Vector2 size)
+        string overlay_text, float scaleMin, float scaleMax, Vector2 size) =>
+        PlotLines(label, values, ReadOnlySpan<float>.Empty, get_tooltip, overlay_text, scaleMin, scaleMax, size);
+
+    // xs is optional, when given it must be ascending and the same length as values
+    public static void PlotLines(string label, ReadOnlySpan<float> values, ReadOnlySpan<float> xs,
+        Func<int, float, string?>? get_tooltip, string overlay_text, float scaleMin, float scaleMax, Vector2 size)
     {
+        if (!xs.IsEmpty && xs.Length != values.Length)
+            throw new ArgumentException("xs must be empty or match values in length", nameof(xs));
+
         byte* labelBuf = stackalloc byte[256];
         byte* overlayBuf = stackalloc byte[256];
         using var utf8z_label = new ImGuiNET.UTF8ZHelper(labelBuf, 256, label);
@@ -66,9 +73,10 @@ public static unsafe class PlotAdv
         }
 
         fixed (float* ptr = &values.GetPinnableReference())
+        fixed (float* xsPtr = &xs.GetPinnableReference())
         {
-            igExtPlot(0, utf8z_label.Pointer, &GetValue, tooltipFunc, (IntPtr) ptr, values.Length,
-                0, utf8z_overlay.Pointer, scaleMin, scaleMax, size.X, size.Y);
+            igExtPlotArray(0, utf8z_label.Pointer, ptr, xsPtr, values.Length, 0, sizeof(float),
+                tooltipFunc, (IntPtr) ptr, utf8z_overlay.Pointer, scaleMin, scaleMax, size.X, size.Y);
         }
     }
 }
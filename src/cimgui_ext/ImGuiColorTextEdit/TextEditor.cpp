@@ -12,6 +12,8 @@
 #include <cmath>
 #include <limits>
 
+#include "simd_ext.h"
+
 #ifndef IMGUI_DEFINE_MATH_OPERATORS
 #define IMGUI_DEFINE_MATH_OPERATORS
 #endif
@@ -50,6 +52,74 @@ void TextEditor::setText(const std::string_view &text) {
 }
 
 
+//
+//	TextEditor::SetAppendOnlyEnabled
+//
+
+void TextEditor::SetAppendOnlyEnabled(bool value) {
+    if (value == appendOnly) {
+        return;
+    }
+
+    appendOnly = value;
+
+    if (value) {
+        // appended text bypasses transactions, so there is nothing to undo
+        readOnlyBeforeAppendOnly = readOnly;
+        readOnly = true;
+        transactions.reset();
+        autocomplete.cancel();
+        followTail = true;
+
+    } else {
+        readOnly = readOnlyBeforeAppendOnly;
+        document.flushAppendedText();
+    }
+}
+
+
+//
+//	TextEditor::appendText
+//
+
+void TextEditor::appendText(const std::string_view& text) {
+    // only process the lines touched by this chunk
+    auto first = document.appendText(text);
+
+    if (language) {
+        colorizer.updateLines(document, language, first, document.lineCount() - 1);
+    }
+
+    // appended lines are already colorized, so skip the full document scan in the next render
+    document.resetUpdated();
+
+    // drop the oldest lines once we are well over the limit (this amortizes the cost of moving the remaining lines)
+    if (maxLineCount && document.lineCount() > maxLineCount + maxLineCount / 4) {
+        auto count = document.lineCount() - maxLineCount;
+        document.removeFirstLines(count);
+
+        auto shift = [count](Coordinate coordinate) {
+            return coordinate.line < count ? Coordinate(0, 0) : Coordinate(coordinate.line - count, coordinate.column);
+        };
+
+        for (auto& cursor : cursors) {
+            cursor.update(shift(cursor.getInteractiveStart()), shift(cursor.getInteractiveEnd()));
+        }
+
+        // markers would now point at the wrong lines
+        clearMarkers();
+
+        if (!followTail) {
+            droppedLines += count;
+        }
+    }
+
+    if (autoScroll && followTail) {
+        scrollToBottom = true;
+    }
+}
+
+
 //
 //	TextEditor::render
 //
@@ -153,6 +223,17 @@ void TextEditor::render(const char* title, const ImVec2& size, bool border) {
         scrollToLineNumber = -1;
     }
 
+    // follow appended text or keep the view steady when old lines were dropped (append-only mode)
+    if (scrollToBottom) {
+        scrollY = std::max(0.0f, totalSize.y - visibleHeight);
+        scrollToBottom = false;
+
+    } else if (droppedLines) {
+        scrollY = std::max(0.0f, static_cast<float>(firstVisibleLine - droppedLines) * glyphSize.y);
+    }
+
+    droppedLines = 0;
+
     // set scroll (if required)
     if (scrollX >= 0.0f || scrollY >= 0.0f) {
         ImGui::SetNextWindowScroll(ImVec2(scrollX, scrollY));
@@ -185,6 +266,10 @@ void TextEditor::render(const char* title, const ImVec2& size, bool border) {
     if (showMatchingBracketsChanged || languageChanged) {
         colorizer.updateEntireDocument(document, language);
         bracketeer.reset();
+
+        if (identifierAutoComplete && languageChanged) {
+            updateLanguageIdentifiers();
+        }
     }
 
     // was document changed during this frame?
@@ -196,12 +281,21 @@ void TextEditor::render(const char* title, const ImVec2& size, bool border) {
             colorizer.updateChangedLines(document, language);
         }
 
-        if (showMatchingBrackets && (documentChanged || showMatchingBracketsChanged || languageChanged)) {
+        if (showMatchingBrackets && !appendOnly && (documentChanged || showMatchingBracketsChanged || languageChanged)) {
             // rebuild bracket list
             bracketeer.update(document);
         }
     }
 
+    // release identifiers from deleted lines (this is done after recolorizing so moved words stay alive)
+    if (identifierAutoComplete) {
+        for (auto word : document.getReleasedIdentifiers()) {
+            identifierTrie.release(word);
+        }
+
+        document.getReleasedIdentifiers().clear();
+    }
+
     // reset changed states
     showMatchingBracketsChanged = false;
     languageChanged = false;
@@ -212,6 +306,11 @@ void TextEditor::render(const char* title, const ImVec2& size, bool border) {
     firstVisibleLine = std::max(static_cast<int>(std::floor(ImGui::GetScrollY() / glyphSize.y)), 0);
     lastVisibleLine = std::min(static_cast<int>(std::floor((ImGui::GetScrollY() + visibleHeight) / glyphSize.y)), document.lineCount() - 1);
 
+    // see if the view is at the bottom (in which case appended text is followed)
+    if (appendOnly) {
+        followTail = ImGui::GetScrollY() >= ImGui::GetScrollMaxY() - glyphSize.y * 0.5f;
+    }
+
     // render editor parts
     renderSelections();
     renderMarkers();
@@ -2657,14 +2756,308 @@ void TextEditor::Document::setText(const std::string_view& text) {
     clearDocument();
     appendLine();
     updated = true;
+    invalidSequences = 0;
+    firstInvalidOffset = 0;
+    decodedBytes = 0;
 
     // process UTF-8 and generate lines of glyphs
-    auto end = text.end();
-    auto i = CodePoint::skipBOM(text.begin(), end);
+    auto start = CodePoint::skipBOM(text.begin(), text.end()) - text.begin();
+    decodedBytes = start;
+    decodeText(text.substr(start));
+
+    // update maximum column counts
+    updateMaximumColumn(0, lineCount() - 1);
+}
+
+
+#if defined(IMGUI_EXT_SSE2) || defined(IMGUI_EXT_NEON)
+
+//
+//	Utf8Masks
+//
+
+// per byte classification of a 16 byte block (bit n describes byte n)
+struct Utf8Masks {
+    uint32_t printable; // 0x20-0x7f
+    uint32_t high; // 0x80-0xff
+    uint32_t continuation; // 10xxxxxx
+    uint32_t lead2; // 110xxxxx
+    uint32_t lead3; // 1110xxxx
+    uint32_t lead4; // 11110xxx
+    uint32_t bad; // lead bytes that can only start overlong, surrogate or out of range sequences
+};
+
+#if defined(IMGUI_EXT_SSE2)
+static inline uint32_t byteMask(__m128i value) {
+    return static_cast<uint32_t>(_mm_movemask_epi8(value));
+}
+
+static inline uint32_t sequenceStarts(const char* text) {
+    // everything but continuation bytes (0x80-0xbf are the only signed bytes below -0x40)
+    return byteMask(_mm_cmpgt_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(text)), _mm_set1_epi8(-0x41)));
+}
+
+static inline Utf8Masks classifyUtf8(const char* text) {
+    // reads 17 bytes (the byte after the block completes the second byte checks)
+    auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text));
+    auto equal = [](__m128i value, int byte) { return _mm_cmpeq_epi8(value, _mm_set1_epi8(static_cast<char>(byte))); };
+    auto masked = [&](int bits, int byte) { return byteMask(equal(_mm_and_si128(block, _mm_set1_epi8(static_cast<char>(bits))), byte)); };
+
+    // with the sign bit flipped, bytes compare as unsigned values
+    auto flip = _mm_set1_epi8(static_cast<char>(0x80));
+    auto second = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(text + 1)), flip);
+    auto below90 = byteMask(_mm_cmplt_epi8(second, _mm_set1_epi8(0x90 - 0x80)));
+    auto belowA0 = byteMask(_mm_cmplt_epi8(second, _mm_set1_epi8(0xa0 - 0x80)));
+    auto aboveF4 = byteMask(_mm_cmpgt_epi8(_mm_xor_si128(block, flip), _mm_set1_epi8(0xf4 - 0x80)));
+
+    Utf8Masks masks;
+    masks.printable = byteMask(_mm_cmpgt_epi8(block, _mm_set1_epi8(0x1f)));
+    masks.high = byteMask(block);
+    masks.continuation = masked(0xc0, 0x80);
+    masks.lead2 = masked(0xe0, 0xc0);
+    masks.lead3 = masked(0xf0, 0xe0);
+    masks.lead4 = masked(0xf8, 0xf0);
+    masks.bad = masked(0xfe, 0xc0) | aboveF4 |
+        (byteMask(equal(block, 0xe0)) & belowA0) | (byteMask(equal(block, 0xed)) & ~belowA0) |
+        (byteMask(equal(block, 0xf0)) & below90) | (byteMask(equal(block, 0xf4)) & ~below90);
+
+    return masks;
+}
+
+#elif defined(IMGUI_EXT_NEON)
+static inline uint32_t byteMask(uint8x16_t value) {
+    // NEON has no movemask, so weigh each lane by its bit and add up both halves
+    static const uint8_t weights[16] = {1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+    auto bits = vandq_u8(value, vld1q_u8(weights));
+    return static_cast<uint32_t>(vaddv_u8(vget_low_u8(bits))) | (static_cast<uint32_t>(vaddv_u8(vget_high_u8(bits))) << 8);
+}
+
+static inline uint32_t sequenceStarts(const char* text) {
+    auto block = vld1q_u8(reinterpret_cast<const uint8_t*>(text));
+    return byteMask(vmvnq_u8(vceqq_u8(vandq_u8(block, vdupq_n_u8(0xc0)), vdupq_n_u8(0x80))));
+}
+
+static inline Utf8Masks classifyUtf8(const char* text) {
+    // reads 17 bytes (the byte after the block completes the second byte checks)
+    auto block = vld1q_u8(reinterpret_cast<const uint8_t*>(text));
+    auto equal = [](uint8x16_t value, int byte) { return vceqq_u8(value, vdupq_n_u8(static_cast<uint8_t>(byte))); };
+    auto masked = [&](int bits, int byte) { return byteMask(equal(vandq_u8(block, vdupq_n_u8(static_cast<uint8_t>(bits))), byte)); };
+
+    auto second = vld1q_u8(reinterpret_cast<const uint8_t*>(text + 1));
+    auto below90 = byteMask(vcltq_u8(second, vdupq_n_u8(0x90)));
+    auto belowA0 = byteMask(vcltq_u8(second, vdupq_n_u8(0xa0)));
+
+    Utf8Masks masks;
+    masks.printable = byteMask(vandq_u8(vcgtq_u8(block, vdupq_n_u8(0x1f)), vcltq_u8(block, vdupq_n_u8(0x80))));
+    masks.high = byteMask(vcgeq_u8(block, vdupq_n_u8(0x80)));
+    masks.continuation = masked(0xc0, 0x80);
+    masks.lead2 = masked(0xe0, 0xc0);
+    masks.lead3 = masked(0xf0, 0xe0);
+    masks.lead4 = masked(0xf8, 0xf0);
+    masks.bad = masked(0xfe, 0xc0) | byteMask(vcgtq_u8(block, vdupq_n_u8(0xf4))) |
+        (byteMask(equal(block, 0xe0)) & belowA0) | (byteMask(equal(block, 0xed)) & ~belowA0) |
+        (byteMask(equal(block, 0xf0)) & below90) | (byteMask(equal(block, 0xf4)) & ~below90);
+
+    return masks;
+}
+#endif
+
+static inline int lowestBit(uint32_t value) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, value);
+    return static_cast<int>(index);
+#else
+    return __builtin_ctz(value);
+#endif
+}
+
+static inline int highestBit(uint32_t value) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanReverse(&index, value);
+    return static_cast<int>(index);
+#else
+    return 31 - __builtin_clz(value);
+#endif
+}
+
+static inline int countBits(uint32_t value) {
+    value = value - ((value >> 1) & 0x55555555);
+    value = (value & 0x33333333) + ((value >> 2) & 0x33333333);
+    return static_cast<int>((((value + (value >> 4)) & 0x0f0f0f0f) * 0x01010101) >> 24);
+}
+
+
+//
+//	validUtf8
+//
+
+static size_t validUtf8(const char* text, size_t size, size_t* codepoints) {
+    // returns the number of leading bytes that are printable ASCII or complete, valid multibyte sequences
+    // blocks are checked at a fixed 16 byte stride (the continuation bytes a block announces carry into the next one)
+    // and only while 20 bytes are left, so decoding the result can always read 4 bytes (the rest goes through readValidated)
+    size_t count = 0;
+    size_t points = 0;
+    size_t spillingLead = 0;
+    uint32_t carry = 0;
+
+    while (count + 20 <= size) {
+        auto masks = classifyUtf8(text + count);
+        auto leads = masks.lead2 | masks.lead3 | masks.lead4;
+        auto expected = carry | (masks.lead2 << 1) | (masks.lead3 << 1) | (masks.lead3 << 2) | (masks.lead4 << 1) | (masks.lead4 << 2) | (masks.lead4 << 3);
+        auto control = ~(masks.printable | masks.high) & 0xffff;
+        auto errors = ((masks.continuation ^ expected) & 0xffff) | masks.bad | control;
+
+        if (errors) {
+            auto valid = lowestBit(errors);
+
+            // the sequence carried over from the previous block is broken
+            if (carry >> valid) {
+                *codepoints = points - 1;
+                return spillingLead;
+            }
+
+            // otherwise keep the complete sequences in front of the error
+            auto before = leads & ((1u << valid) - 1);
+
+            if (before) {
+                auto last = highestBit(before);
+                auto length = ((masks.lead2 >> last) & 1) ? 2 : ((masks.lead3 >> last) & 1) ? 3 : 4;
+
+                if (last + length > valid) {
+                    valid = last;
+                }
+            }
+
+            *codepoints = points + countBits(~masks.continuation & ((1u << valid) - 1));
+            return count + valid;
+        }
+
+        carry = expected >> 16;
+
+        if (carry) {
+            spillingLead = count + highestBit(leads);
+        }
+
+        points += countBits(~masks.continuation & 0xffff);
+        count += 16;
+    }
+
+    // a sequence running into the unchecked bytes is left to readValidated as well
+    if (carry) {
+        *codepoints = points - 1;
+        return spillingLead;
+    }
+
+    *codepoints = points;
+    return count;
+}
+
+
+//
+//	readTrusted
+//
+
+static inline const char* readTrusted(const char* i, ImWchar* codepoint) {
+    // decode a sequence that passed validUtf8 (4 bytes must be readable)
+    static const unsigned char lengths[32] = {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 3, 3, 4, 0};
+    static const unsigned char leadMasks[5] = {0, 0x7f, 0x1f, 0x0f, 0x07};
+    static const unsigned char shifts[5] = {0, 18, 12, 6, 0};
+
+    // branch free, as the sequence lengths in mixed script text are hard to predict
+    auto bytes = reinterpret_cast<const unsigned char*>(i);
+    auto length = lengths[bytes[0] >> 3];
+
+    auto result = (
+        (static_cast<ImWchar32>(bytes[0] & leadMasks[length]) << 18) |
+        (static_cast<ImWchar32>(bytes[1] & 0x3f) << 12) |
+        (static_cast<ImWchar32>(bytes[2] & 0x3f) << 6) |
+        (static_cast<ImWchar32>(bytes[3] & 0x3f))) >> shifts[length];
+
+#if defined(IMGUI_USE_WCHAR32)
+    *codepoint = static_cast<ImWchar>(result);
+#else
+    // valid UTF-8 but outside of what ImWchar can represent
+    *codepoint = result > 0xffff ? IM_UNICODE_CODEPOINT_INVALID : static_cast<ImWchar>(result);
+#endif
+
+    return i + length;
+}
+
+#endif
+
+
+//
+//	TextEditor::Document::decodeText
+//
+
+void TextEditor::Document::decodeText(const std::string_view& text) {
+    // append UTF-8 text to the end of the document
+    auto start = text.data();
+    auto end = start + text.size();
+    auto i = start;
 
     while (i < end) {
+        // fast path: copy runs of plain ASCII straight into the current line
+        if (static_cast<signed char>(*i) > 0x1f) {
+            auto run = CodePoint::plainAscii(i, end - i);
+            auto& line = back();
+            auto offset = line.size();
+            line.resize(offset + run);
+
+            for (size_t j = 0; j < run; j++) {
+                line[offset + j].codepoint = static_cast<ImWchar>(i[j]);
+            }
+
+            i += run;
+
+            if (i == end) {
+                break;
+            }
+        }
+
+#if defined(IMGUI_EXT_SSE2) || defined(IMGUI_EXT_NEON)
+        // multibyte runs: validated 16 bytes at a time and then decoded without further checks
+        if (static_cast<unsigned char>(*i) >= 0x80) {
+            size_t codepoints;
+            auto run = validUtf8(i, end - i, &codepoints);
+
+            if (run) {
+                auto& line = back();
+                auto offset = line.size();
+                line.resize(offset + codepoints);
+                auto glyph = line.begin() + offset;
+
+                for (size_t block = 0; block < run; block += 16) {
+                    auto starts = sequenceStarts(i + block);
+
+                    if (run - block < 16) {
+                        starts &= (1u << (run - block)) - 1;
+                    }
+
+                    while (starts) {
+                        readTrusted(i + block + lowestBit(starts), &(glyph++)->codepoint);
+                        starts &= starts - 1;
+                    }
+                }
+
+                i += run;
+                continue;
+            }
+        }
+#endif
+
+        // slow path: control characters, invalid sequences and the last few bytes
         ImWchar character;
-        i = CodePoint::read(i, end, &character);
+        bool valid;
+        auto next = CodePoint::readValidated(i, end, &character, &valid);
+
+        if (!valid && invalidSequences++ == 0) {
+            firstInvalidOffset = decodedBytes + (i - start);
+        }
+
+        i = next;
 
         if (character == '\n') {
             appendLine();
@@ -2681,8 +3074,7 @@ void TextEditor::Document::setText(const std::string_view& text) {
         }
     }
 
-    // update maximum column counts
-    updateMaximumColumn(0, lineCount() - 1);
+    decodedBytes += text.size();
 }
 
 
@@ -2728,6 +3120,110 @@ void TextEditor::Document::setText(const std::vector<std::string_view>& text) {
 }
 
 
+//
+//	TextEditor::Document::appendText
+//
+
+int TextEditor::Document::appendText(const std::string_view& text) {
+    // the last line may have been left incomplete by a previous append
+    auto first = lineCount() - 1;
+    auto remaining = text;
+
+    // complete a multibyte sequence that was split by the previous append
+    if (pendingText.size()) {
+        auto length = CodePoint::sequenceLength(pendingText[0]);
+
+        while (pendingText.size() < length && remaining.size() && (static_cast<unsigned char>(remaining[0]) & 0xc0) == 0x80) {
+            pendingText += remaining[0];
+            remaining.remove_prefix(1);
+        }
+
+        // decode once complete or as soon as it is known to be broken (in which case it is reported as invalid)
+        if (pendingText.size() == length || remaining.size()) {
+            decodeText(pendingText);
+            pendingText.clear();
+        }
+    }
+
+    // hold back an incomplete sequence at the end of this chunk until the next append
+    if (remaining.size()) {
+        auto tail = CodePoint::incompleteTail(remaining.data(), remaining.size());
+        decodeText(remaining.substr(0, remaining.size() - tail));
+        pendingText.assign(remaining.data() + remaining.size() - tail, tail);
+    }
+
+    updateAppendedLines(first);
+    return first;
+}
+
+
+//
+//	TextEditor::Document::flushAppendedText
+//
+
+void TextEditor::Document::flushAppendedText() {
+    // the appended stream ended inside a multibyte sequence, so its bytes are invalid
+    if (pendingText.size()) {
+        auto first = lineCount() - 1;
+        decodeText(pendingText);
+        pendingText.clear();
+        updateAppendedLines(first);
+    }
+}
+
+
+//
+//	TextEditor::Document::updateAppendedLines
+//
+
+void TextEditor::Document::updateAppendedLines(int first) {
+    // update maximum column counts for the affected lines only
+    for (auto line = begin() + first; line < this->end(); line++) {
+        int column = 0;
+
+        for (auto glyph = line->begin(); glyph < line->end(); glyph++) {
+            column = (glyph->codepoint == '\t') ? ((column / tabSize) + 1) * tabSize : column + 1;
+        }
+
+        line->maxColumn = column;
+        line->colorize = true;
+        maxColumn = std::max(maxColumn, column);
+    }
+
+    updated = true;
+}
+
+
+//
+//	TextEditor::Document::removeFirstLines
+//
+
+void TextEditor::Document::removeFirstLines(int count) {
+    count = std::min(count, lineCount() - 1);
+
+    if (count > 0) {
+        // the widest line only has to be searched for again if it was removed
+        int removedColumn = 0;
+
+        for (auto line = begin(); line < begin() + count; line++) {
+            removedColumn = std::max(removedColumn, line->maxColumn);
+        }
+
+        deleteLines(0, count - 1);
+
+        if (removedColumn >= maxColumn) {
+            maxColumn = 0;
+
+            for (auto line = begin(); line < end(); line++) {
+                maxColumn = std::max(maxColumn, line->maxColumn);
+            }
+        }
+
+        // the remaining lines keep their colors and states, so don't flag the document for a recolorize scan
+    }
+}
+
+
 //
 //	TextEditor::Document::insertText
 //
@@ -2834,25 +3330,78 @@ void TextEditor::Document::deleteText(Coordinate start, Coordinate end) {
 }
 
 
+//
+//	encodeGlyphs
+//
+
+static char* encodeGlyphs(const TextEditor::Glyph* glyph, const TextEditor::Glyph* end, char* output) {
+    // convert glyphs to UTF-8 (output must be large enough)
+#if defined(IMGUI_EXT_SSE2)
+    // ASCII fast path that converts 8 glyphs at a time (glyphs are loaded as 32-bit lanes with the codepoint in the low half)
+    if constexpr (sizeof(TextEditor::Glyph) == 4 && sizeof(ImWchar) == 2) {
+        auto mask = _mm_set1_epi32(0xffff);
+        auto limit = _mm_set1_epi32(0x7f);
+
+        while (end - glyph >= 8) {
+            auto a = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(glyph)), mask);
+            auto b = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(glyph + 4)), mask);
+
+            if (_mm_movemask_epi8(_mm_or_si128(_mm_cmpgt_epi32(a, limit), _mm_cmpgt_epi32(b, limit)))) {
+                break;
+            }
+
+            auto words = _mm_packs_epi32(a, b);
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(output), _mm_packus_epi16(words, words));
+            glyph += 8;
+            output += 8;
+        }
+    }
+#endif
+
+    while (glyph < end) {
+        if (glyph->codepoint < 0x80) {
+            *output++ = static_cast<char>(glyph->codepoint);
+
+        } else {
+            output += TextEditor::CodePoint::write(output, glyph->codepoint);
+        }
+
+        glyph++;
+    }
+
+    return output;
+}
+
+
 //
 //	TextEditor::Document::getText
 //
 
 std::string TextEditor::Document::getText() const {
-    // process all glyphs and generate UTF-8 output
-    std::string text;
-    char utf8[4];
+    // determine the size of the output first so it is only allocated once
+    size_t bytes = size() - 1;
 
     for (auto line = begin(); line < end(); line++) {
         for (auto glyph = line->begin(); glyph < line->end(); glyph++) {
-            text.append(std::string_view(utf8, CodePoint::write(utf8, glyph->codepoint)));
+            auto codepoint = static_cast<ImWchar32>(glyph->codepoint);
+            bytes += 1 + (codepoint >= 0x80) + (codepoint >= 0x800) + (codepoint >= 0x10000);
         }
+    }
+
+    // process all glyphs and generate UTF-8 output
+    std::string text(bytes, '\0');
+    auto output = text.data();
+
+    for (auto line = begin(); line < end(); line++) {
+        output = encodeGlyphs(line->data(), line->data() + line->size(), output);
 
         if (line < end() - 1) {
-            text += "\n";
+            *output++ = '\n';
         }
     }
 
+    // codepoints out of range are written as (3 byte) replacement characters, so the size can shrink
+    text.resize(output - text.data());
     return text;
 }
 
@@ -3555,6 +4104,10 @@ void TextEditor::Document::deleteLines(int start, int end) {
         }
     }
 
+    for (auto i = start; i <= end; i++) {
+        releaseLineIdentifiers(at(i));
+    }
+
     erase(begin() + start, begin() + end + 1);
 }
 
@@ -3570,7 +4123,23 @@ void TextEditor::Document::clearDocument() {
         }
     }
 
+    for (auto& line : *this) {
+        releaseLineIdentifiers(line);
+    }
+
     clear();
+    pendingText.clear();
+}
+
+
+//
+//	TextEditor::Document::releaseLineIdentifiers
+//
+
+void TextEditor::Document::releaseLineIdentifiers(Line& line) {
+    // the trie is owned by the editor, so defer releasing until it processes this list
+    releasedIdentifiers.insert(releasedIdentifiers.end(), line.identifiers.begin(), line.identifiers.end());
+    line.identifiers.clear();
 }
 
 
@@ -3868,18 +4437,59 @@ TextEditor::State TextEditor::Colorizer::update(Line& line, const Language* lang
     }
 
     line.colorize = false;
+
+    if (identifierIndex) {
+        harvestIdentifiers(line);
+    }
+
     return state;
 }
 
 
 //
-//	TextEditor::Colorizer::updateEntireDocument
+//	TextEditor::Colorizer::harvestIdentifiers
 //
 
-void TextEditor::Colorizer::updateEntireDocument(Document& document, const Language* language) {
-    if (language) {
-        for (auto line = document.begin(); line < document.end(); line++) {
-            auto state = update(*line, language);
+void TextEditor::Colorizer::harvestIdentifiers(Line& line) {
+    // take references to the identifiers on this line before releasing the old ones
+    // so words that are still present never drop out of the trie
+    auto previous = line.identifiers.size();
+    auto glyph = line.begin();
+    auto end = line.end();
+    char utf8[4];
+
+    while (glyph < end) {
+        if (isIdentifier(glyph->color)) {
+            identifierBuffer.clear();
+
+            while (glyph < end && isIdentifier(glyph->color)) {
+                identifierBuffer.append(utf8, CodePoint::write(utf8, glyph->codepoint));
+                glyph++;
+            }
+
+            line.identifiers.push_back(identifierIndex->insert(identifierBuffer));
+
+        } else {
+            glyph++;
+        }
+    }
+
+    for (size_t i = 0; i < previous; i++) {
+        identifierIndex->release(line.identifiers[i]);
+    }
+
+    line.identifiers.erase(line.identifiers.begin(), line.identifiers.begin() + previous);
+}
+
+
+//
+//	TextEditor::Colorizer::updateEntireDocument
+//
+
+void TextEditor::Colorizer::updateEntireDocument(Document& document, const Language* language) {
+    if (language) {
+        for (auto line = document.begin(); line < document.end(); line++) {
+            auto state = update(*line, language);
             auto next = line + 1;
 
             if (next < document.end()) {
@@ -3895,6 +4505,10 @@ void TextEditor::Colorizer::updateEntireDocument(Document& document, const Langu
 
             line->state = State::inText;
             line->colorize = false;
+
+            if (identifierIndex) {
+                harvestIdentifiers(*line);
+            }
         }
     }
 }
@@ -3919,6 +4533,22 @@ void TextEditor::Colorizer::updateChangedLines(Document& document, const Languag
 }
 
 
+//
+//	TextEditor::Colorizer::updateLines
+//
+
+void TextEditor::Colorizer::updateLines(Document& document, const Language* language, int first, int last) {
+    for (auto line = document.begin() + first; line <= document.begin() + last; line++) {
+        auto state = update(*line, language);
+        auto next = line + 1;
+
+        if (next < document.end()) {
+            next->state = state;
+        }
+    }
+}
+
+
 //
 //	TextEditor::Colorizer::matches
 //
@@ -4554,6 +5184,124 @@ void TextEditor::replaceAll() {
 
 
 
+//
+//	TextEditor::SetIdentifierAutoCompleteEnabled
+//
+
+void TextEditor::SetIdentifierAutoCompleteEnabled(bool value) {
+    if (value == identifierAutoComplete) {
+        return;
+    }
+
+    identifierAutoComplete = value;
+
+    if (value) {
+        AutoCompleteConfig config;
+
+        config.callback = [this](AutoCompleteState& state) {
+            if (state.inComment || state.inString) {
+                state.suggestions.clear();
+
+            } else {
+                identifierTrie.findSuggestions(state.suggestions, state.searchTerm);
+            }
+        };
+
+        autocomplete.setConfig(&config);
+        colorizer.setIdentifierIndex(&identifierTrie);
+        updateLanguageIdentifiers();
+        harvestAllIdentifiers();
+
+    } else {
+        autocomplete.setConfig(nullptr);
+        colorizer.setIdentifierIndex(nullptr);
+        releaseAllIdentifiers();
+    }
+}
+
+
+//
+//	TextEditor::ClearAutoCompleteWords
+//
+
+void TextEditor::ClearAutoCompleteWords() {
+    // drop all words and references, then re-harvest what is still needed
+    identifierTrie.clear();
+    languageIdentifiers.clear();
+    document.getReleasedIdentifiers().clear();
+
+    for (auto& line : document) {
+        line.identifiers.clear();
+    }
+
+    if (identifierAutoComplete) {
+        updateLanguageIdentifiers();
+        harvestAllIdentifiers();
+    }
+}
+
+
+//
+//	TextEditor::updateLanguageIdentifiers
+//
+
+void TextEditor::updateLanguageIdentifiers() {
+    for (auto word : languageIdentifiers) {
+        identifierTrie.release(word);
+    }
+
+    languageIdentifiers.clear();
+
+    if (language) {
+        for (auto set : {&language->keywords, &language->declarations, &language->identifiers}) {
+            for (auto& word : *set) {
+                languageIdentifiers.push_back(identifierTrie.insert(word));
+            }
+        }
+    }
+}
+
+
+//
+//	TextEditor::harvestAllIdentifiers
+//
+
+void TextEditor::harvestAllIdentifiers() {
+    for (auto& line : document) {
+        colorizer.harvestIdentifiers(line);
+    }
+}
+
+
+//
+//	TextEditor::releaseAllIdentifiers
+//
+
+void TextEditor::releaseAllIdentifiers() {
+    // drop the references held by the document and the language (user supplied words keep theirs)
+    for (auto& line : document) {
+        for (auto word : line.identifiers) {
+            identifierTrie.release(word);
+        }
+
+        line.identifiers.clear();
+    }
+
+    for (auto word : document.getReleasedIdentifiers()) {
+        identifierTrie.release(word);
+    }
+
+    document.getReleasedIdentifiers().clear();
+
+    for (auto word : languageIdentifiers) {
+        identifierTrie.release(word);
+    }
+
+    languageIdentifiers.clear();
+    identifierTrie.compact();
+}
+
+
 //
 //	TextEditor::setAutoCompleteConfig
 //
@@ -4932,27 +5680,213 @@ void TextEditor::Autocomplete::refreshSuggestions() {
 }
 
 
+//
+//	TextEditor::Trie::clear
+//
+
+void TextEditor::Trie::clear() {
+    nodes.clear();
+    nodes.emplace_back(0);
+    words.clear();
+    freeWords.clear();
+    arena.clear();
+    deadWords = 0;
+}
+
+
 //
 //	TextEditor::Trie::insert
 //
 
-void TextEditor::Trie::insert(const std::string_view& word) {
-    auto node = root.get();
+uint32_t TextEditor::Trie::insert(const std::string_view& word) {
+    uint32_t node = 0;
     auto end = word.end();
     auto i = TextEditor::CodePoint::skipBOM(word.begin(), end);
 
     while (i < end) {
         ImWchar codepoint;
         i = TextEditor::CodePoint::read(i, end, &codepoint);
+        auto child = findChild(node, codepoint);
+
+        if (child == none) {
+            // new nodes are prepended to the sibling list
+            child = static_cast<uint32_t>(nodes.size());
+            nodes.emplace_back(codepoint);
+            nodes[child].nextSibling = nodes[node].firstChild;
+            nodes[node].firstChild = child;
+        }
+
+        node = child;
+    }
+
+    // add word to arena (if required) and take a reference
+    if (nodes[node].word == none) {
+        Word entry{static_cast<uint32_t>(arena.size()), static_cast<uint32_t>(word.size()), 0};
+
+        if (freeWords.size()) {
+            nodes[node].word = freeWords.back();
+            freeWords.pop_back();
+            words[nodes[node].word] = entry;
+
+        } else {
+            nodes[node].word = static_cast<uint32_t>(words.size());
+            words.push_back(entry);
+        }
+
+        arena.append(word);
+
+    } else if (words[nodes[node].word].references == 0) {
+        // word was released but not compacted yet
+        deadWords--;
+    }
+
+    auto result = nodes[node].word;
+    words[result].references++;
+    return result;
+}
+
+
+//
+//	TextEditor::Trie::release
+//
+
+void TextEditor::Trie::release(uint32_t word) {
+    // released words become invisible to the search and are removed by the next compaction
+    if (word < words.size() && words[word].references) {
+        if (--words[word].references == 0) {
+            deadWords++;
+
+            if (deadWords >= compactMinDeadWords && deadWords > words.size() - freeWords.size() - deadWords) {
+                compact();
+            }
+        }
+    }
+}
+
+
+//
+//	TextEditor::Trie::insertWords
+//
+
+void TextEditor::Trie::insertWords(const std::string_view& text) {
+    size_t start = 0;
+
+    while (start < text.size()) {
+        auto end = text.find('\n', start);
+
+        if (end == std::string_view::npos) {
+            end = text.size();
+        }
+
+        auto word = text.substr(start, end - start);
+
+        if (word.size() && word.back() == '\r') {
+            word.remove_suffix(1);
+        }
+
+        if (word.size()) {
+            insert(word);
+        }
 
-        if (node->children.find(codepoint) == node->children.end()) {
-            node->children[codepoint] = std::make_unique<Node>();
+        start = end + 1;
+    }
+}
+
+
+//
+//	TextEditor::Trie::compact
+//
+
+void TextEditor::Trie::compact() {
+    // detach released words from their nodes, their identifiers are reused by later inserts
+    for (auto& node : nodes) {
+        if (node.word != none && words[node.word].references == 0) {
+            words[node.word] = Word{0, 0, 0};
+            freeWords.push_back(node.word);
+            node.word = none;
         }
+    }
+
+    deadWords = 0;
+
+    // list nodes in breadth first order, children always come after their parent
+    std::vector<uint32_t> order;
+    std::vector<uint32_t> parent;
+    order.reserve(nodes.size());
+    parent.reserve(nodes.size());
+    order.push_back(0);
+    parent.push_back(none);
 
-        node = node->children[codepoint].get();
+    for (size_t i = 0; i < order.size(); i++) {
+        for (auto child = nodes[order[i]].firstChild; child != none; child = nodes[child].nextSibling) {
+            order.push_back(child);
+            parent.push_back(static_cast<uint32_t>(i));
+        }
     }
 
-    node->word = word;
+    // a node is kept if it ends a word or has a kept descendant (walking backwards visits children first)
+    std::vector<bool> keep(order.size(), false);
+    keep[0] = true;
+
+    for (size_t i = order.size() - 1; i > 0; i--) {
+        if (nodes[order[i]].word != none) {
+            keep[i] = true;
+        }
+
+        if (keep[i]) {
+            keep[parent[i]] = true;
+        }
+    }
+
+    // renumber kept nodes so all children of a node are stored next to each other
+    std::vector<uint32_t> remap(nodes.size(), none);
+    uint32_t count = 0;
+
+    for (size_t i = 0; i < order.size(); i++) {
+        if (keep[i]) {
+            remap[order[i]] = count++;
+        }
+    }
+
+    std::vector<Node> compacted;
+    compacted.reserve(count);
+
+    for (size_t i = 0; i < order.size(); i++) {
+        if (!keep[i]) {
+            continue;
+        }
+
+        auto& node = compacted.emplace_back(nodes[order[i]]);
+        auto child = node.firstChild;
+        auto sibling = node.nextSibling;
+
+        while (child != none && remap[child] == none) {
+            child = nodes[child].nextSibling;
+        }
+
+        while (sibling != none && remap[sibling] == none) {
+            sibling = nodes[sibling].nextSibling;
+        }
+
+        node.firstChild = child == none ? none : remap[child];
+        node.nextSibling = sibling == none ? none : remap[sibling];
+    }
+
+    nodes.swap(compacted);
+
+    // rebuild the arena with the remaining words only
+    std::string rebuilt;
+    rebuilt.reserve(arena.size());
+
+    for (auto& word : words) {
+        if (word.references) {
+            auto offset = static_cast<uint32_t>(rebuilt.size());
+            rebuilt.append(arena, word.offset, word.length);
+            word.offset = offset;
+        }
+    }
+
+    arena.swap(rebuilt);
 }
 
 
@@ -4961,12 +5895,19 @@ void TextEditor::Trie::insert(const std::string_view& word) {
 //
 
 void TextEditor::Trie::findSuggestions(std::vector<std::string>& suggestions, const std::string_view& searchTerm, size_t limit, size_t maxSkippedLetters) {
+    std::vector<std::string_view> views;
+    findSuggestions(views, searchTerm, limit, maxSkippedLetters);
+    suggestions.assign(views.begin(), views.end());
+}
+
+void TextEditor::Trie::findSuggestions(std::vector<std::string_view>& suggestions, const std::string_view& searchTerm, size_t limit, size_t maxSkippedLetters) {
     // clear result vector
     maxSkip = maxSkippedLetters;
+    candidateLimit = limit;
     suggestions.clear();
 
     // don't even try if search term is empty
-    if (searchTerm.size() != 0) {
+    if (searchTerm.size() != 0 && limit != 0) {
         // convert search term into vector of code blocks
         searchCodepoints.clear();
         auto end = searchTerm.end();
@@ -4980,76 +5921,123 @@ void TextEditor::Trie::findSuggestions(std::vector<std::string>& suggestions, co
 
         // recursively evaluate nodes
         candidates.clear();
-        evaluateNode(root.get(), 0, 0, maxSkip);
+        evaluateNode(0, 0, 0, maxSkip);
 
-        // did we find anything?
-        if (candidates.size()) {
-            // sort candidates by cost
-            std::sort(candidates.begin(), candidates.end());
+        // the heap only holds the best candidates, so sorting it yields the suggestions in order of relevance
+        std::sort_heap(candidates.begin(), candidates.end(), [this](const Candidate& a, const Candidate& b) {
+            return isCandidateWorse(b, a);
+        });
 
-            // remove duplicates which are caused by mutiple paths based on skips
-            auto last = std::unique(candidates.begin(), candidates.end());
-            candidates.erase(last, candidates.end());
+        for (auto& candidate : candidates) {
+            suggestions.emplace_back(getWord(candidate.word));
+        }
+    }
+}
 
-            // populate suggestions (applying limit)
-            auto size = std::min(static_cast<size_t>(limit), candidates.size());
 
-            for (size_t j = 0; j < size; j++) {
-                suggestions.emplace_back(candidates[j].node->word);
-            }
+//
+//	TextEditor::Trie::findChild
+//
+
+uint32_t TextEditor::Trie::findChild(uint32_t node, ImWchar codepoint) const {
+    for (auto child = nodes[node].firstChild; child != none; child = nodes[child].nextSibling) {
+        if (nodes[child].codepoint == codepoint) {
+            return child;
         }
     }
+
+    return none;
 }
 
 
 //
-//	TextEditor::Trie::evaluateNode
+//	TextEditor::Trie::isCandidateWorse
 //
 
-void TextEditor::Trie::evaluateNode(const Node* node, size_t index, size_t cost, size_t skip) {
-    // see if that is one of our children (check both lower and uppercase matches)
-    ImWchar codepointLower = TextEditor::CodePoint::toLower(searchCodepoints[index]);
-    Node* childLower = nullptr;
+bool TextEditor::Trie::isCandidateWorse(const Candidate& a, const Candidate& b) const {
+    // higher cost is worse, ties are broken alphabetically to get stable results
+    if (a.cost != b.cost) {
+        return a.cost > b.cost;
+    }
 
-    if (node->children.find(codepointLower) != node->children.end()) {
-        // codepoint found, is this the last one in our searchTerm?
-        childLower = node->children.at(codepointLower).get();
+    return getWord(a.word) > getWord(b.word);
+}
 
-        if (index == searchCodepoints.size() - 1) {
-            // yes, add candidate words to results
-            addCandidates(childLower, cost);
 
-        } else {
-            // no, try to find the rest
-            evaluateNode(childLower, index + 1, cost, maxSkip);
+//
+//	TextEditor::Trie::isPruned
+//
+
+bool TextEditor::Trie::isPruned(size_t cost) const {
+    // costs only grow deeper in the tree, so nothing can beat the worst candidate once the heap is full
+    return candidates.size() == candidateLimit && cost > candidates.front().cost;
+}
+
+
+//
+//	TextEditor::Trie::addCandidate
+//
+
+void TextEditor::Trie::addCandidate(uint32_t word, size_t cost) {
+    auto worse = [this](const Candidate& a, const Candidate& b) { return isCandidateWorse(b, a); };
+
+    // multiple paths can lead to the same word (based on skips), only keep the cheapest one
+    for (auto& candidate : candidates) {
+        if (candidate.word == word) {
+            if (cost < candidate.cost) {
+                candidate.cost = cost;
+                std::make_heap(candidates.begin(), candidates.end(), worse);
+            }
+
+            return;
         }
     }
 
-    ImWchar codepointUpper = TextEditor::CodePoint::toUpper(searchCodepoints[index]);
-    Node* childUpper = nullptr;
+    Candidate candidate(word, cost);
 
-    if (node->children.find(codepointUpper) != node->children.end()) {
-        // codepoint found, is this the last one in our searchTerm?
-        childUpper = node->children.at(codepointUpper).get();
+    if (candidates.size() < candidateLimit) {
+        candidates.push_back(candidate);
+        std::push_heap(candidates.begin(), candidates.end(), worse);
 
-        if (index == searchCodepoints.size() - 1) {
-            // yes, add candidate words to results
-            addCandidates(childUpper, cost);
+    } else if (isCandidateWorse(candidates.front(), candidate)) {
+        std::pop_heap(candidates.begin(), candidates.end(), worse);
+        candidates.back() = candidate;
+        std::push_heap(candidates.begin(), candidates.end(), worse);
+    }
+}
 
-        } else {
-            // no, try to find the rest
-            evaluateNode(childUpper, index + 1, cost, maxSkip);
-        }
+
+//
+//	TextEditor::Trie::evaluateNode
+//
+
+void TextEditor::Trie::evaluateNode(uint32_t node, size_t index, size_t cost, size_t skip) {
+    if (isPruned(cost)) {
+        return;
     }
 
-    // also try children to support detection of missing letters (if we haven't skipped too many entries yet)
-    if (skip) {
-        for (auto const& [key, value] : node->children) {
-            auto next = value.get();
+    // see if that is one of our children (check both lower and uppercase matches)
+    auto codepointLower = TextEditor::CodePoint::toLower(searchCodepoints[index]);
+    auto codepointUpper = TextEditor::CodePoint::toUpper(searchCodepoints[index]);
+    auto last = index == searchCodepoints.size() - 1;
+
+    for (auto child = nodes[node].firstChild; child != none; child = nodes[child].nextSibling) {
+        auto codepoint = nodes[child].codepoint;
 
-            if (next != childLower && next != childUpper) {
-                evaluateNode(next, index, cost + 1, skip - 1);
+        if (codepoint == codepointLower || codepoint == codepointUpper) {
+            // codepoint found, is this the last one in our searchTerm?
+            if (last) {
+                // yes, add candidate words to results
+                addCandidates(child, cost);
+
+            } else {
+                // no, try to find the rest
+                evaluateNode(child, index + 1, cost, maxSkip);
             }
+
+        } else if (skip) {
+            // also try children to support detection of missing letters (if we haven't skipped too many entries yet)
+            evaluateNode(child, index, cost + 1, skip - 1);
         }
     }
 }
@@ -5059,13 +6047,19 @@ void TextEditor::Trie::evaluateNode(const Node* node, size_t index, size_t cost,
 //	TextEditor::Trie::addCandidates
 //
 
-void TextEditor::Trie::addCandidates(const Node* node, size_t cost) {
-    if (node->word.size()) {
-        candidates.emplace_back(node, cost);
+void TextEditor::Trie::addCandidates(uint32_t node, size_t cost) {
+    if (isPruned(cost)) {
+        return;
     }
 
-    for (auto const& [key, value] : node->children) {
-        addCandidates(value.get(), cost + 1);
+    auto word = nodes[node].word;
+
+    if (word != none && words[word].references) {
+        addCandidate(word, cost);
+    }
+
+    for (auto child = nodes[node].firstChild; child != none; child = nodes[child].nextSibling) {
+        addCandidates(child, cost + 1);
     }
 }
 
@@ -6171,6 +7165,146 @@ size_t TextEditor::CodePoint::write(char* start, ImWchar codepoint) {
 }
 
 
+//
+//	TextEditor::CodePoint::plainAscii
+//
+
+size_t TextEditor::CodePoint::plainAscii(const char* text, size_t size) {
+    // bytes are treated as signed, so anything with the high bit set fails the > 0x1f test
+    size_t count = 0;
+
+#if defined(IMGUI_EXT_SSE2)
+    auto limit = _mm_set1_epi8(0x1f);
+
+    while (count + 16 <= size) {
+        auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + count));
+
+        if (_mm_movemask_epi8(_mm_cmpgt_epi8(chunk, limit)) != 0xffff) {
+            break;
+        }
+
+        count += 16;
+    }
+
+#elif defined(IMGUI_EXT_NEON)
+    auto limit = vdupq_n_s8(0x1f);
+
+    while (count + 16 <= size) {
+        auto chunk = vld1q_s8(reinterpret_cast<const int8_t*>(text + count));
+
+        if (vminvq_u8(vcgtq_s8(chunk, limit)) != 0xff) {
+            break;
+        }
+
+        count += 16;
+    }
+#endif
+
+    while (count < size && static_cast<signed char>(text[count]) > 0x1f) {
+        count++;
+    }
+
+    return count;
+}
+
+
+//
+//	TextEditor::CodePoint::sequenceLength
+//
+
+size_t TextEditor::CodePoint::sequenceLength(char lead) {
+    auto byte = static_cast<unsigned char>(lead);
+    return (byte & 0xe0) == 0xc0 ? 2 : (byte & 0xf0) == 0xe0 ? 3 : (byte & 0xf8) == 0xf0 ? 4 : 1;
+}
+
+
+//
+//	TextEditor::CodePoint::incompleteTail
+//
+
+size_t TextEditor::CodePoint::incompleteTail(const char* text, size_t size) {
+    // walk back over at most three continuation bytes to the lead byte
+    for (size_t count = 1; count <= std::min(size, size_t(3)); count++) {
+        auto byte = static_cast<unsigned char>(text[size - count]);
+
+        if ((byte & 0xc0) != 0x80) {
+            return sequenceLength(text[size - count]) > count ? count : 0;
+        }
+    }
+
+    return 0;
+}
+
+
+//
+//	TextEditor::CodePoint::readValidated
+//
+
+const char* TextEditor::CodePoint::readValidated(const char* i, const char* end, ImWchar* codepoint, bool* valid) {
+    auto byte = static_cast<unsigned char>(*i);
+    *valid = true;
+
+    if (byte < 0x80) {
+        *codepoint = byte;
+        return i + 1;
+    }
+
+    // determine sequence length, initial bits and the smallest codepoint that requires this length
+    ptrdiff_t length;
+    ImWchar32 result;
+    ImWchar32 minimum;
+
+    if ((byte & 0xe0) == 0xc0) {
+        length = 2;
+        result = byte & 0x1f;
+        minimum = 0x80;
+
+    } else if ((byte & 0xf0) == 0xe0) {
+        length = 3;
+        result = byte & 0x0f;
+        minimum = 0x800;
+
+    } else if ((byte & 0xf8) == 0xf0) {
+        length = 4;
+        result = byte & 0x07;
+        minimum = 0x10000;
+
+    } else {
+        length = 0;
+        result = 0;
+        minimum = 0;
+    }
+
+    if (length && end - i >= length) {
+        for (ptrdiff_t j = 1; j < length; j++) {
+            auto continuation = static_cast<unsigned char>(i[j]);
+
+            if ((continuation & 0xc0) != 0x80) {
+                length = 0;
+                break;
+            }
+
+            result = (result << 6) | (continuation & 0x3f);
+        }
+
+        if (length && result >= minimum && result <= 0x10ffff && (result < 0xd800 || result > 0xdfff)) {
+            #if defined(IMGUI_USE_WCHAR32)
+            *codepoint = static_cast<ImWchar>(result);
+            #else
+            // valid UTF-8 but outside of what ImWchar can represent
+            *codepoint = result > 0xffff ? IM_UNICODE_CODEPOINT_INVALID : static_cast<ImWchar>(result);
+            #endif
+
+            return i + length;
+        }
+    }
+
+    *codepoint = IM_UNICODE_CODEPOINT_INVALID;
+    *valid = false;
+    return i + 1;
+}
+
+
 //
 //	TextEditor::CodePoint::isLetter
 //
@@ -15,6 +15,7 @@
 #include <algorithm>
 #include <array>
 #include <chrono>
+#include <cstdint>
 #include <functional>
 #include <iterator>
 #include <memory>
@@ -54,7 +55,7 @@ public:
     inline bool IsInsertSpacesOnTabs() const { return document.isInsertSpacesOnTabs(); }
     inline void SetLineSpacing(float value) { lineSpacing = std::max(1.0f, std::min(2.0f, value)); }
     inline float GetLineSpacing() const { return lineSpacing; }
-    inline void SetReadOnlyEnabled(bool value) { readOnly = value; }
+    inline void SetReadOnlyEnabled(bool value) { if (appendOnly) readOnlyBeforeAppendOnly = value; else readOnly = value; }
     inline bool IsReadOnlyEnabled() const { return readOnly; }
     inline void SetAutoIndentEnabled(bool value) { autoIndent = value; }
     inline bool IsAutoIndentEnabled() const { return autoIndent; }
@@ -106,6 +107,24 @@ public:
 
     inline void ClearText() { SetText(""); }
 
+    // number of invalid UTF-8 sequences found since text was last set (these are shown as replacement characters)
+    // and the byte offset of the first one in the provided text
+    inline size_t GetInvalidUtf8Count() const { return document.getInvalidSequences(); }
+    inline size_t GetFirstInvalidUtf8Offset() const { return document.getFirstInvalidOffset(); }
+
+    // append-only mode for streaming logs (this implies read-only and disables undo and bracket matching)
+    // the previous read-only setting is restored when append-only mode is disabled again
+    // appended text may end in the middle of a line, the next append continues it
+    // when a maximum line count is set (0 means unlimited), the oldest lines are dropped once it is exceeded
+    // with auto scroll, the view follows new text as long as it was scrolled to the bottom
+    void SetAppendOnlyEnabled(bool value);
+    inline bool IsAppendOnlyEnabled() const { return appendOnly; }
+    inline void SetMaxLineCount(int value) { maxLineCount = std::max(0, value); }
+    inline int GetMaxLineCount() const { return maxLineCount; }
+    inline void SetAutoScrollEnabled(bool value) { autoScroll = value; }
+    inline bool IsAutoScrollEnabled() const { return autoScroll; }
+    inline void AppendText(const std::string_view& text) { if (appendOnly) appendText(text); }
+
     inline bool IsEmpty() const { return document.isEmpty(); }
     inline int GetLineCount() const { return document.lineCount(); }
 
@@ -564,16 +583,24 @@ public:
 
     // utility class to support some autocomplete implementations
     // this is not used by default but can be used in autocomplete callbacks (see example app)
+    // nodes are stored in a flat array (first child/next sibling links) and words in a single string arena
     class Trie {
     public:
         // constructor
         Trie() { clear(); }
 
         // clear word tree
-        inline void clear() { root = std::make_unique<Node>(); }
+        void clear();
+
+        // insert word (UTF-8 encoded) into tree and return its identifier
+        // words are reference counted and remain available until released as often as they were inserted
+        // identifiers of words that are still referenced stay valid, released words are dropped by compact()
+        // which runs automatically once there are many more dead words than live ones
+        uint32_t insert(const std::string_view& word);
+        void release(uint32_t word);
 
-        // insert word (UTF-8 encoded) into tree
-        void insert(const std::string_view& word);
+        // bulk insert newline separated words (UTF-8 encoded), empty lines are ignored
+        void insertWords(const std::string_view& words);
 
         // populate list of suggestions based on provided search term (which is UTF-8 encoded)
         // limit is maximum number of suggestions returned after they are sorted by relevance
@@ -581,15 +608,44 @@ public:
         // this allows for missing letters (out of order letters are not taken into account)
         void findSuggestions(std::vector<std::string>& suggestions, const std::string_view& searchTerm, size_t limit=20, size_t maxSkippedLetters=2);
 
+        // same as above but returns views into the word arena (these are invalidated by the next insert or release)
+        void findSuggestions(std::vector<std::string_view>& suggestions, const std::string_view& searchTerm, size_t limit=20, size_t maxSkippedLetters=2);
+
+        // drop released words and their unused nodes, rebuild the arena and
+        // reorder nodes so siblings are adjacent in memory (worthwhile after bulk loading)
+        void compact();
+
+        // get number of unique words (including released ones that have not been compacted yet)
+        inline size_t size() const { return words.size() - freeWords.size(); }
+
     private:
+        static constexpr uint32_t none = 0xffffffff;
+
+        // automatic compaction starts when dead words reach this count and outnumber live words
+        static constexpr size_t compactMinDeadWords = 256;
+
         // definition of single node in the word graph
         struct Node {
-            std::unordered_map<ImWchar, std::unique_ptr<Node>> children;
-            std::string word;
+            Node(ImWchar cp) : codepoint(cp) {}
+            ImWchar codepoint;
+            uint32_t firstChild = none;
+            uint32_t nextSibling = none;
+            uint32_t word = none;
+        };
+
+        // definition of a word in the arena
+        struct Word {
+            uint32_t offset;
+            uint32_t length;
+            uint32_t references;
         };
 
-        // the root node
-        std::unique_ptr<Node> root;
+        // node 0 is the root node
+        std::vector<Node> nodes;
+        std::vector<Word> words;
+        std::vector<uint32_t> freeWords;
+        std::string arena;
+        size_t deadWords = 0;
 
         // maximum number of letters that can be skipped skip in matching algorithm
         size_t maxSkip;
@@ -597,28 +653,53 @@ public:
         // search term as codepoint vector
         std::vector<ImWchar> searchCodepoints;
 
-        // possible autocomplete candidates
+        // possible autocomplete candidates (kept as a max heap bounded by the suggestion limit)
         struct Candidate {
-            Candidate(const Node* n, size_t c) : node(n), cost(c) {}
-            bool operator<(const Candidate& rhs) const { return cost < rhs.cost; }
-            bool operator==(const Candidate& rhs) const { return node == rhs.node; }
-            const Node* node;
+            Candidate(uint32_t w, size_t c) : word(w), cost(c) {}
+            uint32_t word;
             size_t cost;
         };
 
         std::vector<Candidate> candidates;
+        size_t candidateLimit;
 
         // utility functions
-        void evaluateNode(const Node* node, size_t index, size_t cost, size_t skip);
-        void addCandidates(const Node* node, size_t cost);
+        inline std::string_view getWord(uint32_t word) const { return std::string_view(arena.data() + words[word].offset, words[word].length); }
+        uint32_t findChild(uint32_t node, ImWchar codepoint) const;
+        bool isCandidateWorse(const Candidate& a, const Candidate& b) const;
+        bool isPruned(size_t cost) const;
+        void addCandidate(uint32_t word, size_t cost);
+        void evaluateNode(uint32_t node, size_t index, size_t cost, size_t skip);
+        void addCandidates(uint32_t node, size_t cost);
     };
 
+    // built-in autocomplete that suggests identifiers from the document, the language definition and user supplied words
+    // document identifiers are harvested incrementally from lines as they are recolorized
+    // disabling drops harvested and language words but keeps the ones added through AddAutoCompleteWord(s)
+    void SetIdentifierAutoCompleteEnabled(bool value);
+    inline bool IsIdentifierAutoCompleteEnabled() const { return identifierAutoComplete; }
+    inline void AddAutoCompleteWord(const std::string_view& word) { identifierTrie.insert(word); }
+    inline void AddAutoCompleteWords(const std::string_view& words) { identifierTrie.insertWords(words); identifierTrie.compact(); }
+    void ClearAutoCompleteWords();
+
     // support functions for unicode codepoints
     class CodePoint {
     public:
         static std::string_view::const_iterator skipBOM(std::string_view::const_iterator i, std::string_view::const_iterator end);
         static std::string_view::const_iterator read(std::string_view::const_iterator i, std::string_view::const_iterator end, ImWchar* codepoint);
         static size_t write(char* i, ImWchar codepoint); // must point to buffer of 4 characters (returns number of characters written)
+
+        // bulk conversion support (vectorized where the platform allows it)
+        // plainAscii returns the number of leading characters in the 0x20-0x7f range (so no control characters or multibyte sequences)
+        // readValidated rejects truncated, overlong, surrogate and out of range sequences by setting valid to false
+        // (an invalid sequence produces IM_UNICODE_CODEPOINT_INVALID and only consumes its first byte)
+        static size_t plainAscii(const char* text, size_t size);
+        static const char* readValidated(const char* i, const char* end, ImWchar* codepoint, bool* valid);
+
+        // sequenceLength returns the length announced by a lead byte (1 for ASCII and invalid lead bytes)
+        // incompleteTail returns the size of a multibyte sequence cut off at the end of text (0 if there is none)
+        static size_t sequenceLength(char lead);
+        static size_t incompleteTail(const char* text, size_t size);
         static bool isLetter(ImWchar codepoint);
         static bool isNumber(ImWchar codepoint);
         static bool isWord(ImWchar codepoint);
@@ -886,6 +967,9 @@ protected:
 
         // user data associated with this line
         void* userData = nullptr;
+
+        // identifiers harvested from this line (as references into the identifier trie)
+        std::vector<uint32_t> identifiers;
     };
 
     // the document being edited (Lines of Glyphs)
@@ -906,6 +990,21 @@ protected:
         Coordinate insertText(Coordinate start, const std::string_view& text);
         void deleteText(Coordinate start, Coordinate end);
 
+        // append text at the end of the document and return the first affected line
+        // only the affected lines are processed (the document's maximum column can only grow)
+        // a multibyte sequence split across appends is held back until its remaining bytes arrive
+        int appendText(const std::string_view& text);
+
+        // decode a sequence still held back when appending ends (it is reported as invalid)
+        void flushAppendedText();
+
+        // remove lines from the start of the document (the remaining lines are not flagged for recolorizing)
+        void removeFirstLines(int count);
+
+        // invalid UTF-8 encountered since the last setText
+        inline size_t getInvalidSequences() const { return invalidSequences; }
+        inline size_t getFirstInvalidOffset() const { return firstInvalidOffset; }
+
         // access document text (strings are UTF-8 encoded)
         std::string getText() const;
         std::string getLineText(int line) const;
@@ -964,6 +1063,9 @@ protected:
         // iterate through document to find identifiers
         void iterateIdentifiers(std::function<void(const std::string& identifier)> callback) const;
 
+        // harvested identifiers from deleted lines that still have to be released
+        inline std::vector<uint32_t>& getReleasedIdentifiers() { return releasedIdentifiers; }
+
         // utility functions
         bool isWholeWord(Coordinate start, Coordinate end) const;
         inline bool isEndOfLine(Coordinate from) const { return getIndex(from) == at(from.line).size(); }
@@ -981,8 +1083,16 @@ protected:
 
         std::function<void*(int)> insertor;
         std::function<void(int, void*)> deletor;
-
+        std::vector<uint32_t> releasedIdentifiers;
+        size_t invalidSequences = 0;
+        size_t firstInvalidOffset = 0;
+        size_t decodedBytes = 0;
+        std::string pendingText; // incomplete UTF-8 sequence at the end of the last append
+
+        void decodeText(const std::string_view& text);
+        void updateAppendedLines(int first);
         void appendLine();
+        void releaseLineIdentifiers(Line& line);
         void insertLine(int line);
         void deleteLines(int start, int end);
         void clearDocument();
@@ -1068,10 +1178,21 @@ protected:
         // update colors in changed lines in specified document
         void updateChangedLines(Document& document, const Language* language);
 
+        // update colors in the specified range of lines (used for appended text)
+        void updateLines(Document& document, const Language* language, int first, int last);
+
+        // harvest identifiers into the specified trie whenever a line is recolorized (nullptr disables harvesting)
+        inline void setIdentifierIndex(Trie* trie) { identifierIndex = trie; }
+        void harvestIdentifiers(Line& line);
+
     private:
         // update color in a single line
         State update(Line& line, const Language* language);
 
+        // harvesting context
+        Trie* identifierIndex = nullptr;
+        std::string identifierBuffer;
+
         // see if string matches part of line
         bool matches(Line::iterator start, Line::iterator end, const std::string_view& text);
 
@@ -1168,6 +1289,7 @@ protected:
 
     // access the editor's text
     void setText(const std::string_view& text);
+    void appendText(const std::string_view& text);
 
     // render (parts of) the text editor
     void render(const char* title, const ImVec2& size, bool border);
@@ -1295,6 +1417,10 @@ protected:
     bool showMatchingBrackets = true;
     bool completePairedGlyphs = true;
     bool overwrite = false;
+    bool appendOnly = false;
+    bool readOnlyBeforeAppendOnly = false;
+    int maxLineCount = 0;
+    bool autoScroll = true;
 
     // rendering context
     ImFont* font;
@@ -1321,6 +1447,9 @@ protected:
     Scroll scrollToAlignment = Scroll::alignMiddle;
     bool showMatchingBracketsChanged = false;
     bool languageChanged = false;
+    bool followTail = true;
+    bool scrollToBottom = false;
+    int droppedLines = 0;
 
     float decoratorWidth = 0.0f;
     std::function<void(Decorator&)> decoratorCallback;
@@ -1373,4 +1502,12 @@ protected:
 
     // language support
     const Language* language = nullptr;
+
+    // built-in identifier autocomplete support
+    void updateLanguageIdentifiers();
+    void harvestAllIdentifiers();
+    void releaseAllIdentifiers();
+    bool identifierAutoComplete = false;
+    Trie identifierTrie;
+    std::vector<uint32_t> languageIdentifiers;
 };
@@ -54,6 +54,14 @@ CIMGUI_API void igExtTextEditorSetText(texteditor_t textedit, const char *text)
 	editor->SetText(text);
 }
 
+CIMGUI_API int igExtTextEditorGetInvalidUtf8(texteditor_t textedit, size_t *firstOffset)
+{
+	TextEditor *editor = (TextEditor*)textedit;
+	if (firstOffset)
+		*firstOffset = editor->GetFirstInvalidUtf8Offset();
+	return (int)editor->GetInvalidUtf8Count();
+}
+
 CIMGUI_API int igExtTextEditorGetUndoIndex(texteditor_t textedit)
 {
 	TextEditor *editor = (TextEditor*)textedit;
@@ -74,6 +82,37 @@ CIMGUI_API void igExtTextEditorRender(texteditor_t textedit, const char *id)
 	editor->Render(id, ImVec2(0,0), false);
 }
 
+CIMGUI_API void igExtTextEditorSetAutoComplete(texteditor_t textedit, int enabled)
+{
+	TextEditor *editor = (TextEditor*)textedit;
+	editor->SetIdentifierAutoCompleteEnabled(enabled != 0);
+}
+
+CIMGUI_API void igExtTextEditorAddAutoCompleteWords(texteditor_t textedit, const char *words, size_t size)
+{
+	TextEditor *editor = (TextEditor*)textedit;
+	editor->AddAutoCompleteWords(std::string_view(words, size));
+}
+
+CIMGUI_API void igExtTextEditorClearAutoCompleteWords(texteditor_t textedit)
+{
+	TextEditor *editor = (TextEditor*)textedit;
+	editor->ClearAutoCompleteWords();
+}
+
+CIMGUI_API void igExtTextEditorSetAppendOnly(texteditor_t textedit, int enabled, int maxLines)
+{
+	TextEditor *editor = (TextEditor*)textedit;
+	editor->SetAppendOnlyEnabled(enabled != 0);
+	editor->SetMaxLineCount(maxLines);
+}
+
+CIMGUI_API void igExtTextEditorAppendText(texteditor_t textedit, const char *text, size_t size)
+{
+	TextEditor *editor = (TextEditor*)textedit;
+	editor->AppendText(std::string_view(text, size));
+}
+
 CIMGUI_API void igExtTextEditorFree(texteditor_t textedit)
 {
 	delete ((TextEditor*)textedit);
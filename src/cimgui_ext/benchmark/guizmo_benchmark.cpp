@@ -0,0 +1,318 @@
+// MIT License - Copyright (c) Callum McGing
+// This file is subject to the terms and conditions defined in
+// LICENSE, which is part of this source code package
+
+// Headless ImGuizmo benchmark. Drives igGuizmoManipulate and igGuizmoManipulateBatch
+// with a null renderer and scripted mouse input, and prints the cost of the
+// manipulate call per scenario as JSON. Drag start points are found by probing the
+// gizmo for hover, and the run exits with 2 when a drag scenario never grabbed it.
+//
+//   guizmo_benchmark [--objects 1,64,1024] [--frames 400]
+
+#include "dcimgui_nodefaultargfunctions.h"
+#include "cimgui_ext.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+static void AssertHandler(const char* expr, const char* file, int line)
+{
+    fprintf(stderr, "Assertion failed: %s (%s:%d)\n", expr, file, line);
+    abort();
+}
+
+// ImGuizmo operation and mode values, see ImGuizmo.h
+static const int OpTranslate = (1 << 0) | (1 << 1) | (1 << 2);
+static const int OpRotate = (1 << 3) | (1 << 4) | (1 << 5) | (1 << 6);
+static const int OpScale = (1 << 7) | (1 << 8) | (1 << 9);
+static const int ModeLocal = 0;
+static const int PivotCentroid = 0;
+
+static const float DisplayWidth = 1920.0f, DisplayHeight = 1080.0f;
+
+// Row-vector matrices, same layout as System.Numerics.Matrix4x4
+struct Mat4 { float m[16]; };
+
+static Mat4 Identity()
+{
+    Mat4 r = {};
+    r.m[0] = r.m[5] = r.m[10] = r.m[15] = 1.0f;
+    return r;
+}
+
+static Mat4 LookAtFromZ(float distance)
+{
+    // Camera on +Z looking at the origin
+    Mat4 r = Identity();
+    r.m[14] = -distance;
+    return r;
+}
+
+static Mat4 Perspective(float fovY, float aspect, float zNear, float zFar)
+{
+    Mat4 r = {};
+    float y = 1.0f / tanf(fovY * 0.5f);
+    r.m[0] = y / aspect;
+    r.m[5] = y;
+    r.m[10] = zFar / (zNear - zFar);
+    r.m[11] = -1.0f;
+    r.m[14] = zNear * zFar / (zNear - zFar);
+    return r;
+}
+
+// Scripted input. Every scenario is a 40 frame cycle that presses on a gizmo part,
+// drags away and back, then releases, so the matrices end close to where they started.
+enum Scenario { Scenario_Idle, Scenario_Hover, Scenario_Translate, Scenario_Rotate, Scenario_Scale, Scenario_Count };
+static const char* ScenarioNames[] = { "idle", "hover", "translate", "rotate", "scale" };
+static const int ScenarioOperations[] = { OpTranslate | OpRotate, OpTranslate | OpRotate, OpTranslate, OpRotate, OpScale };
+static const int CycleFrames = 40;
+
+static ImVec2 mouse;
+static void MoveMouse(ImGuiIO* io, float x, float y)
+{
+    mouse = ImVec2{ x, y };
+    ImGuiIO_AddMousePosEvent(io, x, y);
+}
+
+// The gizmo sits in the middle of the display. Drags start on the gizmo part found along
+// a direction from its center (see CalibrateStart) and move by a fixed step per frame.
+static const float CenterX = DisplayWidth * 0.5f, CenterY = DisplayHeight * 0.5f;
+
+struct ScenarioPath
+{
+    ImVec2 direction; // probed from the center to find the start point, zero for a fixed start
+    ImVec2 start;
+    ImVec2 step;
+};
+
+static ScenarioPath paths[Scenario_Count] = {
+    { { 0, 0 }, { 40.0f, 40.0f }, { 0, 0 } },                        // idle, away from the gizmo
+    { { 0, 0 }, { CenterX + 2.0f, CenterY + 2.0f }, { 0, 0 } },      // hover
+    { { 1.0f, 0 }, { CenterX + 60.0f, CenterY }, { 4.0f, 0 } },      // translate along the X axis
+    { { 0, -1.0f }, { CenterX, CenterY - 115.0f }, { 4.0f, 0 } },    // rotate from the top of the rings
+    { { 1.0f, 0 }, { CenterX + 70.0f, CenterY }, { 2.0f, 0 } },      // scale from the X axis end
+};
+
+// Called inside the frame, queued events are processed by the next NewFrame.
+static void QueueInput(Scenario scenario, int frame, ImGuiIO* io)
+{
+    int stepIndex = frame % CycleFrames;
+    ImVec2 start = paths[scenario].start, step = paths[scenario].step;
+    if (stepIndex == 0)
+        MoveMouse(io, start.x, start.y);
+    else if (scenario == Scenario_Idle || scenario == Scenario_Hover)
+        return;
+    else if (stepIndex == 1)
+        ImGuiIO_AddMouseButtonEvent(io, 0, true);
+    else if (stepIndex < 20)
+        MoveMouse(io, mouse.x + step.x, mouse.y + step.y);
+    else if (stepIndex < 38)
+        MoveMouse(io, mouse.x - step.x, mouse.y - step.y);
+    else if (stepIndex == 38)
+        ImGuiIO_AddMouseButtonEvent(io, 0, false);
+}
+
+// Acknowledges texture requests without uploading anything.
+static void NullRender()
+{
+    ImVector_ImTextureDataPtr& textures = ImGui_GetPlatformIO()->Textures;
+    for (int i = 0; i < textures.Size; i++)
+    {
+        ImTextureData* texture = textures.Data[i];
+        if (texture->Status == ImTextureStatus_WantCreate || texture->Status == ImTextureStatus_WantUpdates)
+        {
+            ImTextureData_SetTexID(texture, (ImTextureID)(intptr_t)(i + 1));
+            ImTextureData_SetStatus(texture, ImTextureStatus_OK);
+        }
+        else if (texture->Status == ImTextureStatus_WantDestroy && texture->UnusedFrames > 0)
+        {
+            ImTextureData_SetTexID(texture, 0);
+            ImTextureData_SetStatus(texture, ImTextureStatus_Destroyed);
+        }
+    }
+}
+
+typedef std::chrono::steady_clock Clock;
+
+static double Microseconds(Clock::time_point a, Clock::time_point b)
+{
+    return std::chrono::duration<double, std::micro>(b - a).count();
+}
+
+struct FrameSample
+{
+    double manipulate; // microseconds
+    double frame;
+    bool used;
+};
+
+// objects == 0 measures the single matrix igGuizmoManipulate call
+static FrameSample RunFrame(Mat4& view, Mat4& projection, std::vector<Mat4>& matrices, int objects, Scenario scenario, int frame)
+{
+    FrameSample sample;
+    ImGuiIO* io = ImGui_GetIO();
+    auto t0 = Clock::now();
+    ImGui_NewFrame();
+    igGuizmoBeginFrame();
+    igGuizmoSetRect(0, 0, io->DisplaySize.x, io->DisplaySize.y);
+    Mat4 delta;
+    auto t1 = Clock::now();
+    if (objects == 0)
+        igGuizmoManipulate(view.m, projection.m, ScenarioOperations[scenario], ModeLocal, matrices[0].m, delta.m);
+    else
+        igGuizmoManipulateBatch(view.m, projection.m, ScenarioOperations[scenario], ModeLocal, PivotCentroid, matrices[0].m, objects, 0, delta.m);
+    auto t2 = Clock::now();
+    sample.used = igGuizmoIsUsing() != 0;
+    QueueInput(scenario, frame, io);
+    ImGui_Render();
+    NullRender();
+    auto t3 = Clock::now();
+    sample.manipulate = Microseconds(t1, t2);
+    sample.frame = Microseconds(t0, t3);
+    return sample;
+}
+
+// Hover probe along the scenario direction. Each frame reads the hover state for the mouse
+// position queued by the previous frame. The start point is just inside the farthest
+// hovered position, which is the axis end for translate and scale and the outer ring for
+// rotate. Returns false (keeping the default start) if nothing along the path hovers.
+static const float ProbeMin = 8.0f, ProbeMax = 240.0f, ProbeStep = 2.0f, ProbeInset = 4.0f;
+
+static bool CalibrateStart(Mat4& view, Mat4& projection, std::vector<Mat4>& matrices, int objects, Scenario scenario)
+{
+    ScenarioPath& path = paths[scenario];
+    if (path.direction.x == 0 && path.direction.y == 0)
+        return true;
+    ImGuiIO* io = ImGui_GetIO();
+    float farthest = -1.0f;
+    for (float r = ProbeMin; r <= ProbeMax + ProbeStep; r += ProbeStep)
+    {
+        ImGui_NewFrame();
+        igGuizmoBeginFrame();
+        igGuizmoSetRect(0, 0, io->DisplaySize.x, io->DisplaySize.y);
+        Mat4 delta;
+        if (objects == 0)
+            igGuizmoManipulate(view.m, projection.m, ScenarioOperations[scenario], ModeLocal, matrices[0].m, delta.m);
+        else
+            igGuizmoManipulateBatch(view.m, projection.m, ScenarioOperations[scenario], ModeLocal, PivotCentroid, matrices[0].m, objects, 0, delta.m);
+        if (r > ProbeMin && igGuizmoIsOver())
+            farthest = r - ProbeStep;
+        if (r <= ProbeMax)
+            MoveMouse(io, CenterX + path.direction.x * r, CenterY + path.direction.y * r);
+        ImGui_Render();
+        NullRender();
+    }
+    if (farthest < 0)
+        return false;
+    float r = std::max(ProbeMin, farthest - ProbeInset);
+    path.start = ImVec2{ CenterX + path.direction.x * r, CenterY + path.direction.y * r };
+    return true;
+}
+
+// Set when a drag scenario never grabbed the gizmo, main() then fails the run
+static bool missedDrag = false;
+
+static void PrintStats(const char* name, std::vector<double> values)
+{
+    double sum = 0;
+    for (double v : values)
+        sum += v;
+    std::sort(values.begin(), values.end());
+    auto percentile = [&](double p) { return values[std::min(values.size() - 1, (size_t)(p * values.size()))]; };
+    printf("\"%s\": { \"mean_us\": %.2f, \"p50_us\": %.2f, \"p95_us\": %.2f, \"max_us\": %.2f }",
+           name, sum / values.size(), percentile(0.5), percentile(0.95), values.back());
+}
+
+static void RunObjects(int objects, int frames, bool first)
+{
+    Mat4 view = LookAtFromZ(10.0f);
+    Mat4 projection = Perspective(1.0f, DisplayWidth / DisplayHeight, 0.1f, 1000.0f);
+    // Objects in a small cluster around the origin, so the centroid stays on screen
+    std::vector<Mat4> matrices(std::max(objects, 1), Identity());
+    for (int i = 1; i < (int)matrices.size(); i++)
+    {
+        matrices[i].m[12] = (float)(i % 7 - 3) * 0.1f;
+        matrices[i].m[13] = (float)(i % 5 - 2) * 0.1f;
+        matrices[i].m[14] = (float)(i % 3 - 1) * 0.1f;
+    }
+    printf("%s\n    { \"objects\": %d, \"api\": \"%s\",\n      \"scenarios\": [",
+           first ? "" : ",", std::max(objects, 1), objects ? "batch" : "single");
+    for (int scenario = 0; scenario < Scenario_Count; scenario++)
+    {
+        bool calibrated = CalibrateStart(view, projection, matrices, objects, (Scenario)scenario);
+        // One unmeasured cycle to settle hover state and caches
+        for (int i = 0; i < CycleFrames; i++)
+            RunFrame(view, projection, matrices, objects, (Scenario)scenario, i);
+        std::vector<double> manipulate, frame;
+        int used = 0;
+        for (int i = 0; i < frames; i++)
+        {
+            FrameSample s = RunFrame(view, projection, matrices, objects, (Scenario)scenario, i);
+            manipulate.push_back(s.manipulate);
+            frame.push_back(s.frame);
+            used += s.used ? 1 : 0;
+        }
+        bool drag = scenario >= Scenario_Translate;
+        if (drag && used == 0)
+        {
+            fprintf(stderr, "%d objects: scenario %s never grabbed the gizmo%s\n", std::max(objects, 1),
+                    ScenarioNames[scenario], calibrated ? "" : " (no hover found along its path)");
+            missedDrag = true;
+        }
+        printf("%s\n        { \"name\": \"%s\", \"frames\": %d, \"using_frames\": %d, \"start\": [%.0f, %.0f], ",
+               scenario ? "," : "", ScenarioNames[scenario], frames, used,
+               paths[scenario].start.x - CenterX, paths[scenario].start.y - CenterY);
+        PrintStats("manipulate", manipulate);
+        printf(", ");
+        PrintStats("frame", frame);
+        printf(" }");
+        fflush(stdout);
+    }
+    printf("\n      ] }");
+}
+
+int main(int argc, char** argv)
+{
+    std::vector<int> objectCounts = { 1, 64, 1024 };
+    int frames = 400;
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "--frames") && i + 1 < argc)
+            frames = std::max(1, atoi(argv[++i]));
+        else if (!strcmp(argv[i], "--objects") && i + 1 < argc)
+        {
+            objectCounts.clear();
+            for (char* token = strtok(argv[++i], ","); token; token = strtok(NULL, ","))
+                objectCounts.push_back(std::max(1, atoi(token)));
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [--objects 1,64,1024] [--frames 400]\n", argv[0]);
+            return 1;
+        }
+    }
+    // Whole cycles only, so no scenario ends with a button held
+    frames = (frames + CycleFrames - 1) / CycleFrames * CycleFrames;
+
+    igInstallAssertHandler(AssertHandler);
+    ImGui_CreateContext(NULL);
+    ImGuiIO* io = ImGui_GetIO();
+    io->DisplaySize = ImVec2{ DisplayWidth, DisplayHeight };
+    io->DeltaTime = 1.0f / 60.0f;
+    io->IniFilename = NULL;
+    io->BackendFlags |= ImGuiBackendFlags_RendererHasTextures;
+
+    printf("{ \"frames\": %d, \"runs\": [", frames);
+    // Single matrix call first, then the batch call at each object count
+    RunObjects(0, frames, true);
+    for (int count : objectCounts)
+        RunObjects(count, frames, false);
+    printf("\n] }\n");
+    ImGui_DestroyContext(NULL);
+    return missedDrag ? 2 : 0;
+}
@@ -0,0 +1,239 @@
+// MIT License - Copyright (c) Callum McGing
+// This file is subject to the terms and conditions defined in
+// LICENSE, which is part of this source code package
+
+// Headless ImPlot decimation benchmark. Plots a large line series (noise with isolated
+// spikes) with a null renderer, with and without the ImPlotLineFlags_Decimate and
+// ImPlotLineFlags_DecimateLTTB flags (alone and with ImPlotLineFlags_SortedX), over the full
+// series and zoomed views. Prints the
+// cost of the PlotLine call, the whole frame and the emitted vertex count as JSON.
+//
+//   implot_decimation_benchmark [--points 1000000] [--frames 100]
+
+#include "dcimgui_nodefaultargfunctions.h"
+#include "cimgui_ext.h"
+#include "cimplot.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+static void AssertHandler(const char* expr, const char* file, int line)
+{
+    fprintf(stderr, "Assertion failed: %s (%s:%d)\n", expr, file, line);
+    abort();
+}
+
+static const float DisplayWidth = 1280.0f, DisplayHeight = 720.0f;
+
+// Line modes, all plotting the same series. The sorted modes pass ImPlotLineFlags_SortedX, which
+// skips the per frame scan that otherwise proves the xs are ascending.
+enum Mode { Mode_None, Mode_MinMax, Mode_LTTB, Mode_MinMaxSorted, Mode_LTTBSorted, Mode_Count };
+static const char* ModeNames[] = { "none", "minmax", "lttb", "minmax_sorted", "lttb_sorted" };
+static const ImPlotLineFlags ModeFlags[] = {
+    ImPlotLineFlags_None,
+    ImPlotLineFlags_Decimate,
+    ImPlotLineFlags_DecimateLTTB,
+    ImPlotLineFlags_Decimate | ImPlotLineFlags_SortedX,
+    ImPlotLineFlags_DecimateLTTB | ImPlotLineFlags_SortedX
+};
+
+// Visible x range as a fraction of the series, centered. The narrow view has fewer points
+// than pixels at the default size, so nothing is left to decimate.
+enum View { View_Full, View_Zoomed, View_Narrow, View_Count };
+static const char* ViewNames[] = { "full", "zoomed", "narrow" };
+static const double ViewFractions[] = { 1.0, 0.01, 0.001 };
+
+struct Series
+{
+    std::vector<double> xs;
+    std::vector<double> ys;
+};
+
+static Series BuildSeries(int points)
+{
+    Series series;
+    series.xs.resize(points);
+    series.ys.resize(points);
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<double> noise(-0.25, 0.25);
+    for (int i = 0; i < points; i++)
+    {
+        series.xs[i] = i * 0.001;
+        series.ys[i] = sin(i * 0.0001) + noise(rng);
+        // An isolated spike every so often, the kind of sample decimation must not drop
+        if (i % 9973 == 0)
+            series.ys[i] += (i / 9973) % 2 ? 4.0 : -4.0;
+    }
+    return series;
+}
+
+static ImPlotSpec LineSpec(ImPlotLineFlags flags)
+{
+    // Defaults from the ImPlotSpec constructor
+    const ImVec4 autoColor = { 0, 0, 0, -1 };
+    ImPlotSpec spec;
+    spec.LineColor = autoColor;
+    spec.LineWeight = 1.0f;
+    spec.FillColor = autoColor;
+    spec.FillAlpha = 1.0f;
+    spec.Marker = ImPlotMarker_None;
+    spec.MarkerSize = 4;
+    spec.MarkerLineColor = autoColor;
+    spec.MarkerFillColor = autoColor;
+    spec.Size = 4;
+    spec.Offset = 0;
+    spec.Stride = -1;
+    spec.Flags = flags;
+    return spec;
+}
+
+// Acknowledges texture requests without uploading anything.
+static void NullRender()
+{
+    ImVector_ImTextureDataPtr& textures = ImGui_GetPlatformIO()->Textures;
+    for (int i = 0; i < textures.Size; i++)
+    {
+        ImTextureData* texture = textures.Data[i];
+        if (texture->Status == ImTextureStatus_WantCreate || texture->Status == ImTextureStatus_WantUpdates)
+        {
+            ImTextureData_SetTexID(texture, (ImTextureID)(intptr_t)(i + 1));
+            ImTextureData_SetStatus(texture, ImTextureStatus_OK);
+        }
+        else if (texture->Status == ImTextureStatus_WantDestroy && texture->UnusedFrames > 0)
+        {
+            ImTextureData_SetTexID(texture, 0);
+            ImTextureData_SetStatus(texture, ImTextureStatus_Destroyed);
+        }
+    }
+}
+
+typedef std::chrono::steady_clock Clock;
+
+static double Microseconds(Clock::time_point a, Clock::time_point b)
+{
+    return std::chrono::duration<double, std::micro>(b - a).count();
+}
+
+struct FrameSample
+{
+    double plot; // microseconds
+    double frame;
+    int vertices;
+};
+
+static FrameSample RunFrame(const Series& series, Mode mode, View view)
+{
+    FrameSample sample;
+    ImGuiIO* io = ImGui_GetIO();
+    const int count = (int)series.xs.size();
+    const double center = series.xs[count / 2];
+    const double halfWidth = (series.xs[count - 1] - series.xs[0]) * ViewFractions[view] * 0.5;
+
+    auto t0 = Clock::now();
+    ImGui_NewFrame();
+    ImGui_SetNextWindowPos(ImVec2{ 0, 0 }, 0, ImVec2{ 0, 0 });
+    ImGui_SetNextWindowSize(io->DisplaySize, 0);
+    ImGui_Begin("Benchmark", NULL, ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoBringToFrontOnFocus);
+    double plot = 0;
+    if (ImPlot_BeginPlot("##series", ImVec2{ -1, -1 }, ImPlotFlags_NoLegend))
+    {
+        ImPlot_SetupAxesLimits(center - halfWidth, center + halfWidth, -6.0, 6.0, ImPlotCond_Always);
+        auto t1 = Clock::now();
+        ImPlot_PlotLine_doublePtrdoublePtr("series", series.xs.data(), series.ys.data(), count, LineSpec(ModeFlags[mode]));
+        auto t2 = Clock::now();
+        plot = Microseconds(t1, t2);
+        ImPlot_EndPlot();
+    }
+    ImGui_End();
+    ImGui_Render();
+    NullRender();
+    auto t3 = Clock::now();
+
+    sample.plot = plot;
+    sample.frame = Microseconds(t0, t3);
+    sample.vertices = ImGui_GetDrawData()->TotalVtxCount;
+    return sample;
+}
+
+static void PrintStats(const char* name, std::vector<double> values)
+{
+    double sum = 0;
+    for (double v : values)
+        sum += v;
+    std::sort(values.begin(), values.end());
+    auto percentile = [&](double p) { return values[std::min(values.size() - 1, (size_t)(p * values.size()))]; };
+    printf("\"%s\": { \"mean_us\": %.2f, \"p50_us\": %.2f, \"p95_us\": %.2f, \"max_us\": %.2f }",
+           name, sum / values.size(), percentile(0.5), percentile(0.95), values.back());
+}
+
+static void RunCase(const Series& series, Mode mode, View view, int frames, bool first)
+{
+    // A few unmeasured frames so the plot has its final size and buffers are grown
+    for (int i = 0; i < 3; i++)
+        RunFrame(series, mode, view);
+    std::vector<double> plot, frame;
+    int vertices = 0;
+    for (int i = 0; i < frames; i++)
+    {
+        FrameSample s = RunFrame(series, mode, view);
+        plot.push_back(s.plot);
+        frame.push_back(s.frame);
+        vertices = s.vertices;
+    }
+    printf("%s\n    { \"mode\": \"%s\", \"view\": \"%s\", \"vertices\": %d, ",
+           first ? "" : ",", ModeNames[mode], ViewNames[view], vertices);
+    PrintStats("plot_line", plot);
+    printf(", ");
+    PrintStats("frame", frame);
+    printf(" }");
+    fflush(stdout);
+}
+
+int main(int argc, char** argv)
+{
+    int points = 1000000;
+    int frames = 100;
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "--points") && i + 1 < argc)
+            points = std::max(2, atoi(argv[++i]));
+        else if (!strcmp(argv[i], "--frames") && i + 1 < argc)
+            frames = std::max(1, atoi(argv[++i]));
+        else
+        {
+            fprintf(stderr, "usage: %s [--points 1000000] [--frames 100]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    igInstallAssertHandler(AssertHandler);
+    ImGui_CreateContext(NULL);
+    ImPlotContext* plotContext = ImPlot_CreateContext();
+    ImGuiIO* io = ImGui_GetIO();
+    io->DisplaySize = ImVec2{ DisplayWidth, DisplayHeight };
+    io->DeltaTime = 1.0f / 60.0f;
+    io->IniFilename = NULL;
+    io->BackendFlags |= ImGuiBackendFlags_RendererHasTextures | ImGuiBackendFlags_RendererHasVtxOffset;
+
+    Series series = BuildSeries(points);
+    printf("{ \"points\": %d, \"frames\": %d, \"cases\": [", points, frames);
+    bool first = true;
+    for (int view = 0; view < View_Count; view++)
+    {
+        for (int mode = 0; mode < Mode_Count; mode++)
+        {
+            RunCase(series, (Mode)mode, (View)view, frames, first);
+            first = false;
+        }
+    }
+    printf("\n] }\n");
+    ImPlot_DestroyContext(plotContext);
+    ImGui_DestroyContext(NULL);
+    return 0;
+}
@@ -0,0 +1,672 @@
+// MIT License - Copyright (c) Callum McGing
+// This file is subject to the terms and conditions defined in
+// LICENSE, which is part of this source code package
+
+// Headless node editor benchmark. Builds synthetic graphs through the ax* C API,
+// drives them with a null renderer and synthetic mouse input, and prints
+// per-phase frame timings and allocation counts as JSON. With --lookup it times the
+// node and link queries (FindNode, HasAnyLinks, FindLinksForNode, BreakLinks) instead.
+// Exits with 2 when the scripted input of a scenario never had an effect on the editor.
+//
+//   node_editor_benchmark [--nodes 1000,10000,100000] [--frames 200]
+//   node_editor_benchmark --lookup [--nodes 1000,10000,50000] [--queries 100000]
+
+#include "dcimgui_nodefaultargfunctions.h"
+#include "cimgui_ext.h"
+#include <algorithm>
+#include <atomic>
+#include <cfloat>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+// Allocation counters. Global operator new is interposed for the whole process on
+// ELF platforms, so this includes the library's own std:: containers there.
+static std::atomic<uint64_t> heapAllocs{0};
+static std::atomic<uint64_t> imguiAllocs{0};
+
+void* operator new(size_t size)
+{
+    heapAllocs.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = malloc(size ? size : 1))
+        return ptr;
+    throw std::bad_alloc();
+}
+void* operator new[](size_t size) { return operator new(size); }
+void operator delete(void* ptr) noexcept { free(ptr); }
+void operator delete[](void* ptr) noexcept { free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { free(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { free(ptr); }
+
+static void* CountingAlloc(size_t size, void*)
+{
+    imguiAllocs.fetch_add(1, std::memory_order_relaxed);
+    return malloc(size);
+}
+static void CountingFree(void* ptr, void*) { free(ptr); }
+
+static void AssertHandler(const char* expr, const char* file, int line)
+{
+    fprintf(stderr, "Assertion failed: %s (%s:%d)\n", expr, file, line);
+    abort();
+}
+
+// Synthetic graphs: nodes on a grid, each with one input and one output pin.
+// Links go mostly to nearby nodes, with every 8th one spanning the whole graph.
+static const float NodeOriginX = 200.0f, NodeOriginY = 200.0f;
+static const float NodeStrideX = 200.0f, NodeStrideY = 120.0f;
+static const int   GroupBlock = 4; // nodes per group side, per nesting level
+
+struct GraphConfig
+{
+    int nodes;
+    int linksPerNode;
+    int groupDepth;
+};
+
+struct BenchLink { intptr_t from, to; };
+struct BenchGroup { axVec2 position; axVec2 size; };
+
+struct Graph
+{
+    GraphConfig config;
+    int columns;
+    std::vector<BenchLink> links;
+    std::vector<BenchGroup> groups;
+};
+
+static axNodeId NodeId(intptr_t index) { return (axNodeId)(index + 1); }
+static axPinId InputPin(intptr_t index) { return (axPinId)(2 * index + 1); }
+static axPinId OutputPin(intptr_t index) { return (axPinId)(2 * index + 2); }
+static axLinkId LinkId(intptr_t index) { return (axLinkId)(index + 1); }
+
+static Graph BuildGraph(const GraphConfig& config)
+{
+    Graph graph;
+    graph.config = config;
+    graph.columns = std::max(1, (int)std::ceil(std::sqrt((double)config.nodes)));
+
+    std::mt19937 rng(1234);
+    std::uniform_int_distribution<int> nearby(1, 2 * graph.columns);
+    std::uniform_int_distribution<int> anywhere(0, config.nodes - 1);
+    for (int i = 0; i < config.nodes; i++)
+    {
+        for (int j = 0; j < config.linksPerNode; j++)
+        {
+            int target = (graph.links.size() % 8 == 7) ? anywhere(rng) : i + nearby(rng);
+            if (target >= config.nodes || target == i)
+                continue;
+            graph.links.push_back({ i, target });
+        }
+    }
+
+    int rows = (config.nodes + graph.columns - 1) / graph.columns;
+    int block = GroupBlock;
+    for (int level = 0; level < config.groupDepth; level++, block *= GroupBlock)
+    {
+        float margin = 30.0f + 50.0f * level;
+        for (int r = 0; r < rows; r += block)
+        {
+            for (int c = 0; c < graph.columns; c += block)
+            {
+                int blockColumns = std::min(block, graph.columns - c);
+                int blockRows = std::min(block, rows - r);
+                BenchGroup group;
+                group.position = { NodeOriginX + c * NodeStrideX - margin, NodeOriginY + r * NodeStrideY - margin };
+                group.size = { blockColumns * NodeStrideX - 60.0f + 2 * margin, blockRows * NodeStrideY - 40.0f + 2 * margin };
+                graph.groups.push_back(group);
+            }
+        }
+    }
+    return graph;
+}
+
+static void SubmitGraph(const Graph& graph, bool firstFrame)
+{
+    int nodes = graph.config.nodes;
+    for (size_t i = 0; i < graph.groups.size(); i++)
+    {
+        auto id = NodeId(nodes + (intptr_t)i);
+        axVec2 size = graph.groups[i].size;
+        if (firstFrame)
+        {
+            axVec2 position = graph.groups[i].position;
+            axSetNodePosition(id, &position);
+        }
+        axBeginNode(id);
+        ImGui_TextUnformatted("Group", NULL);
+        axGroup(&size);
+        axEndNode();
+    }
+
+    for (int i = 0; i < nodes; i++)
+    {
+        auto id = NodeId(i);
+        if (firstFrame)
+        {
+            axVec2 position = { NodeOriginX + (i % graph.columns) * NodeStrideX, NodeOriginY + (i / graph.columns) * NodeStrideY };
+            axSetNodePosition(id, &position);
+        }
+        axBeginNode(id);
+        axSetNodeTitle("Node");
+        if (axIsNodeCulled(id))
+        {
+            axSkipNodeContents();
+            axEndNode();
+            continue;
+        }
+        ImGui_TextUnformatted("Node", NULL);
+        axBeginPin(InputPin(i), axPinKind_Input);
+        ImGui_TextUnformatted("-> In", NULL);
+        axEndPin();
+        ImGui_SameLine(0.0f, -1.0f);
+        axBeginPin(OutputPin(i), axPinKind_Output);
+        ImGui_TextUnformatted("Out ->", NULL);
+        axEndPin();
+        axEndNode();
+    }
+
+    axVec4 color = { 1.0f, 1.0f, 1.0f, 1.0f };
+    for (size_t i = 0; i < graph.links.size(); i++)
+        axLink(LinkId((intptr_t)i), OutputPin(graph.links[i].from), InputPin(graph.links[i].to), &color, 1.0f);
+}
+
+// Scripted input. Every scenario is a 40 frame cycle that returns the view and
+// nodes to where they started, so scenarios can run back to back on one graph.
+// Node draw order is only re-sorted when it changes, the last two scenarios cover
+// frames where nothing reorders: a node held down without moving (brought to front
+// once) and an idle graph after the earlier scenarios moved nodes around. Their "end"
+// phase should match the first idle scenario.
+enum Scenario { Scenario_Idle, Scenario_Pan, Scenario_Zoom, Scenario_BoxSelect, Scenario_Drag, Scenario_NewLink, Scenario_Hold, Scenario_IdleAfterEdits, Scenario_Count };
+static const char* ScenarioNames[] = { "idle", "pan", "zoom", "box_select", "drag", "new_link", "hold", "idle_after_edits" };
+static const int CycleFrames = 40;
+
+static ImVec2 ToScreen(float x, float y)
+{
+    axVec2 canvas = { x, y }, screen;
+    axCanvasToScreen(&canvas, &screen);
+    return ImVec2{ screen.x, screen.y };
+}
+
+static ImVec2 mouse;
+
+static void MoveMouse(ImGuiIO* io, float dx, float dy)
+{
+    mouse.x += dx;
+    mouse.y += dy;
+    ImGuiIO_AddMousePosEvent(io, mouse.x, mouse.y);
+}
+
+// Called inside the frame, queued events are processed by the next NewFrame.
+static void QueueInput(Scenario scenario, int frame, ImGuiIO* io)
+{
+    int step = frame % CycleFrames;
+    const float emptyX = 40.0f, emptyY = 40.0f; // outside every node and group
+    switch (scenario)
+    {
+        case Scenario_Pan:
+        case Scenario_Drag:
+        {
+            int button = scenario == Scenario_Pan ? 1 : 0;
+            if (step == 0)
+            {
+                mouse = scenario == Scenario_Pan ? ToScreen(emptyX, emptyY) : ToScreen(NodeOriginX + 12.0f, NodeOriginY + 8.0f);
+                MoveMouse(io, 0, 0);
+            }
+            else if (step == 1)
+                ImGuiIO_AddMouseButtonEvent(io, button, true);
+            else if (step < 20)
+                MoveMouse(io, 4.0f, 3.0f);
+            else if (step < 38)
+                MoveMouse(io, -4.0f, -3.0f);
+            else if (step == 38)
+                ImGuiIO_AddMouseButtonEvent(io, button, false);
+            break;
+        }
+        case Scenario_Zoom:
+            if (step == 0)
+            {
+                mouse = ToScreen(emptyX + 400.0f, emptyY + 300.0f);
+                MoveMouse(io, 0, 0);
+            }
+            else if (step < 39)
+                ImGuiIO_AddMouseWheelEvent(io, 0.0f, (step & 1) ? 1.0f : -1.0f);
+            break;
+        case Scenario_BoxSelect:
+            if (step == 0)
+            {
+                mouse = ToScreen(emptyX, emptyY);
+                MoveMouse(io, 0, 0);
+            }
+            else if (step == 1)
+                ImGuiIO_AddMouseButtonEvent(io, 0, true);
+            else if (step < 32)
+                MoveMouse(io, 20.0f, 12.0f);
+            else if (step == 32)
+                ImGuiIO_AddMouseButtonEvent(io, 0, false);
+            else if (step == 34)
+                axClearSelection();
+            break;
+        case Scenario_NewLink:
+            // Drags a new link out of the first node's input pin into empty space and drops
+            // it there. The editor keeps running its link hit test and visible link query over
+            // the link index while the preview link is drawn.
+            if (step == 0)
+            {
+                mouse = ToScreen(NodeOriginX + 20.0f, NodeOriginY + 31.0f);
+                MoveMouse(io, 0, 0);
+            }
+            else if (step == 1)
+                ImGuiIO_AddMouseButtonEvent(io, 0, true);
+            else if (step < 20)
+                MoveMouse(io, -4.0f, -3.0f);
+            else if (step == 20)
+                ImGuiIO_AddMouseButtonEvent(io, 0, false);
+            break;
+        case Scenario_Hold:
+            // Presses on the first node and keeps it active for the cycle without moving
+            if (step == 0)
+            {
+                mouse = ToScreen(NodeOriginX + 12.0f, NodeOriginY + 8.0f);
+                MoveMouse(io, 0, 0);
+            }
+            else if (step == 1)
+                ImGuiIO_AddMouseButtonEvent(io, 0, true);
+            else if (step == 38)
+                ImGuiIO_AddMouseButtonEvent(io, 0, false);
+            else if (step == 39)
+                axClearSelection();
+            break;
+        default:
+            break;
+    }
+}
+
+// Acknowledges texture requests without uploading anything.
+static void NullRender()
+{
+    ImVector_ImTextureDataPtr& textures = ImGui_GetPlatformIO()->Textures;
+    for (int i = 0; i < textures.Size; i++)
+    {
+        ImTextureData* texture = textures.Data[i];
+        if (texture->Status == ImTextureStatus_WantCreate || texture->Status == ImTextureStatus_WantUpdates)
+        {
+            ImTextureData_SetTexID(texture, (ImTextureID)(intptr_t)(i + 1));
+            ImTextureData_SetStatus(texture, ImTextureStatus_OK);
+        }
+        else if (texture->Status == ImTextureStatus_WantDestroy && texture->UnusedFrames > 0)
+        {
+            ImTextureData_SetTexID(texture, 0);
+            ImTextureData_SetStatus(texture, ImTextureStatus_Destroyed);
+        }
+    }
+}
+
+enum Phase { Phase_NewFrame, Phase_Begin, Phase_Submit, Phase_End, Phase_Render, Phase_Frame, Phase_Count };
+static const char* PhaseNames[] = { "new_frame", "begin", "submit", "end", "render", "frame" };
+
+struct FrameSample
+{
+    double phases[Phase_Count]; // microseconds
+    uint64_t heapAllocs;
+    uint64_t imguiAllocs;
+};
+
+typedef std::chrono::steady_clock Clock;
+
+static double Microseconds(Clock::time_point a, Clock::time_point b)
+{
+    return std::chrono::duration<double, std::micro>(b - a).count();
+}
+
+// Set while lookup mode has links queued by axNodeBreakLinks, rejected again by the next frames
+static bool rejectDeletions = false;
+
+// Set when the new_link scenario saw a link being created, the link itself is never accepted
+static bool creatingLink = false;
+
+static void QueryNewLink()
+{
+    axVec4 color = { 1.0f, 1.0f, 1.0f, 1.0f };
+    if (axBeginCreate(&color, 1.0f))
+    {
+        axPinId start, end;
+        axQueryNewLink(&start, &end);
+        creatingLink = true;
+    }
+    axEndCreate();
+}
+
+static void RejectDeletions()
+{
+    if (axBeginDelete())
+    {
+        axLinkId link;
+        axNodeId node;
+        while (axQueryDeletedLink(&link, NULL, NULL))
+            axRejectDeletedItem();
+        while (axQueryDeletedNode(&node))
+            axRejectDeletedItem();
+    }
+    axEndDelete();
+}
+
+static FrameSample RunFrame(const Graph& graph, bool firstFrame, Scenario scenario, int frame)
+{
+    FrameSample sample;
+    ImGuiIO* io = ImGui_GetIO();
+    uint64_t heapStart = heapAllocs.load(), imguiStart = imguiAllocs.load();
+
+    auto t0 = Clock::now();
+    ImGui_NewFrame();
+    ImGui_SetNextWindowPos(ImVec2{ 0, 0 }, 0, ImVec2{ 0, 0 });
+    ImGui_SetNextWindowSize(io->DisplaySize, 0);
+    ImGui_Begin("Benchmark", NULL, ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoBringToFrontOnFocus);
+    auto t1 = Clock::now();
+    axVec2 size = { 0, 0 };
+    axBegin("Node Editor", &size);
+    auto t2 = Clock::now();
+    SubmitGraph(graph, firstFrame);
+    if (rejectDeletions)
+        RejectDeletions();
+    if (scenario == Scenario_NewLink)
+        QueryNewLink();
+    if (!firstFrame)
+        QueueInput(scenario, frame, io);
+    auto t3 = Clock::now();
+    axEnd();
+    auto t4 = Clock::now();
+    ImGui_End();
+    ImGui_Render();
+    NullRender();
+    auto t5 = Clock::now();
+
+    sample.phases[Phase_NewFrame] = Microseconds(t0, t1);
+    sample.phases[Phase_Begin] = Microseconds(t1, t2);
+    sample.phases[Phase_Submit] = Microseconds(t2, t3);
+    sample.phases[Phase_End] = Microseconds(t3, t4);
+    sample.phases[Phase_Render] = Microseconds(t4, t5);
+    sample.phases[Phase_Frame] = Microseconds(t0, t5);
+    sample.heapAllocs = heapAllocs.load() - heapStart;
+    sample.imguiAllocs = imguiAllocs.load() - imguiStart;
+    return sample;
+}
+
+// Checks that the scripted input reached the editor, so a broken script shows up as
+// zero effective cycles instead of as suspiciously cheap frames.
+struct EffectProbe
+{
+    ImVec2 origin;
+    float zoom;
+    axVec2 node;
+    bool seen;
+};
+
+static bool ProbeEffect(Scenario scenario, int step, EffectProbe& probe)
+{
+    ImVec2 origin = ToScreen(0.0f, 0.0f);
+    float zoom = axGetCurrentZoom();
+    axVec2 node;
+    axGetNodePosition(NodeId(0), &node);
+    if (step == 0)
+    {
+        probe = { origin, zoom, node, false };
+        creatingLink = false;
+        return false;
+    }
+    switch (scenario)
+    {
+        case Scenario_Pan: probe.seen |= origin.x != probe.origin.x || origin.y != probe.origin.y; break;
+        case Scenario_Zoom: probe.seen |= zoom != probe.zoom; break;
+        case Scenario_BoxSelect: probe.seen |= axGetSelectedObjectCount() > 0; break;
+        case Scenario_Drag: probe.seen |= node.x != probe.node.x || node.y != probe.node.y; break;
+        case Scenario_NewLink: probe.seen |= creatingLink; break;
+        case Scenario_Hold: probe.seen |= axIsNodeSelected(NodeId(0)) != 0; break;
+        default: probe.seen = true; break;
+    }
+    return step == CycleFrames - 1 && probe.seen;
+}
+
+// Set when an interactive scenario never had an effect, main() then fails the run
+static bool ineffectiveScenario = false;
+
+static void PrintStats(const std::vector<FrameSample>& samples, int phase)
+{
+    std::vector<double> values;
+    double sum = 0;
+    for (auto& s : samples)
+    {
+        values.push_back(s.phases[phase]);
+        sum += s.phases[phase];
+    }
+    std::sort(values.begin(), values.end());
+    auto percentile = [&](double p) { return values[std::min(values.size() - 1, (size_t)(p * values.size()))]; };
+    printf("\"%s\": { \"mean_us\": %.1f, \"p50_us\": %.1f, \"p95_us\": %.1f, \"max_us\": %.1f }",
+           PhaseNames[phase], sum / values.size(), percentile(0.5), percentile(0.95), values.back());
+}
+
+static void RunGraph(const GraphConfig& config, int frames, bool first)
+{
+    Graph graph = BuildGraph(config);
+
+    axConfig* editorConfig = axConfigNew();
+    axConfig_set_SettingsFile(editorConfig, NULL);
+    axEditorContext* editor = axCreateEditor(editorConfig);
+    axSetCurrentEditor(editor);
+
+    // First frames create nodes, measure their size and build the spatial indices
+    auto setupStart = Clock::now();
+    for (int i = 0; i < 3; i++)
+        RunFrame(graph, i == 0, Scenario_Idle, 0);
+    double setupMs = Microseconds(setupStart, Clock::now()) / 1000.0;
+
+    printf("%s\n    { \"nodes\": %d, \"links\": %d, \"groups\": %d, \"links_per_node\": %d, \"group_depth\": %d, \"setup_ms\": %.1f,\n      \"scenarios\": [",
+           first ? "" : ",", config.nodes, (int)graph.links.size(), (int)graph.groups.size(), config.linksPerNode, config.groupDepth, setupMs);
+
+    for (int scenario = 0; scenario < Scenario_Count; scenario++)
+    {
+        // One unmeasured cycle to settle animations and caches
+        for (int i = 0; i < CycleFrames; i++)
+            RunFrame(graph, false, (Scenario)scenario, i);
+
+        std::vector<FrameSample> samples;
+        samples.reserve(frames);
+        EffectProbe probe = {};
+        int effective = 0;
+        for (int i = 0; i < frames; i++)
+        {
+            samples.push_back(RunFrame(graph, false, (Scenario)scenario, i));
+            effective += ProbeEffect((Scenario)scenario, i % CycleFrames, probe) ? 1 : 0;
+        }
+        if (effective == 0)
+        {
+            fprintf(stderr, "%d nodes: scenario %s had no effect on the editor\n", config.nodes, ScenarioNames[scenario]);
+            ineffectiveScenario = true;
+        }
+
+        double heap = 0, imgui = 0;
+        for (auto& s : samples)
+        {
+            heap += s.heapAllocs;
+            imgui += s.imguiAllocs;
+        }
+
+        printf("%s\n        { \"name\": \"%s\", \"frames\": %d, \"effective_cycles\": %d, \"heap_allocs_per_frame\": %.1f, \"imgui_allocs_per_frame\": %.1f,\n          \"phases\": { ",
+               scenario ? "," : "", ScenarioNames[scenario], frames, effective, heap / frames, imgui / frames);
+        for (int phase = 0; phase < Phase_Count; phase++)
+        {
+            if (phase)
+                printf(",\n                      ");
+            PrintStats(samples, phase);
+        }
+        printf(" } }");
+        fflush(stdout);
+    }
+    printf("\n      ] }");
+
+    axSetCurrentEditor(NULL);
+    axDestroyEditor(editor);
+    axConfigFree(editorConfig);
+}
+
+// Lookup mode. Queries go to random nodes of an idle graph with two links per node.
+// FindNode is reached through axGetNodePosition and FindLinksForNode through axNodeBreakLinks,
+// whose queued deletions are rejected by the frames run between rounds.
+enum Lookup { Lookup_FindNode, Lookup_HasAnyLinks, Lookup_BreakLinks, Lookup_Count };
+static const char* LookupNames[] = { "find_node", "has_any_links", "break_links" };
+static const int LookupRounds = 5;
+
+static void RunLookups(int nodes, int queries, bool first)
+{
+    Graph graph = BuildGraph({ nodes, 2, 0 });
+
+    axConfig* editorConfig = axConfigNew();
+    axConfig_set_SettingsFile(editorConfig, NULL);
+    axEditorContext* editor = axCreateEditor(editorConfig);
+    axSetCurrentEditor(editor);
+    for (int i = 0; i < 3; i++)
+        RunFrame(graph, i == 0, Scenario_Idle, 0);
+
+    std::mt19937 rng(4321);
+    std::uniform_int_distribution<int> anyNode(0, nodes - 1);
+    std::vector<axNodeId> ids(queries);
+    for (auto& id : ids)
+        id = NodeId(anyNode(rng));
+
+    printf("%s\n    { \"nodes\": %d, \"links\": %d, \"queries\": %d,\n      \"lookups\": { ",
+           first ? "" : ",", nodes, (int)graph.links.size(), queries);
+    for (int lookup = 0; lookup < Lookup_Count; lookup++)
+    {
+        std::vector<double> perQuery;
+        long long hits = 0;
+        for (int round = 0; round < LookupRounds; round++)
+        {
+            hits = 0;
+            auto start = Clock::now();
+            switch (lookup)
+            {
+                case Lookup_FindNode:
+                    for (auto id : ids)
+                    {
+                        axVec2 position;
+                        axGetNodePosition(id, &position);
+                        hits += position.x != FLT_MAX;
+                    }
+                    break;
+                case Lookup_HasAnyLinks:
+                    for (auto id : ids)
+                        hits += axNodeHasAnyLinks(id);
+                    break;
+                case Lookup_BreakLinks:
+                    for (auto id : ids)
+                        hits += axNodeBreakLinks(id);
+                    break;
+            }
+            perQuery.push_back(Microseconds(start, Clock::now()) * 1000.0 / queries);
+
+            if (lookup == Lookup_BreakLinks)
+            {
+                // The deletions start at the end of one frame and are rejected in the next
+                rejectDeletions = true;
+                for (int i = 0; i < 2; i++)
+                    RunFrame(graph, false, Scenario_Idle, 0);
+                rejectDeletions = false;
+            }
+        }
+        std::sort(perQuery.begin(), perQuery.end());
+        double sum = 0;
+        for (double v : perQuery)
+            sum += v;
+        printf("%s\"%s\": { \"mean_ns\": %.1f, \"min_ns\": %.1f, \"max_ns\": %.1f, \"results\": %lld }",
+               lookup ? ",\n                   " : "", LookupNames[lookup], sum / perQuery.size(), perQuery.front(), perQuery.back(), hits);
+        fflush(stdout);
+    }
+    printf(" } }");
+
+    axSetCurrentEditor(NULL);
+    axDestroyEditor(editor);
+    axConfigFree(editorConfig);
+}
+
+int main(int argc, char** argv)
+{
+    std::vector<int> nodeCounts;
+    int frames = 200;
+    int queries = 100000;
+    bool lookup = false;
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "--frames") && i + 1 < argc)
+            frames = std::max(1, atoi(argv[++i]));
+        else if (!strcmp(argv[i], "--nodes") && i + 1 < argc)
+        {
+            nodeCounts.clear();
+            for (char* token = strtok(argv[++i], ","); token; token = strtok(NULL, ","))
+                nodeCounts.push_back(std::max(1, atoi(token)));
+        }
+        else if (!strcmp(argv[i], "--lookup"))
+            lookup = true;
+        else if (!strcmp(argv[i], "--queries") && i + 1 < argc)
+            queries = std::max(1, atoi(argv[++i]));
+        else
+        {
+            fprintf(stderr, "usage: %s [--nodes 1000,10000,100000] [--frames 200]\n"
+                            "       %s --lookup [--nodes 1000,10000,50000] [--queries 100000]\n", argv[0], argv[0]);
+            return 1;
+        }
+    }
+    if (nodeCounts.empty())
+        nodeCounts = lookup ? std::vector<int>{ 1000, 10000, 50000 } : std::vector<int>{ 1000, 10000, 100000 };
+
+    // Whole cycles only, so no scenario ends with a button held
+    frames = (frames + CycleFrames - 1) / CycleFrames * CycleFrames;
+
+    igInstallAssertHandler(AssertHandler);
+    ImGui_SetAllocatorFunctions(CountingAlloc, CountingFree, NULL);
+    ImGui_CreateContext(NULL);
+    ImGuiIO* io = ImGui_GetIO();
+    io->DisplaySize = ImVec2{ 1920, 1080 };
+    io->DeltaTime = 1.0f / 60.0f;
+    io->IniFilename = NULL;
+    io->BackendFlags |= ImGuiBackendFlags_RendererHasTextures;
+
+    if (lookup)
+    {
+        printf("{ \"rounds\": %d, \"graphs\": [", LookupRounds);
+        for (size_t i = 0; i < nodeCounts.size(); i++)
+            RunLookups(nodeCounts[i], queries, i == 0);
+        printf("\n] }\n");
+        ImGui_DestroyContext(NULL);
+        return 0;
+    }
+
+    static const GraphConfig shapes[] = {
+        { 0, 0, 0 }, // sparse: no links
+        { 0, 1, 0 }, // chain-like
+        { 0, 4, 0 }, // dense
+        { 0, 1, 2 }, // two levels of nested groups
+    };
+
+    printf("{ \"frames\": %d, \"graphs\": [", frames);
+    bool first = true;
+    for (int count : nodeCounts)
+    {
+        for (auto shape : shapes)
+        {
+            shape.nodes = count;
+            RunGraph(shape, frames, first);
+            first = false;
+        }
+    }
+    printf("\n] }\n");
+
+    ImGui_DestroyContext(NULL);
+    return ineffectiveScenario ? 2 : 0;
+}
@@ -0,0 +1,204 @@
+// MIT License - Copyright (c) Callum McGing
+// This file is subject to the terms and conditions defined in
+// LICENSE, which is part of this source code package
+
+// Text editor UTF-8 benchmark. Loads synthetic documents through igExtTextEditorSetText
+// (decode) and reads them back with igExtTextEditorGetText (encode), and prints the
+// timings and invalid sequence reports per corpus as JSON. Also checks that multibyte
+// characters appended one byte at a time decode cleanly, and exits with 2 if not.
+//
+//   utf8_benchmark [--lines 200000] [--runs 10]
+
+#include "dcimgui_nodefaultargfunctions.h"
+#include "cimgui_ext.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+static void AssertHandler(const char* expr, const char* file, int line)
+{
+    fprintf(stderr, "Assertion failed: %s (%s:%d)\n", expr, file, line);
+    abort();
+}
+
+// Corpora. Every line is built from tokens picked by a fixed seed so runs are comparable.
+enum Corpus { Corpus_Ascii, Corpus_Mixed, Corpus_Invalid, Corpus_Count };
+static const char* CorpusNames[] = { "ascii", "mixed", "invalid" };
+
+static const char* AsciiTokens[] = {
+    "local", "function", "end", "return", "if", "then", "else", "for", "in", "do",
+    "Li01_01_Base", "ship:SetPosition(", "0.5", "1024", "\"dock_ring\"", "--", "=", "==", ",", ")",
+};
+
+// Cyrillic, CJK and emoji (the emoji need 4 byte sequences and surrogate pairs on the C# side)
+static const char* MixedTokens[] = {
+    "\xd0\xa1\xd1\x82\xd0\xb0\xd0\xbd\xd1\x86\xd0\xb8\xd1\x8f",         // Станция
+    "\xd0\x9b\xd0\xb8\xd0\xb1\xd0\xb5\xd1\x80\xd1\x82\xd0\xb8",         // Либерти
+    "\xe6\x98\x9f\xe7\xb3\xbb",                                         // 星系
+    "\xe8\x88\xb9\xe5\x9d\x9e",                                         // 船坞
+    "\xe3\x83\x9f\xe3\x83\x83\xe3\x82\xb7\xe3\x83\xa7\xe3\x83\xb3",     // ミッション
+    "\xf0\x9f\x9a\x80", "\xf0\x9f\x8c\x8c", "\xf0\x9f\x9b\xb0\xef\xb8\x8f",
+    "local", "name", "=", "\"", "--", "1.0",
+};
+
+// Malformed sequences: stray continuation, truncated 2 and 3 byte sequences, overlong,
+// surrogate, out of range lead byte and a code point above U+10FFFF
+static const char* InvalidTokens[] = {
+    "\x80", "\xc3", "\xe6\x98", "\xc0\x80", "\xed\xa0\x80", "\xf5\x80\x80\x80", "\xf4\x90\x80\x80",
+};
+static const int InvalidEvery = 64; // one malformed token per this many tokens
+
+struct Document
+{
+    std::string text;
+    int invalidTokens = 0;
+    size_t firstInvalidOffset = 0;
+};
+
+template<size_t N>
+static const char* Pick(const char* (&tokens)[N], std::mt19937& rng) { return tokens[rng() % N]; }
+
+static Document BuildCorpus(Corpus corpus, int lines)
+{
+    Document doc;
+    std::mt19937 rng(1234);
+    int tokenCount = 0;
+    for (int line = 0; line < lines; line++)
+    {
+        // A little indentation (spaces only, tabs would be expanded by the editor)
+        doc.text.append((rng() % 4) * 4, ' ');
+        int tokens = 3 + rng() % 10;
+        for (int i = 0; i < tokens; i++)
+        {
+            if (i)
+                doc.text.push_back(' ');
+            if (corpus == Corpus_Ascii)
+                doc.text.append(Pick(AsciiTokens, rng));
+            else if (corpus == Corpus_Invalid && ++tokenCount % InvalidEvery == 0)
+            {
+                if (doc.invalidTokens++ == 0)
+                    doc.firstInvalidOffset = doc.text.size();
+                doc.text.append(Pick(InvalidTokens, rng));
+            }
+            else
+                doc.text.append(Pick(MixedTokens, rng));
+        }
+        if (line + 1 < lines)
+            doc.text.push_back('\n');
+    }
+    return doc;
+}
+
+typedef std::chrono::steady_clock Clock;
+
+static double Milliseconds(Clock::time_point a, Clock::time_point b)
+{
+    return std::chrono::duration<double, std::milli>(b - a).count();
+}
+
+static void PrintStats(const char* name, std::vector<double> values, size_t bytes)
+{
+    double sum = 0;
+    for (double v : values)
+        sum += v;
+    std::sort(values.begin(), values.end());
+    auto percentile = [&](double p) { return values[std::min(values.size() - 1, (size_t)(p * values.size()))]; };
+    printf("\"%s\": { \"mean_ms\": %.2f, \"p50_ms\": %.2f, \"p95_ms\": %.2f, \"max_ms\": %.2f, \"p50_mb_s\": %.1f }",
+           name, sum / values.size(), percentile(0.5), percentile(0.95), values.back(),
+           bytes / (1024.0 * 1024.0) / (percentile(0.5) / 1000.0));
+}
+
+static void RunCorpus(Corpus corpus, int lines, int runs)
+{
+    Document doc = BuildCorpus(corpus, lines);
+    texteditor_t editor = igExtTextEditorInit();
+    std::vector<double> decode, encode;
+    int invalid = 0;
+    size_t firstInvalid = 0;
+    bool roundTrip = true;
+    for (int run = 0; run < runs; run++)
+    {
+        auto t0 = Clock::now();
+        igExtTextEditorSetText(editor, doc.text.c_str());
+        auto t1 = Clock::now();
+        const char* text = igExtTextEditorGetText(editor);
+        auto t2 = Clock::now();
+        decode.push_back(Milliseconds(t0, t1));
+        encode.push_back(Milliseconds(t1, t2));
+        invalid = igExtTextEditorGetInvalidUtf8(editor, &firstInvalid);
+        // Valid text must come back unchanged (emoji only survive with 32 bit ImWchar)
+        if (corpus == Corpus_Ascii || (corpus == Corpus_Mixed && sizeof(ImWchar) == 4))
+            roundTrip = roundTrip && doc.text == text;
+        igExtFree((void*)text);
+    }
+    igExtTextEditorFree(editor);
+
+    printf("%s\n    { \"corpus\": \"%s\", \"bytes\": %zu, \"lines\": %d, ",
+           corpus ? "," : "", CorpusNames[corpus], doc.text.size(), lines);
+    PrintStats("decode", decode, doc.text.size());
+    printf(", ");
+    PrintStats("encode", encode, doc.text.size());
+    printf(",\n      \"invalid_tokens\": %d, \"invalid_reported\": %d, \"first_invalid_offset\": %zu, \"expected_first_offset\": %zu",
+           doc.invalidTokens, invalid, invalid ? firstInvalid : 0, doc.firstInvalidOffset);
+    if (corpus != Corpus_Invalid)
+        printf(", \"round_trip\": %s", roundTrip ? "true" : "false");
+    printf(" }");
+    fflush(stdout);
+}
+
+// Log streams split on arbitrary byte counts, so every split point of a multibyte
+// character must decode the same as appending it whole.
+static bool CheckSplitAppend()
+{
+    // é, € and 🚀 (the emoji only survives with 32 bit ImWchar)
+    const char* text = sizeof(ImWchar) == 4 ? "a\xc3\xa9 b\xe2\x82\xac c\xf0\x9f\x9a\x80 d" : "a\xc3\xa9 b\xe2\x82\xac d";
+    texteditor_t editor = igExtTextEditorInit();
+    igExtTextEditorSetAppendOnly(editor, 1, 0);
+    for (const char* i = text; *i; i++)
+        igExtTextEditorAppendText(editor, i, 1);
+    size_t firstInvalid = 0;
+    int invalid = igExtTextEditorGetInvalidUtf8(editor, &firstInvalid);
+    const char* result = igExtTextEditorGetText(editor);
+    bool ok = invalid == 0 && !strcmp(result, text);
+    igExtFree((void*)result);
+    igExtTextEditorFree(editor);
+    printf(",\n  \"split_append\": %s", ok ? "true" : "false");
+    return ok;
+}
+
+int main(int argc, char** argv)
+{
+    int lines = 200000;
+    int runs = 10;
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "--lines") && i + 1 < argc)
+            lines = std::max(1, atoi(argv[++i]));
+        else if (!strcmp(argv[i], "--runs") && i + 1 < argc)
+            runs = std::max(1, atoi(argv[++i]));
+        else
+        {
+            fprintf(stderr, "usage: %s [--lines 200000] [--runs 10]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    // Nothing is rendered, the context only backs any ImGui call made while loading text
+    igInstallAssertHandler(AssertHandler);
+    ImGui_CreateContext(NULL);
+
+    printf("{ \"runs\": %d, \"corpora\": [", runs);
+    for (int corpus = 0; corpus < Corpus_Count; corpus++)
+        RunCorpus((Corpus)corpus, lines, runs);
+    printf("\n]");
+    bool splitAppend = CheckSplitAppend();
+    printf(" }\n");
+    ImGui_DestroyContext(NULL);
+    return splitAppend ? 0 : 2;
+}
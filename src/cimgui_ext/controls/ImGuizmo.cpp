@@ -39,6 +39,8 @@
 #define _freea(x)
 #endif
 
+#include "simd_ext.h"
+
 // includes patches for multiview from
 // https://github.com/CedricGuillemet/ImGuizmo/issues/15
 
@@ -77,25 +79,61 @@ namespace IMGUIZMO_NAMESPACE
 
    void FPU_MatrixF_x_MatrixF(const float* a, const float* b, float* r)
    {
-      r[0] = a[0] * b[0] + a[1] * b[4] + a[2] * b[8] + a[3] * b[12];
-      r[1] = a[0] * b[1] + a[1] * b[5] + a[2] * b[9] + a[3] * b[13];
-      r[2] = a[0] * b[2] + a[1] * b[6] + a[2] * b[10] + a[3] * b[14];
-      r[3] = a[0] * b[3] + a[1] * b[7] + a[2] * b[11] + a[3] * b[15];
-
-      r[4] = a[4] * b[0] + a[5] * b[4] + a[6] * b[8] + a[7] * b[12];
-      r[5] = a[4] * b[1] + a[5] * b[5] + a[6] * b[9] + a[7] * b[13];
-      r[6] = a[4] * b[2] + a[5] * b[6] + a[6] * b[10] + a[7] * b[14];
-      r[7] = a[4] * b[3] + a[5] * b[7] + a[6] * b[11] + a[7] * b[15];
-
-      r[8] = a[8] * b[0] + a[9] * b[4] + a[10] * b[8] + a[11] * b[12];
-      r[9] = a[8] * b[1] + a[9] * b[5] + a[10] * b[9] + a[11] * b[13];
-      r[10] = a[8] * b[2] + a[9] * b[6] + a[10] * b[10] + a[11] * b[14];
-      r[11] = a[8] * b[3] + a[9] * b[7] + a[10] * b[11] + a[11] * b[15];
+#if defined(IMGUI_EXT_SSE2)
+      const __m128 b0 = _mm_loadu_ps(b), b1 = _mm_loadu_ps(b + 4), b2 = _mm_loadu_ps(b + 8), b3 = _mm_loadu_ps(b + 12);
+      for (int i = 0; i < 16; i += 4)
+      {
+         __m128 row = _mm_mul_ps(_mm_set1_ps(a[i]), b0);
+         row = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(a[i + 1]), b1));
+         row = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(a[i + 2]), b2));
+         row = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(a[i + 3]), b3));
+         _mm_storeu_ps(r + i, row);
+      }
+#elif defined(IMGUI_EXT_NEON)
+      const float32x4_t b0 = vld1q_f32(b), b1 = vld1q_f32(b + 4), b2 = vld1q_f32(b + 8), b3 = vld1q_f32(b + 12);
+      for (int i = 0; i < 16; i += 4)
+      {
+         float32x4_t row = vmulq_n_f32(b0, a[i]);
+         row = vmlaq_n_f32(row, b1, a[i + 1]);
+         row = vmlaq_n_f32(row, b2, a[i + 2]);
+         row = vmlaq_n_f32(row, b3, a[i + 3]);
+         vst1q_f32(r + i, row);
+      }
+#else
+      for (int i = 0; i < 16; i += 4)
+      {
+         const float a0 = a[i], a1 = a[i + 1], a2 = a[i + 2], a3 = a[i + 3];
+         for (int j = 0; j < 4; j++)
+            r[i + j] = a0 * b[j] + a1 * b[4 + j] + a2 * b[8 + j] + a3 * b[12 + j];
+      }
+#endif
+   }
 
-      r[12] = a[12] * b[0] + a[13] * b[4] + a[14] * b[8] + a[15] * b[12];
-      r[13] = a[12] * b[1] + a[13] * b[5] + a[14] * b[9] + a[15] * b[13];
-      r[14] = a[12] * b[2] + a[13] * b[6] + a[14] * b[10] + a[15] * b[14];
-      r[15] = a[12] * b[3] + a[13] * b[7] + a[14] * b[11] + a[15] * b[15];
+   // v * matrix for a row vector, w is 0 for directions and 1 for points
+   static inline void FPU_VectorF_x_MatrixF(float x, float y, float z, float w, const float* m, float* r)
+   {
+#if defined(IMGUI_EXT_SSE2)
+      __m128 res = _mm_mul_ps(_mm_set1_ps(x), _mm_loadu_ps(m));
+      res = _mm_add_ps(res, _mm_mul_ps(_mm_set1_ps(y), _mm_loadu_ps(m + 4)));
+      res = _mm_add_ps(res, _mm_mul_ps(_mm_set1_ps(z), _mm_loadu_ps(m + 8)));
+      res = _mm_add_ps(res, _mm_mul_ps(_mm_set1_ps(w), _mm_loadu_ps(m + 12)));
+      _mm_storeu_ps(r, res);
+#elif defined(IMGUI_EXT_NEON)
+      float32x4_t res = vmulq_n_f32(vld1q_f32(m), x);
+      res = vmlaq_n_f32(res, vld1q_f32(m + 4), y);
+      res = vmlaq_n_f32(res, vld1q_f32(m + 8), z);
+      res = vmlaq_n_f32(res, vld1q_f32(m + 12), w);
+      vst1q_f32(r, res);
+#else
+      const float rx = x * m[0] + y * m[4] + z * m[8] + w * m[12];
+      const float ry = x * m[1] + y * m[5] + z * m[9] + w * m[13];
+      const float rz = x * m[2] + y * m[6] + z * m[10] + w * m[14];
+      const float rw = x * m[3] + y * m[7] + z * m[11] + w * m[15];
+      r[0] = rx;
+      r[1] = ry;
+      r[2] = rz;
+      r[3] = rw;
+#endif
    }
 
    void Frustum(float left, float right, float bottom, float top, float znear, float zfar, float* m16)
@@ -406,17 +444,7 @@ namespace IMGUIZMO_NAMESPACE
 
    void vec_t::Transform(const matrix_t& matrix)
    {
-      vec_t out;
-
-      out.x = x * matrix.m[0][0] + y * matrix.m[1][0] + z * matrix.m[2][0] + w * matrix.m[3][0];
-      out.y = x * matrix.m[0][1] + y * matrix.m[1][1] + z * matrix.m[2][1] + w * matrix.m[3][1];
-      out.z = x * matrix.m[0][2] + y * matrix.m[1][2] + z * matrix.m[2][2] + w * matrix.m[3][2];
-      out.w = x * matrix.m[0][3] + y * matrix.m[1][3] + z * matrix.m[2][3] + w * matrix.m[3][3];
-
-      x = out.x;
-      y = out.y;
-      z = out.z;
-      w = out.w;
+      FPU_VectorF_x_MatrixF(x, y, z, w, matrix.m16, &x);
    }
 
    void vec_t::Transform(const vec_t& s, const matrix_t& matrix)
@@ -427,32 +455,12 @@ namespace IMGUIZMO_NAMESPACE
 
    void vec_t::TransformPoint(const matrix_t& matrix)
    {
-      vec_t out;
-
-      out.x = x * matrix.m[0][0] + y * matrix.m[1][0] + z * matrix.m[2][0] + matrix.m[3][0];
-      out.y = x * matrix.m[0][1] + y * matrix.m[1][1] + z * matrix.m[2][1] + matrix.m[3][1];
-      out.z = x * matrix.m[0][2] + y * matrix.m[1][2] + z * matrix.m[2][2] + matrix.m[3][2];
-      out.w = x * matrix.m[0][3] + y * matrix.m[1][3] + z * matrix.m[2][3] + matrix.m[3][3];
-
-      x = out.x;
-      y = out.y;
-      z = out.z;
-      w = out.w;
+      FPU_VectorF_x_MatrixF(x, y, z, 1.f, matrix.m16, &x);
    }
 
    void vec_t::TransformVector(const matrix_t& matrix)
    {
-      vec_t out;
-
-      out.x = x * matrix.m[0][0] + y * matrix.m[1][0] + z * matrix.m[2][0];
-      out.y = x * matrix.m[0][1] + y * matrix.m[1][1] + z * matrix.m[2][1];
-      out.z = x * matrix.m[0][2] + y * matrix.m[1][2] + z * matrix.m[2][2];
-      out.w = x * matrix.m[0][3] + y * matrix.m[1][3] + z * matrix.m[2][3];
-
-      x = out.x;
-      y = out.y;
-      z = out.z;
-      w = out.w;
+      FPU_VectorF_x_MatrixF(x, y, z, 0.f, matrix.m16, &x);
    }
 
    float matrix_t::Inverse(const matrix_t& srcMatrix, bool affine)
@@ -684,6 +692,14 @@ namespace IMGUIZMO_NAMESPACE
       matrix_t mMVP;
       matrix_t mMVPLocal; // MVP with full model matrix whereas mMVP's model matrix might only be translation in case of World space edition
       matrix_t mViewProjection;
+      matrix_t mViewInverse;
+      matrix_t mViewProjectionInverse;
+
+      // view and projection the products above were built from, they are only
+      // recomputed when the camera changes between Manipulate calls
+      matrix_t mCachedView;
+      matrix_t mCachedProjection;
+      bool mbViewCacheValid = false;
 
       vec_t mModelScaleOrigin;
       vec_t mCameraEye;
@@ -732,6 +748,16 @@ namespace IMGUIZMO_NAMESPACE
       float mAxisLimit=0.0025f;
       float mPlaneLimit=0.02f;
 
+      // tripod axes and visibility, computed once per Manipulate call
+      struct TripodAxis
+      {
+         vec_t dirAxis, dirPlaneX, dirPlaneY;
+         float axisFactor[3];
+         bool belowAxisLimit, belowPlaneLimit;
+      };
+      TripodAxis mTripodCache[2][3]; // [localCoordinates][axis]
+      int mTripodCacheMask = 0;
+
       // bounds stretching
       vec_t mBoundsPivot;
       vec_t mBoundsAnchor;
@@ -795,10 +821,8 @@ namespace IMGUIZMO_NAMESPACE
       return ImGui::ColorConvertFloat4ToU32(gContext.mStyle.Colors[idx]);
    }
 
-   static ImVec2 worldToPos(const vec_t& worldPos, const matrix_t& mat, ImVec2 position = ImVec2(gContext.mX, gContext.mY), ImVec2 size = ImVec2(gContext.mWidth, gContext.mHeight))
+   static ImVec2 clipToPos(vec_t trans, ImVec2 position = ImVec2(gContext.mX, gContext.mY), ImVec2 size = ImVec2(gContext.mWidth, gContext.mHeight))
    {
-      vec_t trans;
-      trans.TransformPoint(worldPos, mat);
       trans *= 0.5f / trans.w;
       trans += makeVect(0.5f, 0.5f);
       trans.y = 1.f - trans.y;
@@ -809,12 +833,16 @@ namespace IMGUIZMO_NAMESPACE
       return ImVec2(trans.x, trans.y);
    }
 
-   static void ComputeCameraRay(vec_t& rayOrigin, vec_t& rayDir, ImVec2 position = ImVec2(gContext.mX, gContext.mY), ImVec2 size = ImVec2(gContext.mWidth, gContext.mHeight))
+   static ImVec2 worldToPos(const vec_t& worldPos, const matrix_t& mat, ImVec2 position = ImVec2(gContext.mX, gContext.mY), ImVec2 size = ImVec2(gContext.mWidth, gContext.mHeight))
    {
-      ImGuiIO& io = ImGui::GetIO();
+      vec_t trans;
+      trans.TransformPoint(worldPos, mat);
+      return clipToPos(trans, position, size);
+   }
 
-      matrix_t mViewProjInverse;
-      mViewProjInverse.Inverse(gContext.mViewMat * gContext.mProjectionMat);
+   static void ComputeCameraRay(const matrix_t& mViewProjInverse, vec_t& rayOrigin, vec_t& rayDir, ImVec2 position = ImVec2(gContext.mX, gContext.mY), ImVec2 size = ImVec2(gContext.mWidth, gContext.mHeight))
+   {
+      ImGuiIO& io = ImGui::GetIO();
 
       const float mox = ((io.MousePos.x - position.x) / size.x) * 2.f - 1.f;
       const float moy = (1.f - ((io.MousePos.y - position.y) / size.y)) * 2.f - 1.f;
@@ -1040,6 +1068,31 @@ namespace IMGUIZMO_NAMESPACE
       gContext.mViewMat = *(matrix_t*)view;
       gContext.mProjectionMat = *(matrix_t*)projection;
       gContext.mbMouseOver = IsHoveringWindow();
+      gContext.mTripodCacheMask = 0;
+
+      if (!gContext.mbViewCacheValid ||
+         memcmp(gContext.mCachedView.m16, view, sizeof(matrix_t)) != 0 ||
+         memcmp(gContext.mCachedProjection.m16, projection, sizeof(matrix_t)) != 0)
+      {
+         gContext.mCachedView = gContext.mViewMat;
+         gContext.mCachedProjection = gContext.mProjectionMat;
+         gContext.mbViewCacheValid = true;
+
+         gContext.mViewProjection = gContext.mViewMat * gContext.mProjectionMat;
+         gContext.mViewProjectionInverse.Inverse(gContext.mViewProjection);
+         gContext.mViewInverse.Inverse(gContext.mViewMat);
+         gContext.mCameraDir = gContext.mViewInverse.v.dir;
+         gContext.mCameraEye = gContext.mViewInverse.v.position;
+         gContext.mCameraRight = gContext.mViewInverse.v.right;
+         gContext.mCameraUp = gContext.mViewInverse.v.up;
+
+         // projection reverse
+         vec_t nearPos, farPos;
+         nearPos.Transform(makeVect(0, 0, 1.f, 1.f), gContext.mProjectionMat);
+         farPos.Transform(makeVect(0, 0, 2.f, 1.f), gContext.mProjectionMat);
+
+         gContext.mReversed = (nearPos.z/nearPos.w) > (farPos.z / farPos.w);
+      }
 
       gContext.mModelLocal = *(matrix_t*)matrix;
       gContext.mModelLocal.OrthoNormalize();
@@ -1057,30 +1110,11 @@ namespace IMGUIZMO_NAMESPACE
 
       gContext.mModelInverse.Inverse(gContext.mModel);
       gContext.mModelSourceInverse.Inverse(gContext.mModelSource);
-      gContext.mViewProjection = gContext.mViewMat * gContext.mProjectionMat;
       gContext.mMVP = gContext.mModel * gContext.mViewProjection;
       gContext.mMVPLocal = gContext.mModelLocal * gContext.mViewProjection;
 
-      matrix_t viewInverse;
-      viewInverse.Inverse(gContext.mViewMat);
-      gContext.mCameraDir = viewInverse.v.dir;
-      gContext.mCameraEye = viewInverse.v.position;
-      gContext.mCameraRight = viewInverse.v.right;
-      gContext.mCameraUp = viewInverse.v.up;
-
-      // projection reverse
-       vec_t nearPos, farPos;
-       nearPos.Transform(makeVect(0, 0, 1.f, 1.f), gContext.mProjectionMat);
-       farPos.Transform(makeVect(0, 0, 2.f, 1.f), gContext.mProjectionMat);
-
-       gContext.mReversed = (nearPos.z/nearPos.w) > (farPos.z / farPos.w);
-
       // compute scale from the size of camera right vector projected on screen at the matrix position
-      vec_t pointRight = viewInverse.v.right;
-      pointRight.TransformPoint(gContext.mViewProjection);
-      gContext.mScreenFactor = gContext.mGizmoSizeClipSpace / (pointRight.x / pointRight.w - gContext.mMVP.v.position.x / gContext.mMVP.v.position.w);
-
-      vec_t rightViewInverse = viewInverse.v.right;
+      vec_t rightViewInverse = gContext.mViewInverse.v.right;
       rightViewInverse.TransformVector(gContext.mModelInverse);
       float rightLength = GetSegmentLengthClipSpace(makeVect(0.f, 0.f), rightViewInverse);
       gContext.mScreenFactor = gContext.mGizmoSizeClipSpace / rightLength;
@@ -1090,7 +1124,7 @@ namespace IMGUIZMO_NAMESPACE
       gContext.mScreenSquareMin = ImVec2(centerSSpace.x - 10.f, centerSSpace.y - 10.f);
       gContext.mScreenSquareMax = ImVec2(centerSSpace.x + 10.f, centerSSpace.y + 10.f);
 
-      ComputeCameraRay(gContext.mRayOrigin, gContext.mRayVector);
+      ComputeCameraRay(gContext.mViewProjectionInverse, gContext.mRayOrigin, gContext.mRayVector);
    }
 
    static void ComputeColors(ImU32* colors, int type, OPERATION operation)
@@ -1156,6 +1190,21 @@ namespace IMGUIZMO_NAMESPACE
          dirPlaneX *= gContext.mAxisFactor[(axisIndex + 1) % 3];
          dirPlaneY *= gContext.mAxisFactor[(axisIndex + 2) % 3];
       }
+      else if (gContext.mTripodCacheMask & (1 << (axisIndex + (localCoordinates ? 3 : 0))))
+      {
+         const Context::TripodAxis& cached = gContext.mTripodCache[localCoordinates ? 1 : 0][axisIndex];
+         dirAxis = cached.dirAxis;
+         dirPlaneX = cached.dirPlaneX;
+         dirPlaneY = cached.dirPlaneY;
+         belowAxisLimit = cached.belowAxisLimit;
+         belowPlaneLimit = cached.belowPlaneLimit;
+
+         gContext.mAxisFactor[axisIndex] = cached.axisFactor[0];
+         gContext.mAxisFactor[(axisIndex + 1) % 3] = cached.axisFactor[1];
+         gContext.mAxisFactor[(axisIndex + 2) % 3] = cached.axisFactor[2];
+         gContext.mBelowAxisLimit[axisIndex] = belowAxisLimit;
+         gContext.mBelowPlaneLimit[axisIndex] = belowPlaneLimit;
+      }
       else
       {
          // new method
@@ -1190,6 +1239,17 @@ namespace IMGUIZMO_NAMESPACE
          gContext.mAxisFactor[(axisIndex + 2) % 3] = mulAxisY;
          gContext.mBelowAxisLimit[axisIndex] = belowAxisLimit;
          gContext.mBelowPlaneLimit[axisIndex] = belowPlaneLimit;
+
+         Context::TripodAxis& cached = gContext.mTripodCache[localCoordinates ? 1 : 0][axisIndex];
+         cached.dirAxis = dirAxis;
+         cached.dirPlaneX = dirPlaneX;
+         cached.dirPlaneY = dirPlaneY;
+         cached.axisFactor[0] = mulAxis;
+         cached.axisFactor[1] = mulAxisX;
+         cached.axisFactor[2] = mulAxisY;
+         cached.belowAxisLimit = belowAxisLimit;
+         cached.belowPlaneLimit = belowPlaneLimit;
+         gContext.mTripodCacheMask |= 1 << (axisIndex + (localCoordinates ? 3 : 0));
       }
    }
 
@@ -1248,9 +1308,7 @@ namespace IMGUIZMO_NAMESPACE
       vec_t cameraToModelNormalized;
       if (gContext.mIsOrthographic)
       {
-         matrix_t viewInverse;
-         viewInverse.Inverse(*(matrix_t*)&gContext.mViewMat);
-         cameraToModelNormalized = -viewInverse.v.dir;
+         cameraToModelNormalized = -gContext.mViewInverse.v.dir;
       }
       else
       {
@@ -1262,6 +1320,8 @@ namespace IMGUIZMO_NAMESPACE
       gContext.mRadiusSquareCenter = screenRotateSize * gContext.mHeight;
 
       bool hasRSC = Intersects(op, ROTATE_SCREEN);
+      const ImVec2 centerPos = worldToPos(gContext.mModel.v.position, gContext.mViewProjection);
+      ImVec2 ringPos[2 * halfCircleSegmentCount + 1];
       for (int axis = 0; axis < 3; axis++)
       {
          if(!Intersects(op, static_cast<OPERATION>(ROTATE_Z >> axis)))
@@ -1271,23 +1331,29 @@ namespace IMGUIZMO_NAMESPACE
          const bool usingAxis = (gContext.mbUsing && type == MT_ROTATE_Z - axis);
          const int circleMul = (hasRSC && !usingAxis ) ? 1 : 2;
 
-         ImVec2* circlePos = (ImVec2*)alloca(sizeof(ImVec2) * (circleMul * halfCircleSegmentCount + 1));
-
          float angleStart = atan2f(cameraToModelNormalized[(4 - axis) % 3], cameraToModelNormalized[(3 - axis) % 3]) + ZPI * 0.5f;
 
+         // The ring is cos * u + sin * v in model space, so its clip space points are the same
+         // combination of two MVP rows. Angles advance by a fixed step through a rotation.
+         const float radius = gContext.mScreenFactor * rotationDisplayFactor;
+         const vec_t clipU = gContext.mMVP.component[(3 - axis) % 3] * radius;
+         const vec_t clipV = gContext.mMVP.component[(4 - axis) % 3] * radius;
+         const float stepCos = cosf(ZPI / (float)halfCircleSegmentCount);
+         const float stepSin = sinf(ZPI / (float)halfCircleSegmentCount);
+         float c = cosf(angleStart), s = sinf(angleStart);
          for (int i = 0; i < circleMul * halfCircleSegmentCount + 1; i++)
          {
-            float ng = angleStart + (float)circleMul * ZPI * ((float)i / (float)(circleMul * halfCircleSegmentCount));
-            vec_t axisPos = makeVect(cosf(ng), sinf(ng), 0.f);
-            vec_t pos = makeVect(axisPos[axis], axisPos[(axis + 1) % 3], axisPos[(axis + 2) % 3]) * gContext.mScreenFactor * rotationDisplayFactor;
-            circlePos[i] = worldToPos(pos, gContext.mMVP);
+            ringPos[i] = clipToPos(gContext.mMVP.v.position + clipU * c + clipV * s);
+            const float nc = c * stepCos - s * stepSin;
+            s = s * stepCos + c * stepSin;
+            c = nc;
          }
          if (!gContext.mbUsing || usingAxis)
          {
-            drawList->AddPolyline(circlePos, circleMul* halfCircleSegmentCount + 1, colors[3 - axis], false, gContext.mStyle.RotationLineThickness);
+            drawList->AddPolyline(ringPos, circleMul* halfCircleSegmentCount + 1, colors[3 - axis], false, gContext.mStyle.RotationLineThickness);
          }
 
-         float radiusAxis = sqrtf((ImLengthSqr(worldToPos(gContext.mModel.v.position, gContext.mViewProjection) - circlePos[0])));
+         float radiusAxis = sqrtf((ImLengthSqr(centerPos - ringPos[0])));
          if (radiusAxis > gContext.mRadiusSquareCenter)
          {
             gContext.mRadiusSquareCenter = radiusAxis;
@@ -1295,7 +1361,7 @@ namespace IMGUIZMO_NAMESPACE
       }
       if(hasRSC && (!gContext.mbUsing || type == MT_ROTATE_SCREEN))
       {
-         drawList->AddCircle(worldToPos(gContext.mModel.v.position, gContext.mViewProjection), gContext.mRadiusSquareCenter, colors[0], 64, gContext.mStyle.RotationOuterLineThickness);
+         drawList->AddCircle(centerPos, gContext.mRadiusSquareCenter, colors[0], 64, gContext.mStyle.RotationOuterLineThickness);
       }
 
       if (gContext.mbUsing && (gContext.mActualID == -1 || gContext.mActualID == gContext.mEditingID) && IsRotateType(type))
@@ -2818,7 +2884,9 @@ namespace IMGUIZMO_NAMESPACE
       // set context
       gContext.mViewMat = cubeView;
       gContext.mProjectionMat = cubeProjection;
-      ComputeCameraRay(gContext.mRayOrigin, gContext.mRayVector, position, size);
+      matrix_t cubeViewProjInverse;
+      cubeViewProjInverse.Inverse(cubeView * cubeProjection);
+      ComputeCameraRay(cubeViewProjInverse, gContext.mRayOrigin, gContext.mRayVector, position, size);
 
       const matrix_t res = cubeView * cubeProjection;
 
@@ -158,6 +158,10 @@ namespace IMGUIZMO_NAMESPACE
    IMGUI_API void DecomposeMatrixToComponents(const float* matrix, float* translation, float* rotation, float* scale);
    IMGUI_API void RecomposeMatrixFromComponents(const float* translation, const float* rotation, const float* scale, float* matrix);
 
+   // 4x4 matrix product r = a * b in the row-vector convention used by Manipulate.
+   // r may alias a (each row of a is read before it is written) but not b.
+   void FPU_MatrixF_x_MatrixF(const float* a, const float* b, float* r);
+
    IMGUI_API void SetRect(float x, float y, float width, float height);
    // default is false
    IMGUI_API void SetOrthographic(bool isOrthographic);
@@ -42,21 +42,623 @@ static const ImU64          IM_U64_MAX = ULLONG_MAX; // (0xFFFFFFFFFFFFFFFFull);
 static const ImU64          IM_U64_MAX = (2ULL * 9223372036854775807LL + 1);
 #endif
 
+// Expressions typed into the input widgets are compiled once and kept in a small
+// LRU cache keyed by their text, so re-applying the same text (every keystroke
+// while editing, or the same value typed into many fields) evaluates the existing
+// tree without going back through the parser or the allocator.
+// Named variables and functions are registered once and bound into each compiled
+// expression by slot, so their values can change without invalidating the cache.
+#define EXPR_CACHE_SIZE 64
+#define EXPR_CACHE_KEY 64
+#define EXPR_MAX_VARIABLES 64
+#define EXPR_MAX_FUNCTIONS 32
+#define EXPR_MAX_BINDINGS 32
+#define EXPR_MAX_ARGS 16
+#define EXPR_NAME_LENGTH 32
+
+struct ExprVariable
+{
+    char name[EXPR_NAME_LENGTH];
+    double value;
+};
+
+struct ExprFunction
+{
+    char name[EXPR_NAME_LENGTH];
+    expression_function callback;
+    void* userdata;
+};
+
+struct ExprCacheEntry
+{
+    char text[EXPR_CACHE_KEY];
+    ImU32 hash;
+    ImU32 lastUsed;
+    bool used;
+    struct expr* e; // NULL when the text does not parse
+    struct expr_var_list vars;
+    // Registry slot of each entry in vars (in list order), or -1 for a local variable
+    int bindings[EXPR_MAX_BINDINGS];
+    int bindingCount;
+};
+
+static ExprVariable exprVariables[EXPR_MAX_VARIABLES];
+static int exprVariableCount = 0;
+static ExprFunction exprFunctions[EXPR_MAX_FUNCTIONS];
+// expr_create looks functions up in a NULL terminated table, and compiled
+// expressions keep pointers into it, so this array never moves.
+static struct expr_func exprFuncTable[EXPR_MAX_FUNCTIONS + 1];
+static int exprFunctionCount = 0;
+static ExprCacheEntry exprCache[EXPR_CACHE_SIZE];
+static ImU32 exprCacheClock = 0;
+static bool exprRegistryInitialized = false;
+static int exprPrevSlot = -1;
+
+static ImU32 igExtExpressionHash(const char* text, size_t len)
+{
+    ImU32 hash = 2166136261u;
+    for (size_t i = 0; i < len; i++)
+    {
+        hash ^= (ImU8)text[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static double igExtExpressionCallFunction(struct expr_func* f, vec_expr_t* args, void* context)
+{
+    IM_UNUSED(context);
+    const ExprFunction& fn = exprFunctions[f - exprFuncTable];
+    double values[EXPR_MAX_ARGS];
+    int count = vec_len(args);
+    // Compilation rejects longer calls, never hand a callback a truncated list
+    if (count > EXPR_MAX_ARGS)
+        return NAN;
+    for (int i = 0; i < count; i++)
+        values[i] = expr_eval(&vec_nth(args, i));
+    return fn.callback(values, count, fn.userdata);
+}
+
+static void igExtExpressionDestroyEntry(ExprCacheEntry* entry)
+{
+    expr_destroy(entry->e, &entry->vars);
+    entry->e = NULL;
+    entry->vars.head = NULL;
+    entry->bindingCount = 0;
+    entry->used = false;
+}
+
+static void igExtExpressionClearCache()
+{
+    for (int i = 0; i < EXPR_CACHE_SIZE; i++)
+    {
+        if (exprCache[i].used)
+            igExtExpressionDestroyEntry(&exprCache[i]);
+    }
+}
+
+static int igExtExpressionFindVariable(const char* name)
+{
+    for (int i = 0; i < exprVariableCount; i++)
+    {
+        if (strcmp(exprVariables[i].name, name) == 0)
+            return i;
+    }
+    return -1;
+}
+
+static int igExtExpressionFindFunction(const char* name)
+{
+    for (int i = 0; i < exprFunctionCount; i++)
+    {
+        if (strcmp(exprFunctions[i].name, name) == 0)
+            return i;
+    }
+    return -1;
+}
+
+static bool igExtExpressionSetVariableInternal(const char* name, double value)
+{
+    int slot = igExtExpressionFindVariable(name);
+    if (slot >= 0)
+    {
+        // Compiled expressions read the registry on every evaluation, nothing to invalidate
+        exprVariables[slot].value = value;
+        return true;
+    }
+    if (exprVariableCount >= EXPR_MAX_VARIABLES || strlen(name) >= EXPR_NAME_LENGTH)
+        return false;
+    // Cached entries compiled the name as a local variable, drop them so it binds
+    igExtExpressionClearCache();
+    ImStrncpy(exprVariables[exprVariableCount].name, name, EXPR_NAME_LENGTH);
+    exprVariables[exprVariableCount].value = value;
+    exprVariableCount++;
+    return true;
+}
+
+static bool igExtExpressionRegisterFunctionInternal(const char* name, expression_function callback, void* userdata)
+{
+    int slot = igExtExpressionFindFunction(name);
+    if (slot < 0)
+    {
+        if (exprFunctionCount >= EXPR_MAX_FUNCTIONS || strlen(name) >= EXPR_NAME_LENGTH)
+            return false;
+        slot = exprFunctionCount++;
+        ImStrncpy(exprFunctions[slot].name, name, EXPR_NAME_LENGTH);
+        exprFuncTable[slot].name = exprFunctions[slot].name;
+        exprFuncTable[slot].f = igExtExpressionCallFunction;
+        exprFuncTable[slot].cleanup = NULL;
+        exprFuncTable[slot].ctxsz = 0;
+        // Text that failed to parse (or parsed as a variable) may now compile differently
+        igExtExpressionClearCache();
+    }
+    exprFunctions[slot].callback = callback;
+    exprFunctions[slot].userdata = userdata;
+    return true;
+}
+
+static double igExtExpressionDegrees(const double* args, int count, void* userdata)
+{
+    IM_UNUSED(userdata);
+    return count > 0 ? args[0] * (180.0 / IM_PI) : 0.0;
+}
+
+static double igExtExpressionRadians(const double* args, int count, void* userdata)
+{
+    IM_UNUSED(userdata);
+    return count > 0 ? args[0] * (IM_PI / 180.0) : 0.0;
+}
+
+static void igExtExpressionInitRegistry()
+{
+    if (exprRegistryInitialized)
+        return;
+    exprRegistryInitialized = true;
+    igExtExpressionSetVariableInternal("$prev", 0.0);
+    exprPrevSlot = igExtExpressionFindVariable("$prev");
+    igExtExpressionSetVariableInternal("pi", IM_PI);
+    igExtExpressionRegisterFunctionInternal("deg", igExtExpressionDegrees, NULL);
+    igExtExpressionRegisterFunctionInternal("rad", igExtExpressionRadians, NULL);
+}
+
+// Function calls are limited to EXPR_MAX_ARGS arguments, as in batch programs
+static bool igExtExpressionArgsFit(struct expr* e)
+{
+    if (e->type == OP_CONST || e->type == OP_VAR)
+        return true;
+    vec_expr_t* args = e->type == OP_FUNC ? &e->param.func.args : &e->param.op.args;
+    if (e->type == OP_FUNC && vec_len(args) > EXPR_MAX_ARGS)
+        return false;
+    for (int i = 0; i < vec_len(args); i++)
+    {
+        if (!igExtExpressionArgsFit(&vec_nth(args, i)))
+            return false;
+    }
+    return true;
+}
+
+static bool igExtExpressionCompile(ExprCacheEntry* entry, const char* buf, size_t len)
+{
+    entry->vars.head = NULL;
+    entry->bindingCount = 0;
+    entry->e = expr_create(buf, len, &entry->vars, exprFuncTable);
+    if (entry->e == NULL)
+        return false;
+    if (!igExtExpressionArgsFit(entry->e))
+    {
+        expr_destroy(entry->e, &entry->vars);
+        entry->e = NULL;
+        entry->vars.head = NULL;
+        return false;
+    }
+    for (struct expr_var* v = entry->vars.head; v; v = v->next)
+    {
+        if (entry->bindingCount >= EXPR_MAX_BINDINGS)
+        {
+            expr_destroy(entry->e, &entry->vars);
+            entry->e = NULL;
+            entry->vars.head = NULL;
+            return false;
+        }
+        entry->bindings[entry->bindingCount++] = igExtExpressionFindVariable(v->name);
+    }
+    return true;
+}
+
+static double igExtExpressionRun(ExprCacheEntry* entry)
+{
+    // Registered values are copied in, locals start from zero as they did when
+    // each evaluation built a fresh variable list.
+    int i = 0;
+    for (struct expr_var* v = entry->vars.head; v; v = v->next, i++)
+        v->value = entry->bindings[i] >= 0 ? exprVariables[entry->bindings[i]].value : 0.0;
+    return expr_eval(entry->e);
+}
+
 static bool igExtEvaluateExpression(const char *buf, double* result)
 {
     *result = 0;
-    struct expr_var_list vars = {0};
-    struct expr_func user_funcs[] = { {NULL, NULL, NULL, 0} };
-    struct expr *e = expr_create(buf, strlen(buf), &vars, user_funcs);
-    if(e == NULL)
+    igExtExpressionInitRegistry();
+    size_t len = strlen(buf);
+    if (len >= EXPR_CACHE_KEY)
     {
+        // Too long to key the cache, compile for this evaluation only
+        ExprCacheEntry temp;
+        if (!igExtExpressionCompile(&temp, buf, len))
+            return false;
+        *result = igExtExpressionRun(&temp);
+        expr_destroy(temp.e, &temp.vars);
+        return true;
+    }
+
+    ImU32 hash = igExtExpressionHash(buf, len);
+    ExprCacheEntry* entry = NULL;
+    ExprCacheEntry* victim = &exprCache[0];
+    for (int i = 0; i < EXPR_CACHE_SIZE; i++)
+    {
+        ExprCacheEntry* it = &exprCache[i];
+        if (it->used && it->hash == hash && strcmp(it->text, buf) == 0)
+        {
+            entry = it;
+            break;
+        }
+        if (!it->used)
+            victim = it;
+        else if (victim->used && it->lastUsed < victim->lastUsed)
+            victim = it;
+    }
+    if (entry == NULL)
+    {
+        entry = victim;
+        if (entry->used)
+            igExtExpressionDestroyEntry(entry);
+        memcpy(entry->text, buf, len + 1);
+        entry->hash = hash;
+        entry->used = true;
+        // Failures are cached too, so invalid text isn't parsed again every frame
+        igExtExpressionCompile(entry, buf, len);
+    }
+    entry->lastUsed = ++exprCacheClock;
+    if (entry->e == NULL)
+        return false;
+    *result = igExtExpressionRun(entry);
+    return true;
+}
+
+// Batch programs: an expression compiled once to a flat stack program and run
+// over many rows of variable bindings. Each instruction is applied to a block of
+// EXPR_BATCH rows at a time, so the arithmetic is a plain loop over lanes the
+// compiler can vectorise instead of a recursive walk per row.
+#define EXPR_BATCH 64
+
+enum ExprVariableSource
+{
+    ExprVariableSource_Column,  // read from the caller's bindings
+    ExprVariableSource_Uniform, // registered variable, same for every row
+    ExprVariableSource_Local    // assigned inside the expression, starts at zero
+};
+
+struct ExprProgramVariable
+{
+    struct expr_var* var;
+    ExprVariableSource source;
+    int index;
+};
+
+struct ExprInstruction
+{
+    enum expr_type op;
+    int operand; // variable index for OP_VAR/OP_ASSIGN, function slot for OP_FUNC
+    int argc;
+    double value;
+};
+
+struct ExprProgram
+{
+    struct expr* e;
+    struct expr_var_list vars;
+    ImVector<ExprProgramVariable> variables;
+    ImVector<ExprInstruction> code;
+    ImVector<double> lanes; // variables, then the stack, EXPR_BATCH values each
+    int stackDepth;
+    // Assignments or calls under && / || must only run for the rows that take
+    // that branch, such programs walk the tree once per row instead.
+    bool perRow;
+};
+
+static bool igExtExpressionHasSideEffects(struct expr* e)
+{
+    if (e->type == OP_ASSIGN || e->type == OP_FUNC)
+        return true;
+    if (e->type == OP_CONST || e->type == OP_VAR)
         return false;
+    for (int i = 0; i < vec_len(&e->param.op.args); i++)
+    {
+        if (igExtExpressionHasSideEffects(&vec_nth(&e->param.op.args, i)))
+            return true;
+    }
+    return false;
+}
+
+static int igExtExpressionProgramVariable(ExprProgram* program, double* value)
+{
+    for (int i = 0; i < program->variables.Size; i++)
+    {
+        if (&program->variables[i].var->value == value)
+            return i;
+    }
+    return -1;
+}
+
+static bool igExtExpressionEmit(ExprProgram* program, struct expr* e, int* depth)
+{
+    ExprInstruction ins;
+    ins.op = e->type;
+    ins.operand = 0;
+    ins.argc = 0;
+    ins.value = 0.0;
+    switch (e->type)
+    {
+        case OP_CONST:
+            ins.value = e->param.num.value;
+            (*depth)++;
+            break;
+        case OP_VAR:
+            ins.operand = igExtExpressionProgramVariable(program, e->param.var.value);
+            (*depth)++;
+            break;
+        case OP_FUNC:
+        {
+            int argc = vec_len(&e->param.func.args);
+            if (argc > EXPR_MAX_ARGS)
+                return false;
+            for (int i = 0; i < argc; i++)
+            {
+                if (!igExtExpressionEmit(program, &vec_nth(&e->param.func.args, i), depth))
+                    return false;
+            }
+            ins.operand = (int)(e->param.func.f - exprFuncTable);
+            ins.argc = argc;
+            *depth += 1 - argc;
+            break;
+        }
+        case OP_ASSIGN:
+        {
+            struct expr* target = &vec_nth(&e->param.op.args, 0);
+            if (target->type != OP_VAR || !igExtExpressionEmit(program, &vec_nth(&e->param.op.args, 1), depth))
+                return false;
+            ins.operand = igExtExpressionProgramVariable(program, target->param.var.value);
+            break;
+        }
+        default:
+        {
+            if (e->type == OP_UNKNOWN || e->type > OP_COMMA)
+                return false;
+            int argc = vec_len(&e->param.op.args);
+            for (int i = 0; i < argc; i++)
+            {
+                if (!igExtExpressionEmit(program, &vec_nth(&e->param.op.args, i), depth))
+                    return false;
+            }
+            // Unary operators replace the top of the stack, binary ones pop one
+            *depth -= argc - 1;
+            if ((e->type == OP_LOGICAL_AND || e->type == OP_LOGICAL_OR) &&
+                igExtExpressionHasSideEffects(&vec_nth(&e->param.op.args, 1)))
+                program->perRow = true;
+            break;
+        }
     }
-    *result = expr_eval(e);
-    expr_destroy(e, &vars);
+    if (ins.operand < 0)
+        return false;
+    program->stackDepth = ImMax(program->stackDepth, *depth);
+    program->code.push_back(ins);
     return true;
 }
 
+static void igExtDestroyExpressionProgram(ExprProgram* program)
+{
+    expr_destroy(program->e, &program->vars);
+    IM_DELETE(program);
+}
+
+static ExprProgram* igExtCreateExpressionProgram(const char* text, const char* const* columns, int columnCount)
+{
+    igExtExpressionInitRegistry();
+    ExprProgram* program = IM_NEW(ExprProgram)();
+    program->vars.head = NULL;
+    program->stackDepth = 0;
+    program->perRow = false;
+    program->e = expr_create(text, strlen(text), &program->vars, exprFuncTable);
+    if (program->e == NULL)
+    {
+        igExtDestroyExpressionProgram(program);
+        return NULL;
+    }
+    for (struct expr_var* v = program->vars.head; v; v = v->next)
+    {
+        ExprProgramVariable pv;
+        pv.var = v;
+        pv.source = ExprVariableSource_Local;
+        pv.index = 0;
+        for (int i = 0; i < columnCount; i++)
+        {
+            if (strcmp(columns[i], v->name) == 0)
+            {
+                pv.source = ExprVariableSource_Column;
+                pv.index = i;
+                break;
+            }
+        }
+        int slot = pv.source == ExprVariableSource_Local ? igExtExpressionFindVariable(v->name) : -1;
+        if (slot >= 0)
+        {
+            pv.source = ExprVariableSource_Uniform;
+            pv.index = slot;
+        }
+        program->variables.push_back(pv);
+    }
+    int depth = 0;
+    if (!igExtExpressionEmit(program, program->e, &depth) || depth != 1)
+    {
+        igExtDestroyExpressionProgram(program);
+        return NULL;
+    }
+    program->lanes.resize((program->variables.Size + program->stackDepth) * EXPR_BATCH);
+    return program;
+}
+
+static inline double igExtExpressionLoad(const ExprProgramVariable& pv, const double* row)
+{
+    switch (pv.source)
+    {
+        case ExprVariableSource_Column: return row[pv.index];
+        case ExprVariableSource_Uniform: return exprVariables[pv.index].value;
+        default: return 0.0;
+    }
+}
+
+static void igExtExpressionRunBlock(ExprProgram* program, const double* bindings, int stride, int n, double* results)
+{
+    double* varLanes = program->lanes.Data;
+    double* stack = varLanes + program->variables.Size * EXPR_BATCH;
+    for (int v = 0; v < program->variables.Size; v++)
+    {
+        const ExprProgramVariable& pv = program->variables[v];
+        double* lane = varLanes + v * EXPR_BATCH;
+        if (pv.source == ExprVariableSource_Column)
+        {
+            for (int i = 0; i < n; i++)
+                lane[i] = bindings[(size_t)i * stride + pv.index];
+        }
+        else
+        {
+            double value = igExtExpressionLoad(pv, NULL);
+            for (int i = 0; i < n; i++)
+                lane[i] = value;
+        }
+    }
+
+    double* top = stack - EXPR_BATCH;
+    for (int pc = 0; pc < program->code.Size; pc++)
+    {
+        const ExprInstruction& ins = program->code[pc];
+        double* a = top - EXPR_BATCH; // left operand of a binary op, and its result
+        double* b = top;
+        switch (ins.op)
+        {
+            case OP_CONST:
+                top += EXPR_BATCH;
+                for (int i = 0; i < n; i++) top[i] = ins.value;
+                break;
+            case OP_VAR:
+                top += EXPR_BATCH;
+                memcpy(top, varLanes + ins.operand * EXPR_BATCH, n * sizeof(double));
+                break;
+            case OP_ASSIGN:
+                memcpy(varLanes + ins.operand * EXPR_BATCH, top, n * sizeof(double));
+                break;
+            case OP_FUNC:
+            {
+                const ExprFunction& fn = exprFunctions[ins.operand];
+                double* first = top - (ins.argc - 1) * EXPR_BATCH;
+                double args[EXPR_MAX_ARGS];
+                for (int i = 0; i < n; i++)
+                {
+                    for (int j = 0; j < ins.argc; j++)
+                        args[j] = first[j * EXPR_BATCH + i];
+                    first[i] = fn.callback(args, ins.argc, fn.userdata);
+                }
+                top = first;
+                break;
+            }
+            case OP_UNARY_MINUS: for (int i = 0; i < n; i++) b[i] = -b[i]; break;
+            case OP_UNARY_LOGICAL_NOT: for (int i = 0; i < n; i++) b[i] = !b[i]; break;
+            case OP_UNARY_BITWISE_NOT: for (int i = 0; i < n; i++) b[i] = ~to_int(b[i]); break;
+            default:
+            {
+                switch (ins.op)
+                {
+                    case OP_POWER: for (int i = 0; i < n; i++) a[i] = powf(a[i], b[i]); break;
+                    case OP_MULTIPLY: for (int i = 0; i < n; i++) a[i] = a[i] * b[i]; break;
+                    case OP_DIVIDE: for (int i = 0; i < n; i++) a[i] = a[i] / b[i]; break;
+                    case OP_REMAINDER: for (int i = 0; i < n; i++) a[i] = fmodf(a[i], b[i]); break;
+                    case OP_PLUS: for (int i = 0; i < n; i++) a[i] = a[i] + b[i]; break;
+                    case OP_MINUS: for (int i = 0; i < n; i++) a[i] = a[i] - b[i]; break;
+                    case OP_SHL: for (int i = 0; i < n; i++) a[i] = to_int(a[i]) << to_int(b[i]); break;
+                    case OP_SHR: for (int i = 0; i < n; i++) a[i] = to_int(a[i]) >> to_int(b[i]); break;
+                    case OP_LT: for (int i = 0; i < n; i++) a[i] = a[i] < b[i]; break;
+                    case OP_LE: for (int i = 0; i < n; i++) a[i] = a[i] <= b[i]; break;
+                    case OP_GT: for (int i = 0; i < n; i++) a[i] = a[i] > b[i]; break;
+                    case OP_GE: for (int i = 0; i < n; i++) a[i] = a[i] >= b[i]; break;
+                    case OP_EQ: for (int i = 0; i < n; i++) a[i] = a[i] == b[i]; break;
+                    case OP_NE: for (int i = 0; i < n; i++) a[i] = a[i] != b[i]; break;
+                    case OP_BITWISE_AND: for (int i = 0; i < n; i++) a[i] = to_int(a[i]) & to_int(b[i]); break;
+                    case OP_BITWISE_OR: for (int i = 0; i < n; i++) a[i] = to_int(a[i]) | to_int(b[i]); break;
+                    case OP_BITWISE_XOR: for (int i = 0; i < n; i++) a[i] = to_int(a[i]) ^ to_int(b[i]); break;
+                    // Both sides are already evaluated, select what expr_eval would have returned
+                    case OP_LOGICAL_AND: for (int i = 0; i < n; i++) a[i] = (a[i] != 0 && b[i] != 0) ? b[i] : 0.0; break;
+                    case OP_LOGICAL_OR: for (int i = 0; i < n; i++) a[i] = (a[i] != 0 && !isnan(a[i])) ? a[i] : (b[i] != 0 ? b[i] : 0.0); break;
+                    case OP_COMMA: memcpy(a, b, n * sizeof(double)); break;
+                    default: break;
+                }
+                top = a;
+                break;
+            }
+        }
+    }
+    memcpy(results, stack, n * sizeof(double));
+}
+
+static int igExtRunExpressionProgram(ExprProgram* program, const double* bindings, int stride, int count, double* results, unsigned char* errors)
+{
+    if (program->perRow)
+    {
+        for (int row = 0; row < count; row++)
+        {
+            const double* values = bindings + (size_t)row * stride;
+            for (int v = 0; v < program->variables.Size; v++)
+                program->variables[v].var->value = igExtExpressionLoad(program->variables[v], values);
+            results[row] = expr_eval(program->e);
+        }
+    }
+    else
+    {
+        for (int start = 0; start < count; start += EXPR_BATCH)
+        {
+            int n = ImMin(EXPR_BATCH, count - start);
+            igExtExpressionRunBlock(program, bindings + (size_t)start * stride, stride, n, results + start);
+        }
+    }
+    // Division by zero, fmod by zero, pow of a negative base etc. leave NaN or infinity
+    int errorCount = 0;
+    for (int row = 0; row < count; row++)
+    {
+        bool error = !isfinite(results[row]);
+        if (errors != NULL)
+            errors[row] = error ? 1 : 0;
+        errorCount += error ? 1 : 0;
+    }
+    return errorCount;
+}
+
+static double igExtDataTypeToDouble(ImGuiDataType data_type, const void* p_data)
+{
+    switch(data_type)
+    {
+        case ImGuiDataType_S8: return (double)*(const ImS8*)p_data;
+        case ImGuiDataType_U8: return (double)*(const ImU8*)p_data;
+        case ImGuiDataType_S16: return (double)*(const ImS16*)p_data;
+        case ImGuiDataType_U16: return (double)*(const ImU16*)p_data;
+        case ImGuiDataType_S32: return (double)*(const ImS32*)p_data;
+        case ImGuiDataType_U32: return (double)*(const ImU32*)p_data;
+        case ImGuiDataType_S64: return (double)*(const ImS64*)p_data;
+        case ImGuiDataType_U64: return (double)*(const ImU64*)p_data;
+        case ImGuiDataType_Float: return (double)*(const float*)p_data;
+        case ImGuiDataType_Double: return *(const double*)p_data;
+        default: return 0.0;
+    }
+}
+
 static bool emptyOrWhiteSpace(const char *str)
 {
     while(ImCharIsBlankA(*str))
@@ -105,6 +707,8 @@ static bool igExtDataTypeApplyFromText(const char* buf, ImGuiDataType data_type,
     {
         // expression parser, sscanf did not work
         double exprResult;
+        igExtExpressionInitRegistry();
+        exprVariables[exprPrevSlot].value = igExtDataTypeToDouble(data_type, &data_backup);
         if(igExtEvaluateExpression(buf, &exprResult))
         {
             switch(data_type)
@@ -370,3 +974,40 @@ CIMGUI_API int igExtInputIntPreview(const char *label, const char *preview, int*
     RenderTextClipped(frame_bb.Min + style.FramePadding, frame_bb.Max - style.FramePadding, preview, NULL, NULL, ImVec2(0.0f, 0.5f));
     return 0;
 }
+
+CIMGUI_API int igExtExpressionSetVariable(const char* name, double value)
+{
+    igExtExpressionInitRegistry();
+    return igExtExpressionSetVariableInternal(name, value) ? 1 : 0;
+}
+
+CIMGUI_API int igExtExpressionRegisterFunction(const char* name, expression_function callback, void* userdata)
+{
+    igExtExpressionInitRegistry();
+    return igExtExpressionRegisterFunctionInternal(name, callback, userdata) ? 1 : 0;
+}
+
+CIMGUI_API void igExtExpressionFlushCache()
+{
+    igExtExpressionClearCache();
+}
+
+CIMGUI_API int igExtExpressionEvaluate(const char* text, double* result)
+{
+    return igExtEvaluateExpression(text, result) ? 1 : 0;
+}
+
+CIMGUI_API expression_program_t igExtExpressionProgramCreate(const char* text, const char* const* columns, int columnCount)
+{
+    return (expression_program_t)igExtCreateExpressionProgram(text, columns, columnCount);
+}
+
+CIMGUI_API int igExtExpressionProgramEvaluate(expression_program_t program, const double* bindings, int stride, int count, double* results, unsigned char* errors)
+{
+    return igExtRunExpressionProgram((ExprProgram*)program, bindings, stride, count, results, errors);
+}
+
+CIMGUI_API void igExtExpressionProgramFree(expression_program_t program)
+{
+    igExtDestroyExpressionProgram((ExprProgram*)program);
+}
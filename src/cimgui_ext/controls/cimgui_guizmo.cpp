@@ -1,6 +1,43 @@
 #include "imgui.h"
 #include "cimgui_ext.h"
 #include "ImGuizmo.h"
+#include <string.h>
+
+enum GuizmoPivot
+{
+    GUIZMO_PIVOT_CENTROID = 0,
+    GUIZMO_PIVOT_INDIVIDUAL_ORIGINS = 1,
+    GUIZMO_PIVOT_ACTIVE = 2,
+};
+
+// Inverse of an affine matrix (last column 0,0,0,1). Returns false if singular.
+static bool GuizmoAffineInverse(const float* m, float* out)
+{
+    const float c0 = m[5] * m[10] - m[6] * m[9];
+    const float c1 = m[6] * m[8] - m[4] * m[10];
+    const float c2 = m[4] * m[9] - m[5] * m[8];
+    const float det = m[0] * c0 + m[1] * c1 + m[2] * c2;
+    if (det == 0.0f)
+        return false;
+    const float id = 1.0f / det;
+    float r[16];
+    r[0] = c0 * id;
+    r[1] = (m[2] * m[9] - m[1] * m[10]) * id;
+    r[2] = (m[1] * m[6] - m[2] * m[5]) * id;
+    r[4] = c1 * id;
+    r[5] = (m[0] * m[10] - m[2] * m[8]) * id;
+    r[6] = (m[2] * m[4] - m[0] * m[6]) * id;
+    r[8] = c2 * id;
+    r[9] = (m[1] * m[8] - m[0] * m[9]) * id;
+    r[10] = (m[0] * m[5] - m[1] * m[4]) * id;
+    r[12] = -(m[12] * r[0] + m[13] * r[4] + m[14] * r[8]);
+    r[13] = -(m[12] * r[1] + m[13] * r[5] + m[14] * r[9]);
+    r[14] = -(m[12] * r[2] + m[13] * r[6] + m[14] * r[10]);
+    r[3] = r[7] = r[11] = 0.0f;
+    r[15] = 1.0f;
+    memcpy(out, r, sizeof(r));
+    return true;
+}
 
 CIMGUI_API void igGuizmoBeginFrame()
 {
@@ -37,6 +74,83 @@ CIMGUI_API int igGuizmoManipulate(float* view, float* projection, int operation,
     return ImGuizmo::Manipulate(view, projection, (ImGuizmo::OPERATION)operation, (ImGuizmo::MODE)mode, matrix, delta, NULL, NULL, NULL);
 }
 
+// One gizmo for several matrices. The gizmo sits on the centroid of the translations
+// (with the active matrix orientation) or on the active matrix, and the change it makes
+// this frame is applied to every matrix about that point. With individual origins
+// each matrix keeps its own position for rotation and scale.
+// delta receives the world space transform that was applied.
+CIMGUI_API int igGuizmoManipulateBatch(float* view, float* projection, int operation, int mode, int pivot, float* matrices, int count, int active, float* delta)
+{
+    static const float identity[16] = { 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1 };
+    if (delta)
+        memcpy(delta, identity, sizeof(identity));
+    if (count <= 0)
+        return ImGuizmo::OP_NOTHING;
+    if (active < 0 || active >= count)
+        active = 0;
+
+    float gizmo[16];
+    memcpy(gizmo, matrices + active * 16, sizeof(gizmo));
+    if (pivot == GUIZMO_PIVOT_CENTROID)
+    {
+        float x = 0, y = 0, z = 0;
+        for (int i = 0; i < count; i++)
+        {
+            x += matrices[i * 16 + 12];
+            y += matrices[i * 16 + 13];
+            z += matrices[i * 16 + 14];
+        }
+        gizmo[12] = x / count;
+        gizmo[13] = y / count;
+        gizmo[14] = z / count;
+    }
+    const float origin[3] = { gizmo[12], gizmo[13], gizmo[14] };
+
+    float change[16];
+    float before[16];
+    memcpy(before, gizmo, sizeof(before));
+    const ImGuizmo::APPLIEDOP op = ImGuizmo::Manipulate(view, projection, (ImGuizmo::OPERATION)operation, (ImGuizmo::MODE)mode, gizmo, change, NULL, NULL, NULL);
+    if (op == ImGuizmo::OP_NOTHING)
+        return op;
+    if (op == ImGuizmo::OP_SCALE)
+    {
+        // The scale delta is local and relative to the start of the drag,
+        // take this frame's change from the gizmo matrix instead.
+        float inv[16];
+        if (!GuizmoAffineInverse(before, inv))
+            return ImGuizmo::OP_NOTHING;
+        ImGuizmo::FPU_MatrixF_x_MatrixF(inv, gizmo, change);
+    }
+
+    if (pivot == GUIZMO_PIVOT_INDIVIDUAL_ORIGINS)
+    {
+        // Linear part applied in place, positions only follow the gizmo origin
+        const float dx = origin[0] * change[0] + origin[1] * change[4] + origin[2] * change[8] + change[12] - origin[0];
+        const float dy = origin[0] * change[1] + origin[1] * change[5] + origin[2] * change[9] + change[13] - origin[1];
+        const float dz = origin[0] * change[2] + origin[1] * change[6] + origin[2] * change[10] + change[14] - origin[2];
+        float linear[16];
+        memcpy(linear, change, sizeof(linear));
+        linear[12] = linear[13] = linear[14] = 0.0f;
+        for (int i = 0; i < count; i++)
+        {
+            float* m = matrices + i * 16;
+            const float x = m[12] + dx, y = m[13] + dy, z = m[14] + dz;
+            ImGuizmo::FPU_MatrixF_x_MatrixF(m, linear, m);
+            m[12] = x;
+            m[13] = y;
+            m[14] = z;
+        }
+    }
+    else
+    {
+        for (int i = 0; i < count; i++)
+            ImGuizmo::FPU_MatrixF_x_MatrixF(matrices + i * 16, change, matrices + i * 16);
+    }
+    if (delta)
+        memcpy(delta, change, sizeof(change));
+    return op;
+}
+
 CIMGUI_API void igGuizmoSetDrawlist()
 {
     ImGuizmo::SetDrawlist();
@@ -1,7 +1,153 @@
 #include "cimgui_ext.h"
 #include "imgui.h"
+#include "imgui_internal.h"
 #include "imgui_memory_editor.h"
 
+// Memory editor source that reads fixed size pages through a callback on demand.
+// The most recently used pages are cached. Writes are kept as a sorted patch list,
+// applied to pages as they are loaded and to cached pages as they are written.
+struct MemoryEditorPagedSource
+{
+	struct Page
+	{
+		size_t Index;   // (size_t)-1 = empty slot
+		ImU64 LastUse;
+	};
+	struct Patch
+	{
+		size_t Addr;
+		ImU8 Value;
+	};
+
+	memoryedit_read_t ReadCallback;
+	void* UserData;
+	size_t Size;
+	size_t PageSize;
+	ImVector<Page> Pages;
+	ImVector<ImU8> Storage;     // Pages.Size * PageSize
+	ImVector<Patch> Patches;    // ascending Addr
+	ImU64 Clock;
+	int LastSlot;
+
+	MemoryEditorPagedSource(memoryedit_read_t read_callback, void* user_data, size_t size, size_t page_size, int page_count)
+	{
+		ReadCallback = read_callback;
+		UserData = user_data;
+		Size = size;
+		PageSize = page_size;
+		Pages.resize(page_count);
+		IM_ASSERT(page_size <= (size_t)INT_MAX / page_count);
+		Storage.resize((int)(page_size * page_count));
+		Clock = 0;
+		LastSlot = 0;
+		Invalidate();
+	}
+
+	void Invalidate()
+	{
+		for (int i = 0; i < Pages.Size; i++)
+		{
+			Pages[i].Index = (size_t)-1;
+			Pages[i].LastUse = 0;
+		}
+	}
+
+	const ImU8* GetPage(size_t index)
+	{
+		if (Pages[LastSlot].Index == index)
+			return Storage.Data + (size_t)LastSlot * PageSize;
+		int slot = 0;
+		for (int i = 0; i < Pages.Size; i++)
+		{
+			if (Pages[i].Index == index)
+			{
+				slot = i;
+				break;
+			}
+			if (Pages[i].LastUse < Pages[slot].LastUse)
+				slot = i;
+		}
+		ImU8* data = Storage.Data + (size_t)slot * PageSize;
+		if (Pages[slot].Index != index)
+		{
+			const size_t offset = index * PageSize;
+			const size_t want = ImMin(PageSize, Size - offset);
+			const size_t got = ReadCallback(UserData, offset, data, want);
+			if (got < want)
+				memset(data + got, 0, want - got); // unreadable bytes show as zero
+			for (int n = FindPatch(offset); n < Patches.Size && Patches[n].Addr < offset + want; n++)
+				data[Patches[n].Addr - offset] = Patches[n].Value;
+			Pages[slot].Index = index;
+		}
+		Pages[slot].LastUse = ++Clock;
+		LastSlot = slot;
+		return data;
+	}
+
+	int FindPatch(size_t addr) const
+	{
+		int lo = 0, hi = Patches.Size;
+		while (lo < hi)
+		{
+			const int mid = (lo + hi) / 2;
+			if (Patches[mid].Addr < addr)
+				lo = mid + 1;
+			else
+				hi = mid;
+		}
+		return lo;
+	}
+
+	ImU8 Read(size_t addr)
+	{
+		return GetPage(addr / PageSize)[addr % PageSize];
+	}
+
+	void ReadRange(size_t addr, ImU8* out, size_t size)
+	{
+		for (size_t done = 0; done < size; )
+		{
+			const size_t a = addr + done;
+			const size_t n = ImMin(PageSize - a % PageSize, size - done);
+			memcpy(out + done, GetPage(a / PageSize) + a % PageSize, n);
+			done += n;
+		}
+	}
+
+	void Write(size_t addr, ImU8 value)
+	{
+		const int n = FindPatch(addr);
+		if (n < Patches.Size && Patches[n].Addr == addr)
+		{
+			Patches[n].Value = value;
+		}
+		else
+		{
+			Patch patch;
+			patch.Addr = addr;
+			patch.Value = value;
+			Patches.insert(Patches.Data + n, patch);
+		}
+		for (int i = 0; i < Pages.Size; i++)
+			if (Pages[i].Index == addr / PageSize)
+				Storage.Data[(size_t)i * PageSize + addr % PageSize] = value;
+	}
+
+	static ImU8 ReadFn(const ImU8*, size_t off, void* user_data)
+	{
+		return ((MemoryEditorPagedSource*)user_data)->Read(off);
+	}
+
+	static void ReadRangeFn(const ImU8*, size_t off, ImU8* out, size_t size, void* user_data)
+	{
+		((MemoryEditorPagedSource*)user_data)->ReadRange(off, out, size);
+	}
+
+	static void WriteFn(ImU8*, size_t off, ImU8 d, void* user_data)
+	{
+		((MemoryEditorPagedSource*)user_data)->Write(off, d);
+	}
+};
 
 CIMGUI_API memoryedit_t igExtMemoryEditInit()
 {
@@ -14,7 +160,106 @@ CIMGUI_API void igExtMemoryEditDrawContents(memoryedit_t memedit, void *mem_data
 	object->DrawContents(mem_data_void_ptr, mem_size, base_display_addr);
 }
 
+CIMGUI_API void igExtMemoryEditDrawContentsDiff(memoryedit_t memedit, void *mem_data_void_ptr, size_t mem_size, const void *diff_data_ptr, size_t diff_size, size_t base_display_addr)
+{
+	MemoryEditor* object = (MemoryEditor*)memedit;
+	object->DiffData = (const ImU8*)diff_data_ptr;
+	object->DiffSize = diff_data_ptr ? diff_size : 0;
+	object->DrawContents(mem_data_void_ptr, mem_size, base_display_addr);
+	object->DiffData = nullptr;
+	object->DiffSize = 0;
+}
+
+CIMGUI_API void igExtMemoryEditDrawSource(memoryedit_t memedit, memoryedit_source_t source, size_t base_display_addr, bool read_only)
+{
+	MemoryEditor* object = (MemoryEditor*)memedit;
+	MemoryEditorPagedSource* src = (MemoryEditorPagedSource*)source;
+	const bool restore_read_only = object->ReadOnly;
+	object->ReadFn = MemoryEditorPagedSource::ReadFn;
+	object->ReadRangeFn = MemoryEditorPagedSource::ReadRangeFn;
+	object->WriteFn = MemoryEditorPagedSource::WriteFn;
+	object->UserData = src;
+	object->ReadOnly = read_only;
+	object->DrawContents(nullptr, src->Size, base_display_addr);
+	object->ReadFn = nullptr;
+	object->ReadRangeFn = nullptr;
+	object->WriteFn = nullptr;
+	object->UserData = nullptr;
+	object->ReadOnly = restore_read_only;
+}
+
 CIMGUI_API void igExtMemoryEditFree(memoryedit_t memedit)
 {
 	delete (MemoryEditor*)memedit;
 }
+
+CIMGUI_API int igExtMemoryEditAddStruct(memoryedit_t memedit, const char* name, size_t size)
+{
+	return ((MemoryEditor*)memedit)->AddStruct(name, size);
+}
+
+CIMGUI_API void igExtMemoryEditAddStructField(memoryedit_t memedit, int struct_id, const char* name, int data_type, size_t offset, int count, int flags)
+{
+	((MemoryEditor*)memedit)->AddStructField(struct_id, name, data_type, offset, count, flags);
+}
+
+CIMGUI_API void igExtMemoryEditAddStructOverlay(memoryedit_t memedit, int struct_id, size_t addr, size_t count)
+{
+	((MemoryEditor*)memedit)->AddStructOverlay(struct_id, addr, count);
+}
+
+CIMGUI_API void igExtMemoryEditClearStructOverlays(memoryedit_t memedit)
+{
+	((MemoryEditor*)memedit)->ClearStructOverlays();
+}
+
+CIMGUI_API void igExtMemoryEditClearStructs(memoryedit_t memedit)
+{
+	((MemoryEditor*)memedit)->ClearStructs();
+}
+
+CIMGUI_API memoryedit_source_t igExtMemoryEditSourceCreate(memoryedit_read_t read_callback, void* user_data, size_t size, size_t page_size, int page_count)
+{
+	if (page_size == 0)
+		page_size = 64 * 1024;
+	if (page_count < 2)
+		page_count = 2;
+	// page storage is a single ImVector, which holds at most INT_MAX bytes
+	if (page_size > (size_t)INT_MAX / page_count)
+		return NULL;
+	return (memoryedit_source_t)(new MemoryEditorPagedSource(read_callback, user_data, size, page_size, page_count));
+}
+
+CIMGUI_API void igExtMemoryEditSourceInvalidate(memoryedit_source_t source)
+{
+	((MemoryEditorPagedSource*)source)->Invalidate();
+}
+
+CIMGUI_API int igExtMemoryEditSourceGetPatchCount(memoryedit_source_t source)
+{
+	return ((MemoryEditorPagedSource*)source)->Patches.Size;
+}
+
+CIMGUI_API int igExtMemoryEditSourceGetPatches(memoryedit_source_t source, size_t* addrs, uint8_t* values, int count)
+{
+	MemoryEditorPagedSource* src = (MemoryEditorPagedSource*)source;
+	const int n = ImMin(count, src->Patches.Size);
+	for (int i = 0; i < n; i++)
+	{
+		addrs[i] = src->Patches[i].Addr;
+		values[i] = src->Patches[i].Value;
+	}
+	return n;
+}
+
+CIMGUI_API void igExtMemoryEditSourceClearPatches(memoryedit_source_t source)
+{
+	MemoryEditorPagedSource* src = (MemoryEditorPagedSource*)source;
+	src->Patches.clear();
+	src->Invalidate(); // cached pages hold patched bytes
+}
+
+CIMGUI_API void igExtMemoryEditSourceFree(memoryedit_source_t source)
+{
+	delete (MemoryEditorPagedSource*)source;
+}
@@ -9,6 +9,8 @@
 #include <cmath>
 #include <cstdlib>
 
+#include "simd_ext.h"
+
 CIMGUI_API const char* igExtGetVersion()
 {
     return IMGUI_VERSION;
@@ -103,7 +105,172 @@ CIMGUI_API bool igButtonEx2(const char* label, float sizeX, float sizeY, int dra
     return pressed;
 }
 
-CIMGUI_API int igExtPlot(int plotType, const char* label, float (*values_getter)(void* data, int idx), int (*get_tooltip)(void* data, int idx, char* buffer), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, float size_x, float size_y)
+namespace {
+
+// Min and max of a strided float array, NaN values are ignored
+void ExtPlotMinMax(const float* values, int count, int stride, float* out_min, float* out_max)
+{
+    float v_min = FLT_MAX;
+    float v_max = -FLT_MAX;
+    int i = 0;
+    if (stride == sizeof(float))
+    {
+#if defined(IMGUI_EXT_SSE2)
+        // _mm_min_ps/_mm_max_ps return the second operand when the first is NaN
+        __m128 min0 = _mm_set1_ps(FLT_MAX), min1 = min0;
+        __m128 max0 = _mm_set1_ps(-FLT_MAX), max1 = max0;
+        for (; i + 8 <= count; i += 8)
+        {
+            const __m128 a = _mm_loadu_ps(values + i);
+            const __m128 b = _mm_loadu_ps(values + i + 4);
+            min0 = _mm_min_ps(a, min0);
+            min1 = _mm_min_ps(b, min1);
+            max0 = _mm_max_ps(a, max0);
+            max1 = _mm_max_ps(b, max1);
+        }
+        float lanes[4];
+        _mm_storeu_ps(lanes, _mm_min_ps(min0, min1));
+        v_min = ImMin(ImMin(lanes[0], lanes[1]), ImMin(lanes[2], lanes[3]));
+        _mm_storeu_ps(lanes, _mm_max_ps(max0, max1));
+        v_max = ImMax(ImMax(lanes[0], lanes[1]), ImMax(lanes[2], lanes[3]));
+#elif defined(IMGUI_EXT_NEON)
+        // vminnmq/vmaxnmq return the number when one operand is NaN
+        float32x4_t min0 = vdupq_n_f32(FLT_MAX), min1 = min0;
+        float32x4_t max0 = vdupq_n_f32(-FLT_MAX), max1 = max0;
+        for (; i + 8 <= count; i += 8)
+        {
+            const float32x4_t a = vld1q_f32(values + i);
+            const float32x4_t b = vld1q_f32(values + i + 4);
+            min0 = vminnmq_f32(min0, a);
+            min1 = vminnmq_f32(min1, b);
+            max0 = vmaxnmq_f32(max0, a);
+            max1 = vmaxnmq_f32(max1, b);
+        }
+        v_min = vminnmvq_f32(vminnmq_f32(min0, min1));
+        v_max = vmaxnmvq_f32(vmaxnmq_f32(max0, max1));
+#endif
+    }
+    for (; i < count; i++)
+    {
+        const float v = *(const float*)((const char*)values + (size_t)i * stride);
+        if (v != v) // Ignore NaN values
+            continue;
+        v_min = ImMin(v_min, v);
+        v_max = ImMax(v_max, v);
+    }
+    *out_min = v_min;
+    *out_max = v_max;
+}
+
+// Values read through a user callback, one call per sample
+struct PlotGetterSource
+{
+    float (*Getter)(void* data, int idx);
+    void* Data;
+    int Count;
+    int Offset;
+
+    float Value(int idx) const { return Getter(Data, (idx + Offset) % Count); }
+    int HoverIndex(float t, int item_count) const { return (int)(t * item_count); }
+    int ColumnIndex(float t0, float t1, int item_count) const { return (int)(t0 * item_count + 0.5f); }
+    int ColumnStart(float t) const { return (int)(t * Count); }
+
+    void RangeMinMax(int begin, int end, float* v_min, float* v_max) const
+    {
+        *v_min = FLT_MAX;
+        *v_max = -FLT_MAX;
+        for (int i = begin; i < end; i++)
+        {
+            const float v = Value(i);
+            if (v != v)
+                continue;
+            *v_min = ImMin(*v_min, v);
+            *v_max = ImMax(*v_max, v);
+        }
+    }
+
+    void MinMax(float* v_min, float* v_max) const
+    {
+        *v_min = FLT_MAX;
+        *v_max = -FLT_MAX;
+        for (int i = 0; i < Count; i++)
+        {
+            const float v = Getter(Data, i);
+            if (v != v) // Ignore NaN values
+                continue;
+            *v_min = ImMin(*v_min, v);
+            *v_max = ImMax(*v_max, v);
+        }
+    }
+};
+
+// Values read straight from a strided float array. With X values (ascending, same stride)
+// each column shows the sample at its X position instead of an evenly spaced index.
+struct PlotArraySource
+{
+    const float* Values;
+    const float* Xs;
+    int Count;
+    int Offset;
+    int Stride;
+
+    float At(const float* base, int idx) const { return *(const float*)((const char*)base + (size_t)((idx + Offset) % Count) * Stride); }
+    float Value(int idx) const { return At(Values, idx); }
+
+    // First sample with X at or after the position t across the plot
+    int LowerBound(float t) const
+    {
+        const float x_first = At(Xs, 0);
+        const float x = x_first + t * (At(Xs, Count - 1) - x_first);
+        int lo = 0, hi = Count;
+        while (lo < hi)
+        {
+            const int mid = lo + (hi - lo) / 2;
+            if (At(Xs, mid) < x)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        return lo;
+    }
+
+    int HoverIndex(float t, int item_count) const
+    {
+        if (!Xs)
+            return (int)(t * item_count);
+        return ImClamp(LowerBound(t), 0, item_count - 1);
+    }
+
+    // Index before the sample drawn at the end of the column
+    int ColumnIndex(float t0, float t1, int item_count) const
+    {
+        if (!Xs)
+            return (int)(t0 * item_count + 0.5f);
+        return ImClamp(LowerBound(t1) - 1, 0, ImMax(Count - 2, 0));
+    }
+
+    int ColumnStart(float t) const { return Xs ? LowerBound(t) : (int)(t * Count); }
+
+    // Logical range, split in two where the offset wraps it around the end of the array
+    void RangeMinMax(int begin, int end, float* v_min, float* v_max) const
+    {
+        const int first = (begin + Offset) % Count;
+        const int length = ImMin(end - begin, Count - first);
+        ExtPlotMinMax((const float*)((const char*)Values + (size_t)first * Stride), length, Stride, v_min, v_max);
+        if (length < end - begin)
+        {
+            float wrap_min, wrap_max;
+            ExtPlotMinMax(Values, end - begin - length, Stride, &wrap_min, &wrap_max);
+            *v_min = ImMin(*v_min, wrap_min);
+            *v_max = ImMax(*v_max, wrap_max);
+        }
+    }
+
+    void MinMax(float* v_min, float* v_max) const { ExtPlotMinMax(Values, Count, Stride, v_min, v_max); }
+};
+
+template <typename TSource>
+int ExtPlot(const TSource& source, int plotType, const char* label, int (*get_tooltip)(void* data, int idx, char* buffer), void* data, int values_count, const char* overlay_text, float scale_min, float scale_max, float size_x, float size_y)
 {
     using namespace ImGui;
     ImGuiContext& g = *GImGui;
@@ -133,16 +300,8 @@ CIMGUI_API int igExtPlot(int plotType, const char* label, float (*values_getter)
     // Determine scale from values if not specified
     if (scale_min == FLT_MAX || scale_max == FLT_MAX)
     {
-        float v_min = FLT_MAX;
-        float v_max = -FLT_MAX;
-        for (int i = 0; i < values_count; i++)
-        {
-            const float v = values_getter(data, i);
-            if (v != v) // Ignore NaN values
-                continue;
-            v_min = ImMin(v_min, v);
-            v_max = ImMax(v_max, v);
-        }
+        float v_min, v_max;
+        source.MinMax(&v_min, &v_max);
         if (scale_min == FLT_MAX)
             scale_min = v_min;
         if (scale_max == FLT_MAX)
@@ -162,7 +321,7 @@ CIMGUI_API int igExtPlot(int plotType, const char* label, float (*values_getter)
         if (hovered && inner_bb.Contains(g.IO.MousePos))
         {
             const float t = ImClamp((g.IO.MousePos.x - inner_bb.Min.x) / (inner_bb.Max.x - inner_bb.Min.x), 0.0f, 0.9999f);
-            const int v_idx = (int)(t * item_count);
+            const int v_idx = source.HoverIndex(t, item_count);
             IM_ASSERT(v_idx >= 0 && v_idx < values_count);
 
             if(get_tooltip) {
@@ -171,8 +330,8 @@ CIMGUI_API int igExtPlot(int plotType, const char* label, float (*values_getter)
                     SetTooltip("%s", tooltipBuffer);
                 }
             } else {
-                const float v0 = values_getter(data, (v_idx + values_offset) % values_count);
-                const float v1 = values_getter(data, (v_idx + 1 + values_offset) % values_count);
+                const float v0 = source.Value(v_idx);
+                const float v1 = source.Value(v_idx + 1);
                 if (plot_type == ImGuiPlotType_Lines)
                     SetTooltip("%d: %8.4g\n%d: %8.4g", v_idx, v0, v_idx + 1, v1);
                 else if (plot_type == ImGuiPlotType_Histogram)
@@ -184,7 +343,7 @@ CIMGUI_API int igExtPlot(int plotType, const char* label, float (*values_getter)
         const float t_step = 1.0f / (float)res_w;
         const float inv_scale = (scale_min == scale_max) ? 0.0f : (1.0f / (scale_max - scale_min));
 
-        float v0 = values_getter(data, (0 + values_offset) % values_count);
+        float v0 = source.Value(0);
         float t0 = 0.0f;
         ImVec2 tp0 = ImVec2( t0, 1.0f - ImSaturate((v0 - scale_min) * inv_scale) );                       // Point in the normalized space of our target rectangle
         float histogram_zero_line_t = (scale_min * scale_max < 0.0f) ? (1 + scale_min * inv_scale) : (scale_min < 0.0f ? 0.0f : 1.0f);   // Where does the zero line stands
@@ -192,30 +351,57 @@ CIMGUI_API int igExtPlot(int plotType, const char* label, float (*values_getter)
         const ImU32 col_base = GetColorU32((plot_type == ImGuiPlotType_Lines) ? ImGuiCol_PlotLines : ImGuiCol_PlotHistogram);
         const ImU32 col_hovered = GetColorU32((plot_type == ImGuiPlotType_Lines) ? ImGuiCol_PlotLinesHovered : ImGuiCol_PlotHistogramHovered);
 
-        for (int n = 0; n < res_w; n++)
+        // More samples than pixels: each column draws the span between its min and max, so spikes
+        // are not lost between sampled indices, joined to its neighbours through its first and last values
+        if (plot_type == ImGuiPlotType_Lines && values_count > 2 * res_w)
         {
-            const float t1 = t0 + t_step;
-            const int v1_idx = (int)(t0 * item_count + 0.5f);
-            IM_ASSERT(v1_idx >= 0 && v1_idx < values_count);
-            const float v1 = values_getter(data, (v1_idx + values_offset + 1) % values_count);
-            const ImVec2 tp1 = ImVec2( t1, 1.0f - ImSaturate((v1 - scale_min) * inv_scale) );
-
-            // NB: Draw calls are merged together by the DrawList system. Still, we should render our batch are lower level to save a bit of CPU.
-            ImVec2 pos0 = ImLerp(inner_bb.Min, inner_bb.Max, tp0);
-            ImVec2 pos1 = ImLerp(inner_bb.Min, inner_bb.Max, (plot_type == ImGuiPlotType_Lines) ? tp1 : ImVec2(tp1.x, histogram_zero_line_t));
-            if (plot_type == ImGuiPlotType_Lines)
+            auto to_pos = [&](float t, float v) { return ImLerp(inner_bb.Min, inner_bb.Max, ImVec2(t, 1.0f - ImSaturate((v - scale_min) * inv_scale))); };
+            ImVec2 prev = to_pos(0.0f, v0);
+            int i0 = 0;
+            for (int n = 0; n < res_w; n++)
             {
-                window->DrawList->AddLine(pos0, pos1, idx_hovered == v1_idx ? col_hovered : col_base);
+                const int i1 = (n == res_w - 1) ? values_count : ImClamp(source.ColumnStart((float)(n + 1) / res_w), i0, values_count);
+                if (i1 == i0)
+                    continue;
+                const float t = ((float)n + 0.5f) * t_step;
+                const ImU32 col = (idx_hovered >= i0 && idx_hovered < i1) ? col_hovered : col_base;
+                float v_min, v_max;
+                source.RangeMinMax(i0, i1, &v_min, &v_max);
+
+                window->DrawList->AddLine(prev, to_pos(t, source.Value(i0)), col);
+                if (v_min < v_max)
+                    window->DrawList->AddLine(to_pos(t, v_min), to_pos(t, v_max), col);
+                prev = to_pos(t, source.Value(i1 - 1));
+                i0 = i1;
             }
-            else if (plot_type == ImGuiPlotType_Histogram)
+        }
+        else
+        {
+            for (int n = 0; n < res_w; n++)
             {
-                if (pos1.x >= pos0.x + 2.0f)
-                    pos1.x -= 1.0f;
-                window->DrawList->AddRectFilled(pos0, pos1, idx_hovered == v1_idx ? col_hovered : col_base);
-            }
+                const float t1 = t0 + t_step;
+                const int v1_idx = source.ColumnIndex(t0, t1, item_count);
+                IM_ASSERT(v1_idx >= 0 && v1_idx < values_count);
+                const float v1 = source.Value(v1_idx + 1);
+                const ImVec2 tp1 = ImVec2( t1, 1.0f - ImSaturate((v1 - scale_min) * inv_scale) );
+
+                // NB: Draw calls are merged together by the DrawList system. Still, we should render our batch are lower level to save a bit of CPU.
+                ImVec2 pos0 = ImLerp(inner_bb.Min, inner_bb.Max, tp0);
+                ImVec2 pos1 = ImLerp(inner_bb.Min, inner_bb.Max, (plot_type == ImGuiPlotType_Lines) ? tp1 : ImVec2(tp1.x, histogram_zero_line_t));
+                if (plot_type == ImGuiPlotType_Lines)
+                {
+                    window->DrawList->AddLine(pos0, pos1, idx_hovered == v1_idx ? col_hovered : col_base);
+                }
+                else if (plot_type == ImGuiPlotType_Histogram)
+                {
+                    if (pos1.x >= pos0.x + 2.0f)
+                        pos1.x -= 1.0f;
+                    window->DrawList->AddRectFilled(pos0, pos1, idx_hovered == v1_idx ? col_hovered : col_base);
+                }
 
-            t0 = t1;
-            tp0 = tp1;
+                t0 = t1;
+                tp0 = tp1;
+            }
         }
     }
 
@@ -230,3 +416,17 @@ CIMGUI_API int igExtPlot(int plotType, const char* label, float (*values_getter)
     // This is currently not exposed in the public API because we need a larger redesign of the whole thing, but in the short-term we are making it available in PlotEx().
     return idx_hovered;
 }
+
+}
+
+CIMGUI_API int igExtPlot(int plotType, const char* label, float (*values_getter)(void* data, int idx), int (*get_tooltip)(void* data, int idx, char* buffer), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, float size_x, float size_y)
+{
+    const PlotGetterSource source = { values_getter, data, values_count, values_offset };
+    return ExtPlot(source, plotType, label, get_tooltip, data, values_count, overlay_text, scale_min, scale_max, size_x, size_y);
+}
+
+CIMGUI_API int igExtPlotArray(int plotType, const char* label, const float* values, const float* xs, int values_count, int values_offset, int stride, int (*get_tooltip)(void* data, int idx, char* buffer), void* data, const char* overlay_text, float scale_min, float scale_max, float size_x, float size_y)
+{
+    const PlotArraySource source = { values, xs, values_count, values_offset, stride > 0 ? stride : (int)sizeof(float) };
+    return ExtPlot(source, plotType, label, get_tooltip, data, values_count, overlay_text, scale_min, scale_max, size_x, size_y);
+}
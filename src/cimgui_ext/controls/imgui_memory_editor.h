@@ -62,6 +62,14 @@
 
 #include <stdio.h>      // sprintf, scanf
 #include <stdint.h>     // uint8_t, etc.
+#include <stdlib.h>     // strtod, strtoll
+
+// Vector paths for search and diff
+#include "simd_ext.h"
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>     // _BitScanForward64
+#endif
 
 #if defined(_MSC_VER) && !defined(snprintf)
 #define ImSnprintf  _snprintf
@@ -89,6 +97,84 @@ struct MemoryEditor
         DataFormat_COUNT
     };
 
+    enum SearchFormat
+    {
+        SearchFormat_Hex = 0,       // "DE AD ?? EF", '?' is a wildcard nibble
+        SearchFormat_String = 1,    // "ab?d", '?' is a wildcard byte, '\' escapes the next character
+        SearchFormat_Value = 2,     // a number encoded as SearchDataType with the preview endianness
+        SearchFormat_COUNT
+    };
+
+    enum SearchStatus
+    {
+        SearchStatus_None = 0,
+        SearchStatus_Invalid,
+        SearchStatus_NotFound,
+        SearchStatus_Found,
+        SearchStatus_Results
+    };
+
+    enum Mark
+    {
+        Mark_Diff = 1 << 0,
+        Mark_SearchResult = 1 << 1
+    };
+
+    enum FieldFlags
+    {
+        FieldFlags_None = 0,
+        FieldFlags_String = 1 << 0,     // display a S8/U8 array as text up to the first null
+        FieldFlags_Hex = 1 << 1         // display integers in hexadecimal
+    };
+
+    // Struct templates laid over the hex view
+    struct StructField
+    {
+        char            Name[32];
+        ImGuiDataType   Type;
+        size_t          Offset;         // from the start of the struct
+        int             Count;          // array length, 1 for a scalar
+        int             Flags;          // FieldFlags
+    };
+
+    struct StructTemplate
+    {
+        char            Name[32];
+        size_t          Size;
+        ImVector<StructField> Fields;
+    };
+
+    struct StructOverlay
+    {
+        int             Struct;         // index into Structs
+        size_t          Addr;
+        size_t          Count;          // consecutive elements
+    };
+
+    struct StructFieldRef
+    {
+        int             Overlay;
+        int             Field;
+        size_t          Element;
+    };
+
+    // Field of each byte in one page of the address space. Only depends on the templates and overlays, not the data.
+    struct AnnotationPage
+    {
+        size_t          Index;
+        int             Generation;
+        ImU64           LastUse;
+        ImVector<ImU16> Slots;          // 0 = no field, otherwise Refs[slot - 1]
+        ImVector<StructFieldRef> Refs;
+    };
+
+    static const int AnnotationPageSize = 4096;
+    static const int AnnotationPageCount = 4;
+    static const int StructInspectorLines = 6;
+    static const int SearchMaxResults = 65536;
+    static const int SearchChunkSize = 1 << 16;                 // bytes read at a time when searching through ReadFn/ReadRangeFn
+    static const int SearchResultsLines = 6;
+
     // Settings
     bool            Open;                                       // = true   // set to false when DrawWindow() was closed. ignore if not using DrawWindow().
     bool            ReadOnly;                                   // = false  // disable any editing.
@@ -103,12 +189,20 @@ struct MemoryEditor
     int             OptAddrDigitsCount;                         // = 0      // number of addr digits to display (default calculated based on maximum displayed addr).
     float           OptFooterExtraHeight;                       // = 0      // space to reserve at the bottom of the widget to add custom widgets
     ImU32           HighlightColor;                             //          // background color of highlighted bytes.
+    bool            OptShowSearch;                              // = true   // display the search line below the options line.
+    ImU32           DiffColor;                                  //          // background color of bytes differing from DiffData.
+    ImU32           SearchResultColor;                          //          // background color of bytes inside a search result.
+    const ImU8*     DiffData;                                   // = NULL   // optional reference buffer, bytes that differ from it are highlighted. only read by DrawContents().
+    size_t          DiffSize;                                   // = 0      // size of DiffData, bytes past it always differ.
+    bool            OptShowStructInspector;                     // = true   // display the decoded fields of the struct under the cursor.
+    ImU32           StructFieldColors[2];                       //          // background colors of struct fields, alternating.
 
     // Function handlers
     ImU8            (*ReadFn)(const ImU8* mem, size_t off, void* user_data);      // = 0      // optional handler to read bytes.
     void            (*WriteFn)(ImU8* mem, size_t off, ImU8 d, void* user_data);   // = 0      // optional handler to write bytes.
     bool            (*HighlightFn)(const ImU8* mem, size_t off, void* user_data); // = 0      // optional handler to return Highlight property (to support non-contiguous highlighting).
     ImU32           (*BgColorFn)(const ImU8* mem, size_t off, void* user_data);   // = 0      // optional handler to return custom background color of individual bytes.
+    void            (*ReadRangeFn)(const ImU8* mem, size_t off, ImU8* out, size_t size, void* user_data); // = 0 // optional handler to read a range of bytes, used by search. falls back to ReadFn.
     void*           UserData;                                                     // = NULL   // user data forwarded to the function handlers
 
     // Public read-only data
@@ -126,6 +220,24 @@ struct MemoryEditor
     size_t          HighlightMin, HighlightMax;
     int             PreviewEndianness;
     ImGuiDataType   PreviewDataType;
+    SearchFormat    SearchFmt;
+    ImGuiDataType   SearchDataType;
+    SearchStatus    SearchState;
+    char            SearchInputBuf[128];
+    ImVector<ImU8>  SearchPattern;                              // pre-masked pattern bytes
+    ImVector<ImU8>  SearchMask;                                 // bits that must match, 0x00 = wildcard byte
+    ImVector<size_t> SearchResults;                             // ascending match addresses from Find All
+    ImVector<ImU8>  SearchChunk;
+    size_t          SearchCursor;                               // last match selected or found
+    size_t          SearchDataSize;                             // mem_size the results were computed for
+    ImVector<ImU8>  VisibleMarks;                               // Mark flags of the rows in the current clipper step
+    size_t          VisibleMarksAddr;
+    ImVector<ImU8>  VisibleBytes;                               // rows of the current clipper step read through ReadFn/ReadRangeFn
+    ImVector<StructTemplate*> Structs;
+    ImVector<StructOverlay> StructOverlays;
+    int             StructGeneration;                           // bumped when templates or overlays change
+    AnnotationPage  AnnotationPages[AnnotationPageCount];       // LRU cache
+    ImU64           AnnotationClock;
 
     MemoryEditor()
     {
@@ -143,10 +255,19 @@ struct MemoryEditor
         OptAddrDigitsCount = 0;
         OptFooterExtraHeight = 0.0f;
         HighlightColor = IM_COL32(255, 255, 255, 50);
+        OptShowSearch = true;
+        DiffColor = IM_COL32(255, 80, 80, 90);
+        SearchResultColor = IM_COL32(255, 200, 0, 70);
+        DiffData = nullptr;
+        DiffSize = 0;
+        OptShowStructInspector = true;
+        StructFieldColors[0] = IM_COL32(80, 160, 255, 45);
+        StructFieldColors[1] = IM_COL32(80, 255, 160, 45);
         ReadFn = nullptr;
         WriteFn = nullptr;
         HighlightFn = nullptr;
         BgColorFn = nullptr;
+        ReadRangeFn = nullptr;
         UserData = nullptr;
 
         // State/Internals
@@ -161,6 +282,26 @@ struct MemoryEditor
         HighlightMin = HighlightMax = (size_t)-1;
         PreviewEndianness = 0;
         PreviewDataType = ImGuiDataType_S32;
+        SearchFmt = SearchFormat_Hex;
+        SearchDataType = ImGuiDataType_S32;
+        SearchState = SearchStatus_None;
+        memset(SearchInputBuf, 0, sizeof(SearchInputBuf));
+        SearchCursor = (size_t)-1;
+        SearchDataSize = 0;
+        VisibleMarksAddr = 0;
+        StructGeneration = 0;
+        AnnotationClock = 0;
+        for (int i = 0; i < AnnotationPageCount; i++)
+        {
+            AnnotationPages[i].Index = (size_t)-1;
+            AnnotationPages[i].Generation = -1;
+            AnnotationPages[i].LastUse = 0;
+        }
+    }
+
+    ~MemoryEditor()
+    {
+        ClearStructs();
     }
 
     void GotoAddrAndHighlight(size_t addr_min, size_t addr_max)
@@ -252,6 +393,18 @@ struct MemoryEditor
             footer_height += height_separator + ImGui::GetFrameHeightWithSpacing() * 1;
         if (OptShowDataPreview)
             footer_height += height_separator + ImGui::GetFrameHeightWithSpacing() * 1 + ImGui::GetTextLineHeightWithSpacing() * 3;
+        if (OptShowSearch)
+        {
+            footer_height += height_separator + ImGui::GetFrameHeightWithSpacing() * 1;
+            if (SearchResults.Size > 0)
+                footer_height += ImGui::GetTextLineHeightWithSpacing() * SearchResultsLines + style.ItemSpacing.y;
+        }
+        int inspector_overlay = -1;
+        size_t inspector_element = 0;
+        if (OptShowStructInspector && DataPreviewAddr < mem_size)
+            inspector_overlay = FindOverlayAt(DataPreviewAddr, &inspector_element);
+        if (inspector_overlay != -1)
+            footer_height += height_separator + ImGui::GetTextLineHeightWithSpacing() * (StructInspectorLines + 1) + style.ItemSpacing.y;
         ImGui::BeginChild("##scrolling", ImVec2(-FLT_MIN, -footer_height), ImGuiChildFlags_None, ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoNav);
         ImDrawList* draw_list = ImGui::GetWindowDrawList();
 
@@ -269,6 +422,11 @@ struct MemoryEditor
             DataEditingAddr = (size_t)-1;
         if (DataPreviewAddr >= mem_size)
             DataPreviewAddr = (size_t)-1;
+        if (SearchDataSize != mem_size)
+        {
+            SearchClear();
+            SearchDataSize = mem_size;
+        }
 
         size_t preview_data_type_size = OptShowDataPreview ? DataTypeGetSize(PreviewDataType) : 0;
 
@@ -299,6 +457,9 @@ struct MemoryEditor
         MouseHoveredAddr = 0;
 
         while (clipper.Step())
+        {
+            const size_t step_end = (size_t)clipper.DisplayEnd * Cols;
+            UpdateVisibleMarks(mem_data, (size_t)clipper.DisplayStart * Cols, step_end < mem_size ? step_end : mem_size);
             for (int line_i = clipper.DisplayStart; line_i < clipper.DisplayEnd; line_i++) // display only visible lines
             {
                 size_t addr = (size_t)line_i * Cols;
@@ -317,6 +478,8 @@ struct MemoryEditor
                     const bool is_highlight_from_user_func = (HighlightFn && HighlightFn(mem_data, addr, UserData));
                     const bool is_highlight_from_preview = (addr >= DataPreviewAddr && addr < DataPreviewAddr + preview_data_type_size);
 
+                    const ImU8 mark = GetVisibleMark(addr);
+
                     ImU32 bg_color = 0;
                     bool is_next_byte_highlighted = false;
                     if (is_highlight_from_user_range || is_highlight_from_user_func || is_highlight_from_preview)
@@ -324,6 +487,16 @@ struct MemoryEditor
                         is_next_byte_highlighted = (addr + 1 < mem_size) && ((HighlightMax != (size_t)-1 && addr + 1 < HighlightMax) || (HighlightFn && HighlightFn(mem_data, addr + 1, UserData)) || (addr + 1 < DataPreviewAddr + preview_data_type_size));
                         bg_color = HighlightColor;
                     }
+                    else if (mark != 0)
+                    {
+                        is_next_byte_highlighted = (addr + 1 < mem_size) && GetVisibleMark(addr + 1) == mark;
+                        bg_color = (mark & Mark_Diff) ? DiffColor : SearchResultColor;
+                    }
+                    else if (const StructFieldRef* field = GetStructField(addr))
+                    {
+                        is_next_byte_highlighted = (addr + 1 < mem_size) && GetStructField(addr + 1) == field;
+                        bg_color = StructFieldColors[(field->Field + field->Element) & 1];
+                    }
                     else if (BgColorFn != nullptr)
                     {
                         is_next_byte_highlighted = (addr + 1 < mem_size) && ((BgColorFn(mem_data, addr + 1, UserData) & IM_COL32_A_MASK) != 0);
@@ -404,6 +577,7 @@ struct MemoryEditor
                                 WriteFn(mem_data, addr, (ImU8)data_input_value, UserData);
                             else
                                 mem_data[addr] = (ImU8)data_input_value;
+                            SearchClear(); // results may no longer match
                         }
                         if (ImGui::IsItemHovered())
                         {
@@ -477,6 +651,14 @@ struct MemoryEditor
                             draw_list->AddRectFilled(pos, ImVec2(pos.x + s.GlyphWidth, pos.y + s.LineHeight), ImGui::GetColorU32(ImGuiCol_FrameBg));
                             draw_list->AddRectFilled(pos, ImVec2(pos.x + s.GlyphWidth, pos.y + s.LineHeight), ImGui::GetColorU32(ImGuiCol_TextSelectedBg));
                         }
+                        else if (const ImU8 mark = GetVisibleMark(addr))
+                        {
+                            draw_list->AddRectFilled(pos, ImVec2(pos.x + s.GlyphWidth, pos.y + s.LineHeight), (mark & Mark_Diff) ? DiffColor : SearchResultColor);
+                        }
+                        else if (const StructFieldRef* field = GetStructField(addr))
+                        {
+                            draw_list->AddRectFilled(pos, ImVec2(pos.x + s.GlyphWidth, pos.y + s.LineHeight), StructFieldColors[(field->Field + field->Element) & 1]);
+                        }
                         else if (BgColorFn)
                         {
                             draw_list->AddRectFilled(pos, ImVec2(pos.x + s.GlyphWidth, pos.y + s.LineHeight), BgColorFn(mem_data, addr, UserData));
@@ -488,7 +670,21 @@ struct MemoryEditor
                     }
                 }
             }
+        }
         ImGui::PopStyleVar(2);
+
+        if (MouseHovered)
+            if (const StructFieldRef* field = GetStructField(MouseHoveredAddr))
+            {
+                char value[256];
+                FormatStructField(*field, mem_data, mem_size, value, IM_ARRAYSIZE(value));
+                const StructTemplate& tmpl = *Structs[StructOverlays[field->Overlay].Struct];
+                ImGui::BeginTooltip();
+                ImGui::Text("%s[%" _PRISizeT "u].%s", tmpl.Name, field->Element, tmpl.Fields[field->Field].Name);
+                ImGui::TextUnformatted(value);
+                ImGui::EndTooltip();
+            }
+
         const float child_width = ImGui::GetWindowSize().x;
         ImGui::EndChild();
 
@@ -522,6 +718,18 @@ struct MemoryEditor
             DrawPreviewLine(s, mem_data, mem_size, base_display_addr);
         }
 
+        if (OptShowSearch)
+        {
+            ImGui::Separator();
+            DrawSearchLine(s, mem_data, mem_size, base_display_addr);
+        }
+
+        if (inspector_overlay != -1)
+        {
+            ImGui::Separator();
+            DrawStructInspector(s, mem_data, mem_size, base_display_addr, inspector_overlay, inspector_element);
+        }
+
         const ImVec2 contents_pos_end(contents_pos_start.x + child_width, ImGui::GetCursorScreenPos().y);
         //ImGui::GetForegroundDrawList()->AddRect(contents_pos_start, contents_pos_end, IM_COL32(255, 0, 0, 255));
         if (OptShowOptions)
@@ -627,6 +835,636 @@ struct MemoryEditor
         ImGui::Text("Bin"); ImGui::SameLine(x); ImGui::TextUnformatted(has_value ? buf : "N/A");
     }
 
+    void DrawSearchLine(const Sizes& s, ImU8* mem_data, size_t mem_size, size_t base_display_addr)
+    {
+        ImGuiStyle& style = ImGui::GetStyle();
+        const char* format_result = OptUpperCaseHex ? "%0*" _PRISizeT "X" : "%0*" _PRISizeT "x";
+        ImGui::AlignTextToFramePadding();
+        ImGui::Text("Find:");
+        ImGui::SameLine();
+        ImGui::SetNextItemWidth((s.GlyphWidth * 10.0f) + style.FramePadding.x * 2.0f + style.ItemInnerSpacing.x);
+
+        static const ImGuiDataType supported_data_types[] = { ImGuiDataType_S8, ImGuiDataType_U8, ImGuiDataType_S16, ImGuiDataType_U16, ImGuiDataType_S32, ImGuiDataType_U32, ImGuiDataType_S64, ImGuiDataType_U64, ImGuiDataType_Float, ImGuiDataType_Double };
+        if (ImGui::BeginCombo("##search_type", SearchFmt == SearchFormat_Value ? DataTypeGetDesc(SearchDataType) : SearchFmt == SearchFormat_Hex ? "Hex" : "String", ImGuiComboFlags_HeightLargest))
+        {
+            if (ImGui::Selectable("Hex", SearchFmt == SearchFormat_Hex)) { SearchFmt = SearchFormat_Hex; SearchClear(); }
+            if (ImGui::Selectable("String", SearchFmt == SearchFormat_String)) { SearchFmt = SearchFormat_String; SearchClear(); }
+            for (int n = 0; n < IM_ARRAYSIZE(supported_data_types); n++)
+            {
+                ImGuiDataType data_type = supported_data_types[n];
+                if (ImGui::Selectable(DataTypeGetDesc(data_type), SearchFmt == SearchFormat_Value && SearchDataType == data_type))
+                {
+                    SearchFmt = SearchFormat_Value;
+                    SearchDataType = data_type;
+                    SearchClear();
+                }
+            }
+            ImGui::EndCombo();
+        }
+        ImGui::SameLine();
+        ImGui::SetNextItemWidth(s.GlyphWidth * 24.0f + style.FramePadding.x * 2.0f);
+        bool find_next = ImGui::InputText("##search", SearchInputBuf, IM_ARRAYSIZE(SearchInputBuf), ImGuiInputTextFlags_EnterReturnsTrue);
+        if (ImGui::IsItemEdited())
+            SearchClear();
+        ImGui::SameLine();
+        find_next |= ImGui::Button("Next");
+        ImGui::SameLine();
+        const bool find_all = ImGui::Button("All");
+
+        if (find_next || find_all)
+        {
+            if (!ParseSearchQuery())
+                SearchState = SearchStatus_Invalid;
+            else if (find_all)
+                SearchFindAll(mem_data, mem_size);
+            else
+                SearchFindNext(mem_data, mem_size);
+        }
+
+        if (SearchState == SearchStatus_Invalid)
+        {
+            ImGui::SameLine();
+            ImGui::TextDisabled("Invalid pattern");
+        }
+        else if (SearchState == SearchStatus_NotFound)
+        {
+            ImGui::SameLine();
+            ImGui::TextDisabled("Not found");
+        }
+        else if (SearchState == SearchStatus_Results)
+        {
+            ImGui::SameLine();
+            ImGui::Text(SearchResults.Size >= SearchMaxResults ? "%d+ results" : "%d results", SearchResults.Size);
+        }
+
+        if (SearchResults.Size > 0)
+        {
+            const size_t pattern_size = (size_t)SearchPattern.Size;
+            ImGui::BeginChild("##search_results", ImVec2(-FLT_MIN, ImGui::GetTextLineHeightWithSpacing() * SearchResultsLines), ImGuiChildFlags_None, ImGuiWindowFlags_None);
+            ImGuiListClipper clipper;
+            clipper.Begin(SearchResults.Size);
+            while (clipper.Step())
+                for (int n = clipper.DisplayStart; n < clipper.DisplayEnd; n++)
+                {
+                    const size_t addr = SearchResults[n];
+                    char label[32];
+                    ImSnprintf(label, IM_ARRAYSIZE(label), format_result, s.AddrDigitsCount, base_display_addr + addr);
+                    ImGui::PushID(n);
+                    if (ImGui::Selectable(label, SearchCursor == addr))
+                    {
+                        SearchCursor = addr;
+                        GotoAddrAndHighlight(addr, addr + pattern_size);
+                    }
+                    ImGui::PopID();
+                }
+            ImGui::EndChild();
+        }
+    }
+
+    void DrawStructInspector(const Sizes& s, ImU8* mem_data, size_t mem_size, size_t base_display_addr, int overlay_index, size_t element)
+    {
+        const StructOverlay& overlay = StructOverlays[overlay_index];
+        const StructTemplate& tmpl = *Structs[overlay.Struct];
+        const size_t struct_addr = overlay.Addr + element * tmpl.Size;
+        const char* format_addr = OptUpperCaseHex ? "%s[%" _PRISizeT "u] at %0*" _PRISizeT "X" : "%s[%" _PRISizeT "u] at %0*" _PRISizeT "x";
+        ImGui::Text(format_addr, tmpl.Name, element, s.AddrDigitsCount, base_display_addr + struct_addr);
+        ImGui::BeginChild("##struct_inspector", ImVec2(-FLT_MIN, ImGui::GetTextLineHeightWithSpacing() * StructInspectorLines), ImGuiChildFlags_None, ImGuiWindowFlags_None);
+        ImGuiListClipper clipper;
+        clipper.Begin(tmpl.Fields.Size);
+        while (clipper.Step())
+            for (int n = clipper.DisplayStart; n < clipper.DisplayEnd; n++)
+            {
+                const StructField& field = tmpl.Fields[n];
+                StructFieldRef ref;
+                ref.Overlay = overlay_index;
+                ref.Field = n;
+                ref.Element = element;
+                char value[256];
+                FormatStructField(ref, mem_data, mem_size, value, IM_ARRAYSIZE(value));
+                ImGui::PushID(n);
+                const size_t field_addr = struct_addr + field.Offset;
+                if (ImGui::Selectable(field.Name, DataPreviewAddr >= field_addr && DataPreviewAddr < field_addr + StructFieldSize(field)))
+                    GotoAddrAndHighlight(field_addr, field_addr + StructFieldSize(field));
+                ImGui::SameLine(s.GlyphWidth * 20.0f);
+                ImGui::TextUnformatted(value);
+                ImGui::PopID();
+            }
+        ImGui::EndChild();
+    }
+
+    // Struct templates and overlays.
+    // Field annotations are computed per page of address space on demand and cached, so only visible pages are decoded.
+    int AddStruct(const char* name, size_t size)
+    {
+        StructTemplate* tmpl = IM_NEW(StructTemplate)();
+        ImSnprintf(tmpl->Name, IM_ARRAYSIZE(tmpl->Name), "%s", name);
+        tmpl->Size = size;
+        Structs.push_back(tmpl);
+        StructGeneration++;
+        return Structs.Size - 1;
+    }
+
+    void AddStructField(int struct_index, const char* name, ImGuiDataType type, size_t offset, int count, int flags)
+    {
+        IM_ASSERT(struct_index >= 0 && struct_index < Structs.Size);
+        IM_ASSERT(type >= 0 && type <= ImGuiDataType_Double); // scalar types only
+        StructField field;
+        ImSnprintf(field.Name, IM_ARRAYSIZE(field.Name), "%s", name);
+        field.Type = type;
+        field.Offset = offset;
+        field.Count = count < 1 ? 1 : count;
+        field.Flags = flags;
+        Structs[struct_index]->Fields.push_back(field);
+        StructGeneration++;
+    }
+
+    void AddStructOverlay(int struct_index, size_t addr, size_t count)
+    {
+        IM_ASSERT(struct_index >= 0 && struct_index < Structs.Size);
+        StructOverlay overlay;
+        overlay.Struct = struct_index;
+        overlay.Addr = addr;
+        overlay.Count = count;
+        StructOverlays.push_back(overlay);
+        StructGeneration++;
+    }
+
+    void ClearStructOverlays()
+    {
+        StructOverlays.clear();
+        StructGeneration++;
+    }
+
+    void ClearStructs()
+    {
+        for (int i = 0; i < Structs.Size; i++)
+            IM_DELETE(Structs[i]);
+        Structs.clear();
+        ClearStructOverlays();
+    }
+
+    size_t StructFieldSize(const StructField& field) const
+    {
+        return (field.Flags & FieldFlags_String) ? (size_t)field.Count : DataTypeGetSize(field.Type) * (size_t)field.Count;
+    }
+
+    // Returns the overlay containing addr, later overlays win. (-1 if none)
+    int FindOverlayAt(size_t addr, size_t* out_element) const
+    {
+        for (int n = StructOverlays.Size - 1; n >= 0; n--)
+        {
+            const StructOverlay& overlay = StructOverlays[n];
+            const size_t size = Structs[overlay.Struct]->Size;
+            if (size != 0 && addr >= overlay.Addr && (addr - overlay.Addr) / size < overlay.Count)
+            {
+                *out_element = (addr - overlay.Addr) / size;
+                return n;
+            }
+        }
+        return -1;
+    }
+
+    void BuildAnnotationPage(AnnotationPage& page, size_t index)
+    {
+        page.Index = index;
+        page.Generation = StructGeneration;
+        page.Slots.resize(AnnotationPageSize);
+        memset(page.Slots.Data, 0, sizeof(ImU16) * AnnotationPageSize);
+        page.Refs.resize(0);
+        const size_t page_begin = index * AnnotationPageSize;
+        const size_t page_end = page_begin + AnnotationPageSize;
+        for (int o = 0; o < StructOverlays.Size; o++)
+        {
+            const StructOverlay& overlay = StructOverlays[o];
+            const StructTemplate& tmpl = *Structs[overlay.Struct];
+            if (tmpl.Size == 0 || overlay.Addr >= page_end)
+                continue;
+            const size_t overlay_end = overlay.Addr + tmpl.Size * overlay.Count;
+            if (overlay_end <= page_begin)
+                continue;
+            // Only the elements that intersect this page
+            const size_t first = page_begin > overlay.Addr ? (page_begin - overlay.Addr) / tmpl.Size : 0;
+            const size_t last = ((page_end < overlay_end ? page_end : overlay_end) - overlay.Addr + tmpl.Size - 1) / tmpl.Size;
+            for (size_t e = first; e < last; e++)
+                for (int f = 0; f < tmpl.Fields.Size; f++)
+                {
+                    const size_t field_begin = overlay.Addr + e * tmpl.Size + tmpl.Fields[f].Offset;
+                    const size_t field_end = field_begin + StructFieldSize(tmpl.Fields[f]);
+                    const size_t begin = field_begin > page_begin ? field_begin : page_begin;
+                    const size_t end = field_end < page_end ? field_end : page_end;
+                    if (begin >= end)
+                        continue;
+                    if (page.Refs.Size == 0xFFFF)
+                        return;
+                    StructFieldRef ref;
+                    ref.Overlay = o;
+                    ref.Field = f;
+                    ref.Element = e;
+                    page.Refs.push_back(ref);
+                    const ImU16 slot = (ImU16)page.Refs.Size;
+                    for (size_t addr = begin; addr < end; addr++)
+                        page.Slots.Data[addr - page_begin] = slot;
+                }
+        }
+    }
+
+    const StructFieldRef* GetStructField(size_t addr)
+    {
+        if (StructOverlays.Size == 0 || addr == (size_t)-1)
+            return nullptr;
+        const size_t index = addr / AnnotationPageSize;
+        AnnotationPage* page = nullptr;
+        AnnotationPage* lru = &AnnotationPages[0];
+        for (int i = 0; i < AnnotationPageCount && page == nullptr; i++)
+        {
+            if (AnnotationPages[i].Index == index && AnnotationPages[i].Generation == StructGeneration)
+                page = &AnnotationPages[i];
+            else if (AnnotationPages[i].LastUse < lru->LastUse)
+                lru = &AnnotationPages[i];
+        }
+        if (page == nullptr)
+        {
+            page = lru;
+            BuildAnnotationPage(*page, index);
+        }
+        page->LastUse = ++AnnotationClock;
+        const ImU16 slot = page->Slots.Data[addr % AnnotationPageSize];
+        return slot != 0 ? &page->Refs.Data[slot - 1] : nullptr;
+    }
+
+    // Decodes a field instance to text, arrays show their first 8 elements
+    void FormatStructField(const StructFieldRef& ref, const ImU8* mem_data, size_t mem_size, char* out_buf, size_t out_buf_size) const
+    {
+        const StructOverlay& overlay = StructOverlays[ref.Overlay];
+        const StructTemplate& tmpl = *Structs[overlay.Struct];
+        const StructField& field = tmpl.Fields[ref.Field];
+        const size_t addr = overlay.Addr + ref.Element * tmpl.Size + field.Offset;
+        if (addr >= mem_size || StructFieldSize(field) > mem_size - addr)
+        {
+            ImSnprintf(out_buf, out_buf_size, "(out of range)");
+            return;
+        }
+        if (field.Flags & FieldFlags_String)
+        {
+            char text[64];
+            size_t n = 0;
+            for (; n < (size_t)field.Count && n < sizeof(text) - 1; n++)
+            {
+                const ImU8 c = ReadFn ? ReadFn(mem_data, addr + n, UserData) : mem_data[addr + n];
+                if (c == 0)
+                    break;
+                text[n] = (c < 32 || c >= 128) ? '.' : (char)c;
+            }
+            text[n] = 0;
+            const bool truncated = (n == sizeof(text) - 1 && n < (size_t)field.Count);
+            ImSnprintf(out_buf, out_buf_size, "\"%s\"%s", text, truncated ? "..." : "");
+            return;
+        }
+        const size_t elem_size = DataTypeGetSize(field.Type);
+        const int shown = field.Count < 8 ? field.Count : 8;
+        size_t len = 0;
+        out_buf[0] = 0;
+        for (int i = 0; i < shown && len + 1 < out_buf_size; i++)
+        {
+            char elem[72];
+            DrawPreviewData(addr + i * elem_size, mem_data, mem_size, field.Type, (field.Flags & FieldFlags_Hex) ? DataFormat_Hex : DataFormat_Dec, elem, sizeof(elem));
+            len += (size_t)ImSnprintf(out_buf + len, out_buf_size - len, i == 0 ? "%s" : ", %s", elem);
+        }
+        if (shown < field.Count && len + 1 < out_buf_size)
+            ImSnprintf(out_buf + len, out_buf_size - len, ", ... (%d)", field.Count);
+    }
+
+    // Search and diff utilities.
+    void SearchClear()
+    {
+        SearchResults.clear();
+        SearchCursor = (size_t)-1;
+        SearchState = SearchStatus_None;
+    }
+
+    static int HexDigitValue(char c)
+    {
+        if (c >= '0' && c <= '9') return c - '0';
+        if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+        if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+        return -1;
+    }
+
+    // Builds SearchPattern/SearchMask from SearchInputBuf
+    bool ParseSearchQuery()
+    {
+        SearchPattern.resize(0);
+        SearchMask.resize(0);
+        const char* p = SearchInputBuf;
+        if (SearchFmt == SearchFormat_Hex)
+        {
+            int nibbles = 0;
+            ImU8 value = 0, mask = 0;
+            for (; *p; p++)
+            {
+                if (*p == ' ' || *p == '\t' || *p == ',')
+                    continue;
+                const int v = HexDigitValue(*p);
+                if (v < 0 && *p != '?')
+                    return false;
+                value = (ImU8)((value << 4) | (v < 0 ? 0 : v));
+                mask = (ImU8)((mask << 4) | (v < 0 ? 0x0 : 0xF));
+                if (++nibbles % 2 == 0)
+                {
+                    SearchPattern.push_back(value);
+                    SearchMask.push_back(mask);
+                    value = mask = 0;
+                }
+            }
+            if (nibbles % 2 != 0)
+                return false;
+        }
+        else if (SearchFmt == SearchFormat_String)
+        {
+            for (; *p; p++)
+            {
+                const bool wildcard = (*p == '?');
+                if (*p == '\\' && p[1] != 0)
+                    p++;
+                SearchPattern.push_back(wildcard ? 0 : (ImU8)*p);
+                SearchMask.push_back(wildcard ? 0x00 : 0xFF);
+            }
+        }
+        else
+        {
+            ImU8 buf[8];
+            const size_t size = DataTypeGetSize(SearchDataType);
+            char* end = nullptr;
+            if (SearchDataType == ImGuiDataType_Float || SearchDataType == ImGuiDataType_Double)
+            {
+                const double v = strtod(p, &end);
+                const float f = (float)v;
+                if (SearchDataType == ImGuiDataType_Float)
+                    memcpy(buf, &f, sizeof(f));
+                else
+                    memcpy(buf, &v, sizeof(v));
+            }
+            else
+            {
+                // Signed and unsigned inputs share the two's complement encoding, truncated to the type size
+                const bool is_signed = (SearchDataType == ImGuiDataType_S8 || SearchDataType == ImGuiDataType_S16 || SearchDataType == ImGuiDataType_S32 || SearchDataType == ImGuiDataType_S64);
+                const ImU64 v = is_signed ? (ImU64)strtoll(p, &end, 0) : (ImU64)strtoull(p, &end, 0);
+                const ImU8 v8 = (ImU8)v;
+                const ImU16 v16 = (ImU16)v;
+                const ImU32 v32 = (ImU32)v;
+                memcpy(buf, size == 1 ? (const void*)&v8 : size == 2 ? (const void*)&v16 : size == 4 ? (const void*)&v32 : (const void*)&v, size);
+            }
+            if (end == p)
+                return false;
+            while (*end == ' ')
+                end++;
+            if (*end != 0)
+                return false;
+            ImU8 encoded[8];
+            EndiannessCopy(encoded, buf, size);
+            for (size_t i = 0; i < size; i++)
+            {
+                SearchPattern.push_back(encoded[i]);
+                SearchMask.push_back(0xFF);
+            }
+        }
+        for (int i = 0; i < SearchPattern.Size; i++)
+            SearchPattern[i] &= SearchMask[i];
+        return SearchPattern.Size > 0;
+    }
+
+    void ReadRange(const ImU8* mem_data, size_t off, ImU8* out, size_t size) const
+    {
+        if (ReadRangeFn)
+            ReadRangeFn(mem_data, off, out, size, UserData);
+        else if (ReadFn)
+            for (size_t i = 0; i < size; i++)
+                out[i] = ReadFn(mem_data, off + i, UserData);
+        else
+            memcpy(out, mem_data + off, size);
+    }
+
+    // Appends matches at or after start to out, up to max_results. Memory behind ReadFn/ReadRangeFn is read in chunks.
+    void SearchScan(const ImU8* mem_data, size_t mem_size, size_t start, ImVector<size_t>& out, int max_results)
+    {
+        const size_t len = (size_t)SearchPattern.Size;
+        if (len == 0 || len > mem_size)
+            return;
+        if (!ReadFn && !ReadRangeFn)
+        {
+            for (size_t addr = start; out.Size < max_results; addr++)
+            {
+                addr = FindPattern(mem_data, mem_size, SearchPattern.Data, SearchMask.Data, len, addr);
+                if (addr == (size_t)-1)
+                    break;
+                out.push_back(addr);
+            }
+            return;
+        }
+        // Chunks overlap by len - 1 bytes so matches across a boundary are found once, in the chunk they start in
+        SearchChunk.resize(SearchChunkSize + (int)len - 1);
+        for (size_t base = start; base + len <= mem_size && out.Size < max_results; base += SearchChunkSize)
+        {
+            const size_t size = (mem_size - base < (size_t)SearchChunk.Size) ? mem_size - base : (size_t)SearchChunk.Size;
+            ReadRange(mem_data, base, SearchChunk.Data, size);
+            for (size_t off = 0; out.Size < max_results; off++)
+            {
+                off = FindPattern(SearchChunk.Data, size, SearchPattern.Data, SearchMask.Data, len, off);
+                if (off == (size_t)-1)
+                    break;
+                out.push_back(base + off);
+            }
+        }
+    }
+
+    void SearchFindNext(const ImU8* mem_data, size_t mem_size)
+    {
+        size_t start = SearchCursor != (size_t)-1 ? SearchCursor + 1 : DataPreviewAddr != (size_t)-1 ? DataPreviewAddr : 0;
+        ImVector<size_t> found;
+        SearchScan(mem_data, mem_size, start, found, 1);
+        if (found.Size == 0 && start > 0)
+            SearchScan(mem_data, mem_size, 0, found, 1); // wrap around
+        if (found.Size == 0)
+        {
+            SearchState = SearchStatus_NotFound;
+            return;
+        }
+        if (SearchState != SearchStatus_Results)
+            SearchState = SearchStatus_Found;
+        SearchCursor = found[0];
+        GotoAddrAndHighlight(found[0], found[0] + (size_t)SearchPattern.Size);
+    }
+
+    void SearchFindAll(const ImU8* mem_data, size_t mem_size)
+    {
+        SearchResults.resize(0);
+        SearchScan(mem_data, mem_size, 0, SearchResults, SearchMaxResults);
+        SearchCursor = (size_t)-1;
+        SearchState = SearchResults.Size > 0 ? SearchStatus_Results : SearchStatus_NotFound;
+        if (SearchResults.Size > 0)
+        {
+            SearchCursor = SearchResults[0];
+            GotoAddrAndHighlight(SearchResults[0], SearchResults[0] + (size_t)SearchPattern.Size);
+        }
+    }
+
+    static int CountTrailingZeros(ImU64 v)
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        unsigned long r;
+        _BitScanForward64(&r, v);
+        return (int)r;
+#else
+        return __builtin_ctzll(v);
+#endif
+    }
+
+    static bool MatchAt(const ImU8* data, const ImU8* pattern, const ImU8* mask, size_t len)
+    {
+        for (size_t j = 0; j < len; j++)
+            if ((data[j] & mask[j]) != pattern[j])
+                return false;
+        return true;
+    }
+
+    // Returns the first offset >= start where (data & mask) == pattern, or (size_t)-1.
+    // Candidates are found 16 at a time by comparing the first and last exact bytes of the pattern, then verified.
+    static size_t FindPattern(const ImU8* data, size_t size, const ImU8* pattern, const ImU8* mask, size_t len, size_t start)
+    {
+        if (len == 0 || len > size)
+            return (size_t)-1;
+        const size_t last = size - len;
+        size_t first_exact = (size_t)-1, last_exact = 0;
+        for (size_t j = 0; j < len; j++)
+            if (mask[j] == 0xFF)
+            {
+                if (first_exact == (size_t)-1)
+                    first_exact = j;
+                last_exact = j;
+            }
+        size_t i = start;
+#if defined(IMGUI_EXT_SSE2)
+        if (first_exact != (size_t)-1)
+        {
+            const __m128i first = _mm_set1_epi8((char)pattern[first_exact]);
+            const __m128i last_b = _mm_set1_epi8((char)pattern[last_exact]);
+            for (; i + 16 <= last + 1; i += 16)
+            {
+                const __m128i eq_first = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(data + i + first_exact)), first);
+                const __m128i eq_last = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(data + i + last_exact)), last_b);
+                ImU64 bits = (ImU64)_mm_movemask_epi8(_mm_and_si128(eq_first, eq_last));
+                for (; bits != 0; bits &= bits - 1)
+                {
+                    const size_t k = i + (size_t)CountTrailingZeros(bits);
+                    if (MatchAt(data + k, pattern, mask, len))
+                        return k;
+                }
+            }
+        }
+#elif defined(IMGUI_EXT_NEON)
+        if (first_exact != (size_t)-1)
+        {
+            const uint8x16_t first = vdupq_n_u8(pattern[first_exact]);
+            const uint8x16_t last_b = vdupq_n_u8(pattern[last_exact]);
+            for (; i + 16 <= last + 1; i += 16)
+            {
+                const uint8x16_t eq = vandq_u8(vceqq_u8(vld1q_u8(data + i + first_exact), first), vceqq_u8(vld1q_u8(data + i + last_exact), last_b));
+                // 4 bits per byte
+                ImU64 bits = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0);
+                while (bits != 0)
+                {
+                    const int n = CountTrailingZeros(bits) >> 2;
+                    const size_t k = i + (size_t)n;
+                    if (MatchAt(data + k, pattern, mask, len))
+                        return k;
+                    bits &= ~((ImU64)0xF << (n * 4));
+                }
+            }
+        }
+#endif
+        for (; i <= last; i++)
+            if (MatchAt(data + i, pattern, mask, len))
+                return i;
+        return (size_t)-1;
+    }
+
+    // out[i] = Mark_Diff where a[i] != b[i]
+    static void DiffBytes(const ImU8* a, const ImU8* b, size_t n, ImU8* out)
+    {
+        size_t i = 0;
+#if defined(IMGUI_EXT_SSE2)
+        const __m128i diff = _mm_set1_epi8((char)Mark_Diff);
+        for (; i + 16 <= n; i += 16)
+        {
+            const __m128i eq = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(a + i)), _mm_loadu_si128((const __m128i*)(b + i)));
+            _mm_storeu_si128((__m128i*)(out + i), _mm_andnot_si128(eq, diff));
+        }
+#elif defined(IMGUI_EXT_NEON)
+        const uint8x16_t diff = vdupq_n_u8((ImU8)Mark_Diff);
+        for (; i + 16 <= n; i += 16)
+            vst1q_u8(out + i, vbicq_u8(diff, vceqq_u8(vld1q_u8(a + i), vld1q_u8(b + i))));
+#endif
+        for (; i < n; i++)
+            out[i] = a[i] != b[i] ? (ImU8)Mark_Diff : 0;
+    }
+
+    // Computes diff and search result marks for [addr_begin, addr_end), the rows of one clipper step
+    void UpdateVisibleMarks(const ImU8* mem_data, size_t addr_begin, size_t addr_end)
+    {
+        VisibleMarksAddr = addr_begin;
+        VisibleMarks.resize(0);
+        if ((DiffData == nullptr && SearchResults.Size == 0) || addr_end <= addr_begin)
+            return;
+        const size_t count = addr_end - addr_begin;
+        VisibleMarks.resize((int)count);
+        memset(VisibleMarks.Data, 0, count);
+
+        if (DiffData != nullptr)
+        {
+            const size_t diff_end = DiffSize < addr_begin ? addr_begin : DiffSize < addr_end ? DiffSize : addr_end;
+            if (ReadFn || ReadRangeFn)
+            {
+                VisibleBytes.resize((int)count);
+                ReadRange(mem_data, addr_begin, VisibleBytes.Data, diff_end - addr_begin);
+                DiffBytes(VisibleBytes.Data, DiffData + addr_begin, diff_end - addr_begin, VisibleMarks.Data);
+            }
+            else
+            {
+                DiffBytes(mem_data + addr_begin, DiffData + addr_begin, diff_end - addr_begin, VisibleMarks.Data);
+            }
+            for (size_t addr = diff_end; addr < addr_end; addr++)
+                VisibleMarks[(int)(addr - addr_begin)] = Mark_Diff;
+        }
+
+        if (SearchResults.Size > 0)
+        {
+            // First result that can overlap addr_begin
+            const size_t len = (size_t)SearchPattern.Size;
+            const size_t first = addr_begin >= len ? addr_begin - len + 1 : 0;
+            int lo = 0, hi = SearchResults.Size;
+            while (lo < hi)
+            {
+                const int mid = (lo + hi) / 2;
+                if (SearchResults[mid] < first)
+                    lo = mid + 1;
+                else
+                    hi = mid;
+            }
+            for (int n = lo; n < SearchResults.Size && SearchResults[n] < addr_end; n++)
+            {
+                const size_t match_end = SearchResults[n] + len;
+                for (size_t addr = SearchResults[n] < addr_begin ? addr_begin : SearchResults[n]; addr < match_end && addr < addr_end; addr++)
+                    VisibleMarks[(int)(addr - addr_begin)] |= Mark_SearchResult;
+            }
+        }
+    }
+
+    ImU8 GetVisibleMark(size_t addr) const
+    {
+        const size_t n = addr - VisibleMarksAddr; // wraps for addresses before the step
+        return n < (size_t)VisibleMarks.Size ? VisibleMarks.Data[n] : 0;
+    }
+
     // Utilities for Data Preview (since we don't access imgui_internal.h)
     // FIXME: This technically depends on ImGuiDataType order.
     const char* DataTypeGetDesc(ImGuiDataType data_type) const
@@ -828,6 +1666,8 @@ struct MemoryEditor
 
 #undef _PRISizeT
 #undef ImSnprintf
+#undef IMGUI_EXT_SSE2
+#undef IMGUI_EXT_NEON
 
 #ifdef _MSC_VER
 #pragma warning (pop)
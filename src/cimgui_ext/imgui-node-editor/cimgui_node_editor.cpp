@@ -35,6 +35,8 @@ typedef struct {
     axConfigLoadSettings loadSettings;
     axConfigSaveNodeSettings saveNodeSettings;
     axConfigLoadNodeSettings loadNodeSettings;
+    axConfigSaveSettingsBinary saveSettingsBinary;
+    axConfigLoadSettingsBinary loadSettingsBinary;
     axConfigSession beginSaveSession;
     axConfigSession endSaveSession;
     axNodeDraggedCallback nodeDraggedHook;
@@ -67,6 +69,18 @@ static size_t internal_loadNodeSettings(ed::NodeId nodeId, char* data, void* use
     return internalData->loadNodeSettings(PtrFromNode(nodeId), data, internalData->userPointer);
 }
 
+static bool internal_saveSettingsBinary(const char* data, size_t size, ed::SaveReasonFlags reason, void* userPointer)
+{
+    INTERNAL_DATA
+    return internalData->saveSettingsBinary(data, size, (axSaveReasonFlags)reason, internalData->userPointer) != 0;
+}
+
+static size_t internal_loadSettingsBinary(char* data, void* userPointer)
+{
+    INTERNAL_DATA
+    return internalData->loadSettingsBinary(data, internalData->userPointer);
+}
+
 static void internal_beginSaveSession(void* userPointer)
 {
     INTERNAL_DATA
@@ -223,6 +237,34 @@ CIMGUI_API void axConfig_set_LoadNodeSettings(axConfig *config, axConfigLoadNode
     cfg->LoadNodeSettings = loadNodeSettings ? &internal_loadNodeSettings : nullptr;
 }
 
+CIMGUI_API axConfigSaveSettingsBinary axConfig_get_SaveSettingsBinary(axConfig *config)
+{
+    ed::Config *cfg = (ed::Config*)config;
+    internalUserData *internalData = (internalUserData*)cfg->UserPointer;
+    return internalData->saveSettingsBinary;
+}
+CIMGUI_API void axConfig_set_SaveSettingsBinary(axConfig *config, axConfigSaveSettingsBinary saveSettingsBinary)
+{
+    ed::Config *cfg = (ed::Config*)config;
+    internalUserData *internalData = (internalUserData*)cfg->UserPointer;
+    internalData->saveSettingsBinary = saveSettingsBinary;
+    cfg->SaveSettingsBinary = saveSettingsBinary ? &internal_saveSettingsBinary : nullptr;
+}
+
+CIMGUI_API axConfigLoadSettingsBinary axConfig_get_LoadSettingsBinary(axConfig *config)
+{
+    ed::Config *cfg = (ed::Config*)config;
+    internalUserData *internalData = (internalUserData*)cfg->UserPointer;
+    return internalData->loadSettingsBinary;
+}
+CIMGUI_API void axConfig_set_LoadSettingsBinary(axConfig *config, axConfigLoadSettingsBinary loadSettingsBinary)
+{
+    ed::Config *cfg = (ed::Config*)config;
+    internalUserData *internalData = (internalUserData*)cfg->UserPointer;
+    internalData->loadSettingsBinary = loadSettingsBinary;
+    cfg->LoadSettingsBinary = loadSettingsBinary ? &internal_loadSettingsBinary : nullptr;
+}
+
 CIMGUI_API axNodeDraggedCallback axConfig_get_NodeDraggedHook(axConfig *config)
 {
     ed::Config *cfg = (ed::Config*)config;
@@ -460,6 +502,26 @@ CIMGUI_API void axEndNode()
     ed::EndNode();
 }
 
+CIMGUI_API int axIsNodeCulled(axNodeId nodeId)
+{
+    return ed::IsNodeCulled(NodeFromPtr(nodeId)) ? 1 : 0;
+}
+
+CIMGUI_API int axIsLodActive()
+{
+    return ed::IsLodActive() ? 1 : 0;
+}
+
+CIMGUI_API void axSetNodeTitle(const char* title)
+{
+    ed::SetNodeTitle(title);
+}
+
+CIMGUI_API void axSkipNodeContents()
+{
+    ed::SkipNodeContents();
+}
+
 CIMGUI_API int axBeginGroupHint(axNodeId nodeId)
 {
     return ed::BeginGroupHint(NodeFromPtr(nodeId)) ? 1 : 0;
@@ -638,6 +700,74 @@ CIMGUI_API float axGetNodeZPosition(axNodeId nodeId)
 {
     return ed::GetNodeZPosition(NodeFromPtr(nodeId));
 }
+
+static_assert(sizeof(axNodeId) == sizeof(ed::NodeId), "node ids are passed through as arrays");
+static_assert(sizeof(axVec2) == sizeof(ImVec2) && sizeof(axVec4) == sizeof(ImVec4), "vectors are passed through as arrays");
+
+CIMGUI_API void axSetNodePositions(const axNodeId* nodeIds, const axVec2* editorPositions, int count)
+{
+    ed::SetNodePositions((const ed::NodeId*)nodeIds, (const ImVec2*)editorPositions, count);
+}
+
+CIMGUI_API void axSetGroupSizes(const axNodeId* nodeIds, const axVec2* sizes, int count)
+{
+    ed::SetGroupSizes((const ed::NodeId*)nodeIds, (const ImVec2*)sizes, count);
+}
+
+CIMGUI_API void axGetNodePositions(const axNodeId* nodeIds, axVec2* positions, int count)
+{
+    ed::GetNodePositions((const ed::NodeId*)nodeIds, (ImVec2*)positions, count);
+}
+
+CIMGUI_API void axGetNodeSizes(const axNodeId* nodeIds, axVec2* sizes, int count)
+{
+    ed::GetNodeSizes((const ed::NodeId*)nodeIds, (ImVec2*)sizes, count);
+}
+
+CIMGUI_API int axGetNodeRects(axNodeId* nodeIds, axVec4* rects, int size, int visibleOnly)
+{
+    return ed::GetNodeRects((ed::NodeId*)nodeIds, (ImVec4*)rects, size, visibleOnly != 0);
+}
+
+static ed::LayoutOptions ToLayoutOptions(const axLayoutOptions* options)
+{
+    ed::LayoutOptions result;
+    if (options)
+    {
+        result.Mode                 = (ed::LayoutMode)options->Mode;
+        result.Spacing              = ToImVec2(options->Spacing);
+        result.ComponentSpacing     = options->ComponentSpacing;
+        result.SweepIterations      = options->SweepIterations;
+        result.OrderingTrials       = options->OrderingTrials;
+        result.ForceIterations      = options->ForceIterations;
+        result.MaxReversedEdgeRatio = options->MaxReversedEdgeRatio;
+        result.ThreadCount          = options->ThreadCount;
+    }
+    return result;
+}
+
+CIMGUI_API void axLayoutOptions_Init(axLayoutOptions* options)
+{
+    ed::LayoutOptions defaults;
+    options->Mode                 = (axLayoutMode)defaults.Mode;
+    options->Spacing              = FromImVec2(defaults.Spacing);
+    options->ComponentSpacing     = defaults.ComponentSpacing;
+    options->SweepIterations      = defaults.SweepIterations;
+    options->OrderingTrials       = defaults.OrderingTrials;
+    options->ForceIterations      = defaults.ForceIterations;
+    options->MaxReversedEdgeRatio = defaults.MaxReversedEdgeRatio;
+    options->ThreadCount          = defaults.ThreadCount;
+}
+
+CIMGUI_API void axAutoLayout(const axLayoutOptions* options)
+{
+    ed::AutoLayout(ToLayoutOptions(options));
+}
+
+CIMGUI_API void axAutoLayoutNodes(const axNodeId* nodeIds, int count, const axLayoutOptions* options)
+{
+    ed::AutoLayoutNodes((const ed::NodeId*)nodeIds, count, ToLayoutOptions(options));
+}
 CIMGUI_API void axSuspend()
 {
     ed::Suspend();
@@ -750,6 +880,10 @@ CIMGUI_API void axNavigateToSelection(int zoomIn, float duration)
 {
     ed::NavigateToSelection(zoomIn != 0, duration);
 }
+CIMGUI_API void axShowMinimap(float sizeFraction, axMinimapLocation location)
+{
+    ed::ShowMinimap(sizeFraction, (ed::MinimapLocation)location);
+}
 
 CIMGUI_API void axEnableShortcuts(int enable)
 {
@@ -122,10 +122,14 @@ static const int c_NodeContentChannel        = 4;
 
 static const float c_GroupSelectThickness       = 6.0f;  // canvas pixels
 static const float c_LinkSelectThickness        = 5.0f;  // canvas pixels
+static const int   c_LinkLodSegments            = 4;     // bezier segments at level of detail
 static const float c_NavigationZoomMargin       = 0.1f;  // percentage of visible bounds
 static const float c_MouseZoomDuration          = 0.15f; // seconds
 static const float c_SelectionFadeOutDuration   = 0.15f; // seconds
 
+static const uint32_t c_BinarySettingsMagic   = 0x424E5841; // "AXNB"
+static const uint32_t c_BinarySettingsVersion = 1;
+
 static const auto  c_MaxMoveOverEdgeSpeed       = 10.0f;
 static const auto  c_MaxMoveOverEdgeDistance    = 300.0f;
 
@@ -545,6 +549,35 @@ static void ImDrawList_AddBezierWithArrows(ImDrawList* drawList, const ImCubicBe
     }
 }
 
+// Appends previously captured geometry. Vertices with zero alpha are
+// anti-aliasing fringe and keep zero alpha in the new color.
+static void ImDrawList_AddGeometry(ImDrawList* drawList, const ImVector<ImDrawVert>& vertices, const ImVector<ImDrawIdx>& indices, ImU32 color)
+{
+    const auto transparentColor = color & ~IM_COL32_A_MASK;
+
+    drawList->PrimReserve(indices.Size, vertices.Size);
+
+    // Read after PrimReserve, it may start a new vertex offset
+    const auto baseIndex = drawList->_VtxCurrentIdx;
+
+    auto vtx = drawList->_VtxWritePtr;
+    for (auto& vertex : vertices)
+    {
+        vtx->pos = vertex.pos;
+        vtx->uv  = vertex.uv;
+        vtx->col = (vertex.col & IM_COL32_A_MASK) ? color : transparentColor;
+        ++vtx;
+    }
+
+    auto idx = drawList->_IdxWritePtr;
+    for (auto index : indices)
+        *idx++ = static_cast<ImDrawIdx>(baseIndex + index);
+
+    drawList->_VtxWritePtr   += vertices.Size;
+    drawList->_IdxWritePtr   += indices.Size;
+    drawList->_VtxCurrentIdx += vertices.Size;
+}
+
 
 
 
@@ -635,6 +668,7 @@ void ed::Node::UpdateDrag(const ImVec2& offset)
     auto size = m_Bounds.GetSize();
     m_Bounds.Min = ImFloor(m_DragStart + offset);
     m_Bounds.Max = m_Bounds.Min + size;
+    Editor->MarkBoundsDirty(this);
 }
 
 bool ed::Node::EndDrag()
@@ -648,6 +682,28 @@ void ed::Node::Draw(ImDrawList* drawList, DrawFlags flags)
     {
         drawList->ChannelsSetCurrent(m_Channel + c_NodeBackgroundChannel);
 
+        if (Editor->IsLodActive() && !IsGroup(this))
+        {
+            drawList->AddRectFilled(m_Bounds.Min, m_Bounds.Max, m_Color);
+
+            if (!m_Title.empty())
+            {
+                // Keep title readable regardless of zoom, clip it to the node
+                const auto fontSize = ImGui::GetFontSize() * Editor->GetView().InvScale;
+                const auto padding  = ImVec2(fontSize * 0.25f, fontSize * 0.25f);
+                const auto clipRect = ImVec4(m_Bounds.Min.x, m_Bounds.Min.y, m_Bounds.Max.x, m_Bounds.Max.y);
+
+                drawList->AddText(ImGui::GetFont(), fontSize, m_Bounds.Min + padding,
+                    ImGui::GetColorU32(ImGuiCol_Text), m_Title.c_str(), m_Title.c_str() + m_Title.size(),
+                    0.0f, &clipRect);
+            }
+
+            if (m_BorderWidth > 0.0f)
+                drawList->AddRect(m_Bounds.Min, m_Bounds.Max, m_BorderColor, 0.0f, 0, m_BorderWidth);
+
+            return;
+        }
+
         drawList->AddRectFilled(
             m_Bounds.Min,
             m_Bounds.Max,
@@ -914,26 +970,119 @@ void ed::Link::Draw(ImDrawList* drawList, ImU32 color, float extraThickness) con
     if (!m_IsLive)
         return;
 
-    const auto curve = GetCurve();
+    const auto& curve = m_Curve;
+
+    if (Editor->IsLodActive())
+    {
+        drawList->AddBezierCubic(curve.P0, curve.P1, curve.P2, curve.P3, color, m_Thickness + extraThickness, c_LinkLodSegments);
+        return;
+    }
+
+    if ((color >> 24) == 0)
+        return;
+
+    LinkGeometryKey key;
+    key.m_Curve           = curve;
+    key.m_Thickness       = m_Thickness + extraThickness;
+    key.m_StartArrowSize  = m_StartPin && m_StartPin->m_ArrowSize  > 0.0f ? m_StartPin->m_ArrowSize  + extraThickness : 0.0f;
+    key.m_StartArrowWidth = m_StartPin && m_StartPin->m_ArrowWidth > 0.0f ? m_StartPin->m_ArrowWidth + extraThickness : 0.0f;
+    key.m_EndArrowSize    =   m_EndPin &&   m_EndPin->m_ArrowSize  > 0.0f ?   m_EndPin->m_ArrowSize  + extraThickness : 0.0f;
+    key.m_EndArrowWidth   =   m_EndPin &&   m_EndPin->m_ArrowWidth > 0.0f ?   m_EndPin->m_ArrowWidth + extraThickness : 0.0f;
+    key.m_HasStartDirHint = m_StartPin && m_StartPin->m_SnapLinkToDir;
+    key.m_HasEndDirHint   = m_EndPin   &&   m_EndPin->m_SnapLinkToDir;
+    key.m_StartDirHint    = key.m_HasStartDirHint ? m_StartPin->m_Dir : ImVec2();
+    key.m_EndDirHint      = key.m_HasEndDirHint   ?   m_EndPin->m_Dir : ImVec2();
+    key.m_FringeScale     = ImFringeScaleRef(drawList);
+    key.m_TexUvWhitePixel = drawList->_Data->TexUvWhitePixel;
+    key.m_DrawListFlags   = drawList->Flags;
+
+    for (auto& geometry : m_Geometry)
+    {
+        if (geometry.m_Vertices.Size > 0 && geometry.m_Key == key)
+        {
+            ImDrawList_AddGeometry(drawList, geometry.m_Vertices, geometry.m_Indices, color);
+            return;
+        }
+    }
+
+    const auto firstVertex  = drawList->VtxBuffer.Size;
+    const auto firstIndex   = drawList->IdxBuffer.Size;
+    const auto commandCount = drawList->CmdBuffer.Size;
+    const auto baseIndex    = drawList->_VtxCurrentIdx;
 
-    ImDrawList_AddBezierWithArrows(drawList, curve, m_Thickness + extraThickness,
-        m_StartPin && m_StartPin->m_ArrowSize  > 0.0f ? m_StartPin->m_ArrowSize  + extraThickness : 0.0f,
-        m_StartPin && m_StartPin->m_ArrowWidth > 0.0f ? m_StartPin->m_ArrowWidth + extraThickness : 0.0f,
-          m_EndPin &&   m_EndPin->m_ArrowSize  > 0.0f ?   m_EndPin->m_ArrowSize  + extraThickness : 0.0f,
-          m_EndPin &&   m_EndPin->m_ArrowWidth > 0.0f ?   m_EndPin->m_ArrowWidth + extraThickness : 0.0f,
+    ImDrawList_AddBezierWithArrows(drawList, curve, key.m_Thickness,
+        key.m_StartArrowSize, key.m_StartArrowWidth,
+        key.m_EndArrowSize,   key.m_EndArrowWidth,
         true, color, 1.0f,
-        m_StartPin && m_StartPin->m_SnapLinkToDir ? &m_StartPin->m_Dir : nullptr,
-        m_EndPin   &&   m_EndPin->m_SnapLinkToDir ?   &m_EndPin->m_Dir : nullptr);
+        key.m_HasStartDirHint ? &key.m_StartDirHint : nullptr,
+        key.m_HasEndDirHint   ? &key.m_EndDirHint   : nullptr);
+
+    auto& geometry = m_Geometry[m_NextGeometry];
+    m_NextGeometry = (m_NextGeometry + 1) % c_GeometryCacheSize;
+
+    // Output was split across draw commands, indices are not relative to a single base
+    if (drawList->CmdBuffer.Size != commandCount || drawList->_VtxCurrentIdx < baseIndex)
+    {
+        geometry.m_Vertices.resize(0);
+        geometry.m_Indices.resize(0);
+        return;
+    }
+
+    geometry.m_Key = key;
+    geometry.m_Vertices.resize(drawList->VtxBuffer.Size - firstVertex);
+    geometry.m_Indices.resize(drawList->IdxBuffer.Size - firstIndex);
+    memcpy(geometry.m_Vertices.Data, drawList->VtxBuffer.Data + firstVertex, geometry.m_Vertices.Size * sizeof(ImDrawVert));
+    for (int i = 0; i < geometry.m_Indices.Size; ++i)
+        geometry.m_Indices[i] = static_cast<ImDrawIdx>(drawList->IdxBuffer[firstIndex + i] - baseIndex);
 }
 
-void ed::Link::UpdateEndpoints()
+bool ed::LinkGeometryKey::operator==(const LinkGeometryKey& rhs) const
+{
+    // Fringe follows zoom, anti-aliasing stays close enough within a few percent
+    const auto fringeRatio = m_FringeScale / rhs.m_FringeScale;
+
+    return m_Curve.P0 == rhs.m_Curve.P0 && m_Curve.P1 == rhs.m_Curve.P1
+        && m_Curve.P2 == rhs.m_Curve.P2 && m_Curve.P3 == rhs.m_Curve.P3
+        && m_Thickness       == rhs.m_Thickness
+        && m_StartArrowSize  == rhs.m_StartArrowSize
+        && m_StartArrowWidth == rhs.m_StartArrowWidth
+        && m_EndArrowSize    == rhs.m_EndArrowSize
+        && m_EndArrowWidth   == rhs.m_EndArrowWidth
+        && m_HasStartDirHint == rhs.m_HasStartDirHint
+        && m_HasEndDirHint   == rhs.m_HasEndDirHint
+        && m_StartDirHint    == rhs.m_StartDirHint
+        && m_EndDirHint      == rhs.m_EndDirHint
+        && fringeRatio > 0.95f && fringeRatio < 1.05f
+        && m_TexUvWhitePixel == rhs.m_TexUvWhitePixel
+        && m_DrawListFlags   == rhs.m_DrawListFlags;
+}
+
+void ed::Link::UpdateEndpoints(bool index)
 {
     const auto line = m_StartPin->GetClosestLine(m_EndPin);
     m_Start = line.A;
     m_End   = line.B;
+
+    const auto curve      = CalculateCurve();
+    const auto arrowSizes = ImVec2(m_StartPin->m_ArrowSize, m_EndPin->m_ArrowSize);
+
+    const auto curveChanged = !m_IsCurveValid
+        || curve.P0 != m_Curve.P0 || curve.P1 != m_Curve.P1 || curve.P2 != m_Curve.P2 || curve.P3 != m_Curve.P3
+        || arrowSizes != m_ArrowSizes;
+
+    if (curveChanged)
+    {
+        m_Curve        = curve;
+        m_ArrowSizes   = arrowSizes;
+        m_IsCurveValid = true;
+        m_CurveBounds  = CalculateBounds();
+    }
+
+    if (index && (curveChanged || !m_IsIndexed))
+        Editor->MarkBoundsDirty(this);
 }
 
-ImCubicBezierPoints ed::Link::GetCurve() const
+ImCubicBezierPoints ed::Link::CalculateCurve() const
 {
     auto easeLinkStrength = [](const ImVec2& a, const ImVec2& b, float strength)
     {
@@ -1015,48 +1164,229 @@ bool ed::Link::TestHit(const ImRect& rect, bool allowIntersect) const
 ImRect ed::Link::GetBounds() const
 {
     if (m_IsLive)
+        return m_CurveBounds;
+    else
+        return ImRect();
+}
+
+ImRect ed::Link::CalculateBounds() const
+{
+    const auto& curve = m_Curve;
+    auto bounds = ImCubicBezierBoundingRect(curve.P0, curve.P1, curve.P2, curve.P3);
+
+    if (bounds.GetWidth() == 0.0f)
     {
-        const auto curve = GetCurve();
-        auto bounds = ImCubicBezierBoundingRect(curve.P0, curve.P1, curve.P2, curve.P3);
+        bounds.Min.x -= 0.5f;
+        bounds.Max.x += 0.5f;
+    }
 
-        if (bounds.GetWidth() == 0.0f)
-        {
-            bounds.Min.x -= 0.5f;
-            bounds.Max.x += 0.5f;
-        }
+    if (bounds.GetHeight() == 0.0f)
+    {
+        bounds.Min.y -= 0.5f;
+        bounds.Max.y += 0.5f;
+    }
+
+    if (m_StartPin->m_ArrowSize)
+    {
+        const auto start_dir = ImNormalized(ImCubicBezierTangent(curve.P0, curve.P1, curve.P2, curve.P3, 0.0f));
+        const auto p0 = curve.P0;
+        const auto p1 = curve.P0 - start_dir * m_StartPin->m_ArrowSize;
+        const auto min = ImMin(p0, p1);
+        const auto max = ImMax(p0, p1);
+        auto arrowBounds = ImRect(min, ImMax(max, min + ImVec2(1, 1)));
+        bounds.Add(arrowBounds);
+    }
+
+    if (m_EndPin->m_ArrowSize)
+    {
+        const auto end_dir = ImNormalized(ImCubicBezierTangent(curve.P0, curve.P1, curve.P2, curve.P3, 1.0f));
+        const auto p0 = curve.P3;
+        const auto p1 = curve.P3 + end_dir * m_EndPin->m_ArrowSize;
+        const auto min = ImMin(p0, p1);
+        const auto max = ImMax(p0, p1);
+        auto arrowBounds = ImRect(min, ImMax(max, min + ImVec2(1, 1)));
+        bounds.Add(arrowBounds);
+    }
+
+    return bounds;
+}
+
+
+
+
+//------------------------------------------------------------------------------
+//
+// Spatial Index
+//
+//------------------------------------------------------------------------------
+void ed::SpatialIndex::MarkDirty(Object* object)
+{
+    ++m_Revision;
+
+    if (object->m_IsIndexDirty)
+        return;
 
-        if (bounds.GetHeight() == 0.0f)
+    object->m_IsIndexDirty = true;
+    m_Dirty.push_back(object);
+}
+
+void ed::SpatialIndex::Remove(Object* object)
+{
+    ++m_Revision;
+
+    Unlink(object);
+
+    if (object->m_IsIndexDirty)
+    {
+        m_Dirty.erase(std::find(m_Dirty.begin(), m_Dirty.end(), object));
+        object->m_IsIndexDirty = false;
+    }
+}
+
+void ed::SpatialIndex::Query(const ImRect& rect, vector<Object*>& result)
+{
+    result.resize(0);
+
+    Flush();
+
+    ++m_QueryStamp;
+
+    Collect(m_Oversized, rect, result);
+
+    int minX, minY, maxX, maxY;
+    GetCellRange(rect, minX, minY, maxX, maxY);
+
+    // Zoomed out selection rectangles may cover more cells than are occupied
+    const auto cellCount = (int64_t)(maxX - minX + 1) * (maxY - minY + 1);
+    if (cellCount > (int64_t)m_Cells.size())
+    {
+        for (auto& cell : m_Cells)
         {
-            bounds.Min.y -= 0.5f;
-            bounds.Max.y += 0.5f;
+            const auto x = (int)(int32_t)(uint32_t)(cell.first >> 32);
+            const auto y = (int)(int32_t)(uint32_t)(cell.first & 0xFFFFFFFF);
+            if (x >= minX && x <= maxX && y >= minY && y <= maxY)
+                Collect(cell.second, rect, result);
         }
-
-        if (m_StartPin->m_ArrowSize)
+    }
+    else
+    {
+        for (int y = minY; y <= maxY; ++y)
         {
-            const auto start_dir = ImNormalized(ImCubicBezierTangent(curve.P0, curve.P1, curve.P2, curve.P3, 0.0f));
-            const auto p0 = curve.P0;
-            const auto p1 = curve.P0 - start_dir * m_StartPin->m_ArrowSize;
-            const auto min = ImMin(p0, p1);
-            const auto max = ImMax(p0, p1);
-            auto arrowBounds = ImRect(min, ImMax(max, min + ImVec2(1, 1)));
-            bounds.Add(arrowBounds);
+            for (int x = minX; x <= maxX; ++x)
+            {
+                auto it = m_Cells.find(CellKey(x, y));
+                if (it != m_Cells.end())
+                    Collect(it->second, rect, result);
+            }
         }
+    }
+}
+
+bool ed::SpatialIndex::GetCellRange(const ImRect& rect, int& minX, int& minY, int& maxX, int& maxY) const
+{
+    const auto toCell = [scale = 1.0f / m_CellSize](float v)
+    {
+        return (int)ImClamp(ImFloor(v * scale), -1.0e9f, 1.0e9f);
+    };
+
+    minX = toCell(rect.Min.x);
+    minY = toCell(rect.Min.y);
+    maxX = toCell(rect.Max.x);
+    maxY = toCell(rect.Max.y);
+
+    return (int64_t)(maxX - minX + 1) * (maxY - minY + 1) <= c_MaxCellsPerObject;
+}
+
+void ed::SpatialIndex::Insert(Object* object)
+{
+    const auto bounds = object->GetBounds();
+    if (ImRect_IsEmpty(bounds))
+        return;
+
+    object->m_IndexBounds = bounds;
+    object->m_IsIndexed   = true;
+
+    int minX, minY, maxX, maxY;
+    if (!GetCellRange(bounds, minX, minY, maxX, maxY))
+    {
+        m_Oversized.push_back(object);
+        return;
+    }
+
+    for (int y = minY; y <= maxY; ++y)
+        for (int x = minX; x <= maxX; ++x)
+            m_Cells[CellKey(x, y)].push_back(object);
+}
+
+void ed::SpatialIndex::Unlink(Object* object)
+{
+    if (!object->m_IsIndexed)
+        return;
+
+    object->m_IsIndexed = false;
+
+    int minX, minY, maxX, maxY;
+    if (!GetCellRange(object->m_IndexBounds, minX, minY, maxX, maxY))
+    {
+        m_Oversized.erase(std::find(m_Oversized.begin(), m_Oversized.end(), object));
+        return;
+    }
 
-        if (m_EndPin->m_ArrowSize)
+    for (int y = minY; y <= maxY; ++y)
+    {
+        for (int x = minX; x <= maxX; ++x)
         {
-            const auto end_dir = ImNormalized(ImCubicBezierTangent(curve.P0, curve.P1, curve.P2, curve.P3, 1.0f));
-            const auto p0 = curve.P3;
-            const auto p1 = curve.P3 + end_dir * m_EndPin->m_ArrowSize;
-            const auto min = ImMin(p0, p1);
-            const auto max = ImMax(p0, p1);
-            auto arrowBounds = ImRect(min, ImMax(max, min + ImVec2(1, 1)));
-            bounds.Add(arrowBounds);
+            auto it = m_Cells.find(CellKey(x, y));
+            if (it == m_Cells.end())
+                continue;
+
+            auto& cell = it->second;
+            auto objectIt = std::find(cell.begin(), cell.end(), object);
+            if (objectIt != cell.end())
+            {
+                *objectIt = cell.back();
+                cell.pop_back();
+            }
+
+            if (cell.empty())
+                m_Cells.erase(it);
         }
+    }
+}
+
+void ed::SpatialIndex::Flush()
+{
+    for (auto object : m_Dirty)
+    {
+        object->m_IsIndexDirty = false;
+
+        const auto bounds = object->GetBounds();
+        if (object->m_IsIndexed && bounds.Min == object->m_IndexBounds.Min && bounds.Max == object->m_IndexBounds.Max)
+            continue;
 
-        return bounds;
+        Unlink(object);
+        Insert(object);
+    }
+
+    m_Dirty.resize(0);
+}
+
+void ed::SpatialIndex::Collect(const vector<Object*>& objects, const ImRect& rect, vector<Object*>& result)
+{
+    for (auto object : objects)
+    {
+        if (object->m_IndexQueryStamp == m_QueryStamp)
+            continue;
+
+        object->m_IndexQueryStamp = m_QueryStamp;
+
+        // Inclusive, so point queries on an edge still find the object
+        const auto& bounds = object->m_IndexBounds;
+        if (bounds.Max.x < rect.Min.x || bounds.Min.x > rect.Max.x || bounds.Max.y < rect.Min.y || bounds.Min.y > rect.Max.y)
+            continue;
+
+        result.push_back(object);
     }
-    else
-        return ImRect();
 }
 
 
@@ -1079,12 +1409,19 @@ ed::EditorContext::EditorContext(const ax::NodeEditor::Config* config)
     , m_Nodes()
     , m_Pins()
     , m_Links()
+    , m_NodeOrderDirty(false)
+    , m_NodeMap()
+    , m_PinMap()
+    , m_LinkMap()
+    , m_NodeIndex()
+    , m_LinkIndex()
     , m_SelectionId(1)
     , m_LastActiveLink(nullptr)
     , m_Canvas()
     , m_IsCanvasVisible(false)
     , m_NodeBuilder(this)
     , m_HintBuilder(this)
+    , m_Minimap(this)
     , m_CurrentAction(nullptr)
     , m_NavigateAction(this, m_Canvas)
     , m_SizeAction(this)
@@ -1148,12 +1485,13 @@ void ed::EditorContext::Begin(const char* id, const ImVec2& size)
     //ImGui::LogToClipboard();
     //Log("---- begin ----");
 
-    static auto resetAndCollect = [](auto& objects)
+    auto resetAndCollect = [this](auto& objects)
     {
-        objects.erase(std::remove_if(objects.begin(), objects.end(), [](auto objectWrapper)
+        objects.erase(std::remove_if(objects.begin(), objects.end(), [this](auto objectWrapper)
         {
             if (objectWrapper->m_DeleteOnNewFrame)
             {
+                RemoveObject(objectWrapper.m_Object);
                 delete objectWrapper.m_Object;
                 return true;
             }
@@ -1235,6 +1573,10 @@ void ed::EditorContext::Begin(const char* id, const ImVec2& size)
         m_NavigateAction.NavigateTo(previousVisibleRect, Detail::NavigateAction::ZoomMode::Exact, 0.0f);
     }
 
+    // Before any node, so the minimap takes the mouse from nodes underneath it
+    if (m_IsCanvasVisible)
+        m_Minimap.Process();
+
     m_Canvas.SetView(m_NavigateAction.GetView());
 
     // #debug #clip
@@ -1274,15 +1616,33 @@ void ed::EditorContext::End()
     const bool isDragging  = m_CurrentAction && m_CurrentAction->AsDrag()   != nullptr;
     //const bool isSizing    = CurrentAction && CurrentAction->AsSize()   != nullptr;
 
+    // Collect objects overlapping the view, everything else is culled
+    m_VisibleNodes.resize(0);
+    m_VisibleLinks.resize(0);
+
+    m_NodeIndex.Query(GetViewRect(), m_IndexQuery);
+    for (auto object : m_IndexQuery)
+        if (object->IsVisible())
+            m_VisibleNodes.push_back(object->AsNode());
+
+    m_LinkIndex.Query(GetViewRect(), m_IndexQuery);
+    for (auto object : m_IndexQuery)
+        if (object->IsVisible())
+            m_VisibleLinks.push_back(object->AsLink());
+
+    // Same order as m_Links
+    std::sort(m_VisibleLinks.begin(), m_VisibleLinks.end(), [](const Link* lhs, const Link* rhs)
+    {
+        return lhs->m_ID.AsPointer() < rhs->m_ID.AsPointer();
+    });
+
     // Draw nodes
-    for (auto node : m_Nodes)
-        if (node->m_IsLive && node->IsVisible())
-            node->Draw(m_DrawList);
+    for (auto node : m_VisibleNodes)
+        node->Draw(m_DrawList);
 
     // Draw links
-    for (auto link : m_Links)
-        if (link->m_IsLive && link->IsVisible())
-            link->Draw(m_DrawList);
+    for (auto link : m_VisibleLinks)
+        link->Draw(m_DrawList);
 
     // Highlight selected objects
     {
@@ -1302,11 +1662,8 @@ void ed::EditorContext::End()
             return pin.m_Node->m_HighlightConnectedLinks && pin.m_Node->m_IsSelected;
         };
 
-        for (auto& link : m_Links)
+        for (auto link : m_VisibleLinks)
         {
-            if (!link->m_IsLive || !link->IsVisible())
-                continue;
-
             auto isLinkHighlighted = isLinkHighlightedForPin(*link->m_StartPin) || isLinkHighlightedForPin(*link->m_EndPin);
             if (!isLinkHighlighted)
                 continue;
@@ -1385,14 +1742,30 @@ void ed::EditorContext::End()
     // Draw selection rectangle
     m_SelectAction.Draw(m_DrawList);
 
-    bool sortGroups = false;
+    auto byZPosition = [](const Node* lhs, const Node* rhs)
+    {
+        return lhs->m_ZPosition < rhs->m_ZPosition;
+    };
+
     if (control.ActiveNode)
     {
         if (!IsGroup(control.ActiveNode))
         {
-            // Bring active node to front
+            // Bring active node to front of the nodes sharing its z position. m_Nodes is
+            // sorted unless the order is dirty, then the full sort below puts it in place.
             auto activeNodeIt = std::find(m_Nodes.begin(), m_Nodes.end(), control.ActiveNode);
-            std::rotate(activeNodeIt, activeNodeIt + 1, m_Nodes.end());
+            auto frontIt      = m_NodeOrderDirty ? m_Nodes.end() : std::upper_bound(activeNodeIt, m_Nodes.end(), control.ActiveNode, byZPosition);
+
+            if (activeNodeIt + 1 < frontIt)
+            {
+                // Nodes in between move back one place and take over the order of their predecessor
+                auto order = control.ActiveNode->m_Order;
+                for (auto it = activeNodeIt + 1; it != frontIt; ++it)
+                    std::swap(order, (*it)->m_Order);
+                control.ActiveNode->m_Order = order;
+
+                std::rotate(activeNodeIt, activeNodeIt + 1, frontIt);
+            }
         }
         else if (!isDragging && m_CurrentAction && m_CurrentAction->AsDrag())
         {
@@ -1405,18 +1778,18 @@ void ed::EditorContext::End()
                 return std::find(nodes.begin(), nodes.end(), node) == nodes.end();
             });
 
-            sortGroups = true;
+            m_NodeOrderDirty = true;
         }
     }
 
-    // Sort nodes if bounds of node changed
-    if (sortGroups || ((m_Settings.m_DirtyReason & (SaveReasonFlags::Position | SaveReasonFlags::Size)) != SaveReasonFlags::None))
+    // Sort only when something affecting the order changed, idle frames keep the previous order
+    if (m_NodeOrderDirty)
     {
         // Bring all groups before regular nodes
         auto groupsItEnd = std::stable_partition(m_Nodes.begin(), m_Nodes.end(), IsGroup);
 
         // Sort groups by area
-        std::sort(m_Nodes.begin(), groupsItEnd, [this](Node* lhs, Node* rhs)
+        std::stable_sort(m_Nodes.begin(), groupsItEnd, [this](Node* lhs, Node* rhs)
         {
             const auto& lhsSize = lhs == m_SizeAction.m_SizedNode ? m_SizeAction.GetStartGroupBounds().GetSize() : lhs->m_GroupBounds.GetSize();
             const auto& rhsSize = rhs == m_SizeAction.m_SizedNode ? m_SizeAction.GetStartGroupBounds().GetSize() : rhs->m_GroupBounds.GetSize();
@@ -1426,13 +1799,15 @@ void ed::EditorContext::End()
 
             return lhsArea > rhsArea;
         });
-    }
 
-    // Apply Z order
-    std::stable_sort(m_Nodes.begin(), m_Nodes.end(), [](const auto& lhs, const auto& rhs)
-    {
-        return lhs->m_ZPosition < rhs->m_ZPosition;
-    });
+        // Apply Z order
+        std::stable_sort(m_Nodes.begin(), m_Nodes.end(), byZPosition);
+
+        for (int i = 0; i < (int)m_Nodes.size(); ++i)
+            m_Nodes[i]->m_Order = i;
+
+        m_NodeOrderDirty = false;
+    }
 
 # if 1
     // Every node has few channels assigned. Grow channel list
@@ -1578,6 +1953,9 @@ void ed::EditorContext::End()
 
     ImDrawList_SwapSplitter(m_DrawList, m_Splitter);
 
+    if (m_IsCanvasVisible)
+        m_Minimap.Draw(m_DrawList);
+
     // Draw border
     {
         auto& style = ImGui::GetStyle();
@@ -1632,6 +2010,7 @@ bool ed::EditorContext::DoLink(LinkId id, PinId startPinId, PinId endPinId, ImU3
     link->m_IsLive        = true;
 
     link->UpdateEndpoints();
+    UpdateLinkConnections(link);
 
     return true;
 }
@@ -1662,10 +2041,15 @@ void ed::EditorContext::SetGroupSize(NodeId nodeId, const ImVec2& size)
         node->m_IsLive = false;
     }
 
-    node->m_Type = NodeType::Group;
+    if (node->m_Type != NodeType::Group)
+    {
+        node->m_Type = NodeType::Group;
+        m_NodeOrderDirty = true;
+    }
 
     if (node->m_GroupBounds.GetSize() != size)
     {
+        m_NodeOrderDirty = true;
         node->m_GroupBounds.Min = node->m_Bounds.Min;
         node->m_GroupBounds.Max = node->m_Bounds.Min + size;
         node->m_GroupBounds.Floor();
@@ -1691,6 +2075,24 @@ ImVec2 ed::EditorContext::GetNodeSize(NodeId nodeId)
     return node->m_Bounds.GetSize();
 }
 
+bool ed::EditorContext::IsLodActive() const
+{
+    return m_Style.LodZoomThreshold > 0.0f && GetView().Scale < m_Style.LodZoomThreshold;
+}
+
+bool ed::EditorContext::IsNodeCulled(NodeId nodeId)
+{
+    // Node size and pins are only known once contents were submitted
+    auto node = FindNode(nodeId);
+    if (!node || !node->m_HasContents)
+        return false;
+
+    if (IsLodActive())
+        return true;
+
+    return !GetViewRect().Overlaps(node->m_Bounds);
+}
+
 void ed::EditorContext::SetNodeZPosition(NodeId nodeId, float z)
 {
     auto node = FindNode(nodeId);
@@ -1700,7 +2102,11 @@ void ed::EditorContext::SetNodeZPosition(NodeId nodeId, float z)
         node->m_IsLive = false;
     }
 
-    node->m_ZPosition = z;
+    if (node->m_ZPosition != z)
+    {
+        node->m_ZPosition = z;
+        m_NodeOrderDirty = true;
+    }
 }
 
 float ed::EditorContext::GetNodeZPosition(NodeId nodeId)
@@ -1732,6 +2138,8 @@ void ed::EditorContext::UpdateNodeState(Node* node)
 
     if (!settings->m_WasUsed)
     {
+        // Node may be submitted again after removal, it is no longer removed
+        settings->ClearDirty();
         MakeDirty(SaveReasonFlags::AddNode, node);
         settings->m_WasUsed = true;
     }
@@ -1750,6 +2158,8 @@ void ed::EditorContext::UpdateNodeState(Node* node)
     node->m_GroupBounds.Min = settings->m_Location;
     node->m_GroupBounds.Max = node->m_GroupBounds.Min + settings->m_GroupSize;
     node->m_GroupBounds.Floor();
+    MarkBoundsDirty(node);
+    m_NodeOrderDirty = true;
 }
 
 void ed::EditorContext::RemoveSettings(Object* object)
@@ -1835,11 +2245,18 @@ bool ed::EditorContext::HasSelectionChanged()
 
 ed::Node* ed::EditorContext::FindNodeAt(const ImVec2& p)
 {
-    for (auto node : m_Nodes)
-        if (node->TestHit(p))
-            return node;
+    m_NodeIndex.Query(ImRect(p, p), m_IndexQuery);
 
-    return nullptr;
+    // First hit in m_Nodes order
+    Node* result = nullptr;
+    for (auto object : m_IndexQuery)
+    {
+        auto node = object->AsNode();
+        if ((!result || node->m_Order < result->m_Order) && node->TestHit(p))
+            result = node;
+    }
+
+    return result;
 }
 
 void ed::EditorContext::FindNodesInRect(const ImRect& r, vector<Node*>& result, bool append, bool includeIntersecting)
@@ -1850,9 +2267,20 @@ void ed::EditorContext::FindNodesInRect(const ImRect& r, vector<Node*>& result,
     if (ImRect_IsEmpty(r))
         return;
 
-    for (auto node : m_Nodes)
+    m_NodeIndex.Query(r, m_IndexQuery);
+
+    const auto first = result.size();
+    for (auto object : m_IndexQuery)
+    {
+        auto node = object->AsNode();
         if (node->TestHit(r, includeIntersecting))
             result.push_back(node);
+    }
+
+    std::sort(result.begin() + first, result.end(), [](const Node* lhs, const Node* rhs)
+    {
+        return lhs->m_Order < rhs->m_Order;
+    });
 }
 
 void ed::EditorContext::FindLinksInRect(const ImRect& r, vector<Link*>& result, bool append)
@@ -1863,14 +2291,29 @@ void ed::EditorContext::FindLinksInRect(const ImRect& r, vector<Link*>& result,
     if (ImRect_IsEmpty(r))
         return;
 
-    for (auto link : m_Links)
+    m_LinkIndex.Query(r, m_IndexQuery);
+
+    const auto first = result.size();
+    for (auto object : m_IndexQuery)
+    {
+        auto link = object->AsLink();
         if (link->TestHit(r))
             result.push_back(link);
+    }
+
+    std::sort(result.begin() + first, result.end(), [](const Link* lhs, const Link* rhs)
+    {
+        return lhs->m_ID.AsPointer() < rhs->m_ID.AsPointer();
+    });
 }
 
 bool ed::EditorContext::HasAnyLinks(NodeId nodeId) const
 {
-    for (auto link : m_Links)
+    auto node = m_NodeMap.Find(nodeId);
+    if (!node)
+        return false;
+
+    for (auto link : node->m_ConnectedLinks)
     {
         if (!link->m_IsLive)
             continue;
@@ -1884,7 +2327,11 @@ bool ed::EditorContext::HasAnyLinks(NodeId nodeId) const
 
 bool ed::EditorContext::HasAnyLinks(PinId pinId) const
 {
-    for (auto link : m_Links)
+    auto pin = m_PinMap.Find(pinId);
+    if (!pin || !pin->m_Node)
+        return false;
+
+    for (auto link : pin->m_Node->m_ConnectedLinks)
     {
         if (!link->m_IsLive)
             continue;
@@ -1898,34 +2345,45 @@ bool ed::EditorContext::HasAnyLinks(PinId pinId) const
 
 int ed::EditorContext::BreakLinks(NodeId nodeId)
 {
+    vector<Link*> links;
+    FindLinksForNode(nodeId, links);
+
     int result = 0;
-    for (auto link : m_Links)
+    for (auto link : links)
     {
-        if (!link->m_IsLive)
-            continue;
-
-        if (link->m_StartPin->m_Node->m_ID == nodeId || link->m_EndPin->m_Node->m_ID == nodeId)
-        {
-            if (GetItemDeleter().Add(link))
-                ++result;
-        }
+        if (GetItemDeleter().Add(link))
+            ++result;
     }
     return result;
 }
 
 int ed::EditorContext::BreakLinks(PinId pinId)
 {
-    int result = 0;
-    for (auto link : m_Links)
+    auto pin = FindPin(pinId);
+    if (!pin || !pin->m_Node)
+        return 0;
+
+    vector<Link*> links;
+    for (auto link : pin->m_Node->m_ConnectedLinks)
     {
         if (!link->m_IsLive)
             continue;
 
         if (link->m_StartPin->m_ID == pinId || link->m_EndPin->m_ID == pinId)
-        {
-            if (GetItemDeleter().Add(link))
-                ++result;
-        }
+            links.push_back(link);
+    }
+
+    // Same order as m_Links
+    std::sort(links.begin(), links.end(), [](const Link* lhs, const Link* rhs)
+    {
+        return lhs->m_ID.AsPointer() < rhs->m_ID.AsPointer();
+    });
+
+    int result = 0;
+    for (auto link : links)
+    {
+        if (GetItemDeleter().Add(link))
+            ++result;
     }
     return result;
 }
@@ -1935,7 +2393,12 @@ void ed::EditorContext::FindLinksForNode(NodeId nodeId, vector<Link*>& result, b
     if (!add)
         result.clear();
 
-    for (auto link : m_Links)
+    auto node = FindNode(nodeId);
+    if (!node)
+        return;
+
+    const auto first = result.size();
+    for (auto link : node->m_ConnectedLinks)
     {
         if (!link->m_IsLive)
             continue;
@@ -1943,6 +2406,12 @@ void ed::EditorContext::FindLinksForNode(NodeId nodeId, vector<Link*>& result, b
         if (link->m_StartPin->m_Node->m_ID == nodeId || link->m_EndPin->m_Node->m_ID == nodeId)
             result.push_back(link);
     }
+
+    // Same order as m_Links
+    std::sort(result.begin() + first, result.end(), [](const Link* lhs, const Link* rhs)
+    {
+        return lhs->m_ID.AsPointer() < rhs->m_ID.AsPointer();
+    });
 }
 
 bool ed::EditorContext::PinHadAnyLinks(PinId pinId)
@@ -2028,8 +2497,9 @@ ed::Pin* ed::EditorContext::CreatePin(PinId id, PinKind kind)
 {
     IM_ASSERT(nullptr == FindObject(id));
     auto pin = new Pin(this, id, kind);
-    m_Pins.push_back({id, pin});
-    std::sort(m_Pins.begin(), m_Pins.end());
+    ObjectWrapper<Pin> item = {id, pin};
+    m_Pins.insert(std::upper_bound(m_Pins.begin(), m_Pins.end(), item), item);
+    m_PinMap.Insert(id, pin);
     return pin;
 }
 
@@ -2037,7 +2507,10 @@ ed::Node* ed::EditorContext::CreateNode(NodeId id)
 {
     IM_ASSERT(nullptr == FindObject(id));
     auto node = new Node(this, id);
+    node->m_Order = m_Nodes.empty() ? 0 : m_Nodes.back()->m_Order + 1;
     m_Nodes.push_back({id, node});
+    m_NodeOrderDirty = true;
+    m_NodeMap.Insert(id, node);
     //std::sort(Nodes.begin(), Nodes.end());
 
     auto settings = m_Settings.FindNode(id);
@@ -2058,67 +2531,26 @@ ed::Link* ed::EditorContext::CreateLink(LinkId id)
 {
     IM_ASSERT(nullptr == FindObject(id));
     auto link = new Link(this, id);
-    m_Links.push_back({id, link});
-    std::sort(m_Links.begin(), m_Links.end());
+    ObjectWrapper<Link> item = {id, link};
+    m_Links.insert(std::upper_bound(m_Links.begin(), m_Links.end(), item), item);
+    m_LinkMap.Insert(id, link);
 
     return link;
 }
 
-template <typename C, typename Id>
-static inline auto FindItemInLinear(C& container, Id id)
-{
-# if defined(_DEBUG)
-    auto start = container.data();
-    auto end   = container.data() + container.size();
-    for (auto it = start; it < end; ++it)
-        if ((*it).m_ID == id)
-            return it->m_Object;
-# else
-    for (auto item : container)
-        if (item.m_ID == id)
-            return item.m_Object;
-# endif
-
-   return static_cast<decltype(container[0].m_Object)>(nullptr);
-}
-
-template <typename C, typename Id>
-static inline auto FindItemIn(C& container, Id id)
-{
-//# if defined(_DEBUG)
-//    auto start = container.data();
-//    auto end   = container.data() + container.size();
-//    for (auto it = start; it < end; ++it)
-//        if ((*it)->ID == id)
-//            return *it;
-//# else
-//    for (auto item : container)
-//        if (item->ID == id)
-//            return item;
-//# endif
-    auto key = typename C::value_type{ id, nullptr };
-    auto first = container.cbegin();
-    auto last  = container.cend();
-    auto it    = std::lower_bound(first, last, key);
-    if (it != last && (key.m_ID == it->m_ID))
-        return it->m_Object;
-    else
-        return static_cast<decltype(it->m_Object)>(nullptr);
-}
-
 ed::Node* ed::EditorContext::FindNode(NodeId id)
 {
-    return FindItemInLinear(m_Nodes, id);
+    return m_NodeMap.Find(id);
 }
 
 ed::Pin* ed::EditorContext::FindPin(PinId id)
 {
-    return FindItemIn(m_Pins, id);
+    return m_PinMap.Find(id);
 }
 
 ed::Link* ed::EditorContext::FindLink(LinkId id)
 {
-    return FindItemIn(m_Links, id);
+    return m_LinkMap.Find(id);
 }
 
 ed::Object* ed::EditorContext::FindObject(ObjectId id)
@@ -2163,6 +2595,11 @@ ed::Link* ed::EditorContext::GetLink(LinkId id)
 void ed::EditorContext::LoadSettings()
 {
     //ed::Settings::Parse(m_Config.Load(), m_Settings);
+    if (m_Config.LoadSettingsBinary)
+    {
+        auto data = m_Config.LoadBinary();
+        ed::Settings::ParseBinary(data.data(), data.size(), m_Settings);
+    }
 
     if (ImRect_IsEmpty(m_Settings.m_VisibleRect))
     {
@@ -2187,7 +2624,7 @@ void ed::EditorContext::SaveSettings()
         if (IsGroup(node))
             settings->m_GroupSize = node->m_GroupBounds.GetSize();
 
-        if (!node->m_RestoreState && settings->m_IsDirty && m_Config.SaveNodeSettings)
+        if (!node->m_RestoreState && settings->m_IsDirty && m_Config.SaveNodeSettings && !m_Config.SaveSettingsBinary)
         {
             //if (m_Config.SaveNode(node->m_ID, settings->Serialize().dump(), settings->m_DirtyReason))
             settings->ClearDirty();
@@ -2202,8 +2639,41 @@ void ed::EditorContext::SaveSettings()
     m_Settings.m_ViewZoom    = m_NavigateAction.m_Zoom;
     m_Settings.m_VisibleRect = m_NavigateAction.m_VisibleRect;
 
-    //if (m_Config.Save(m_Settings.Serialize(), m_Settings.m_DirtyReason))
-        m_Settings.ClearDirty();
+    if (m_Config.SaveSettingsBinary)
+    {
+        // Only changed nodes go out, settings without a live node were removed
+        vector<NodeSettings*> dirtyNodes;
+        for (auto& settings : m_Settings.m_Nodes)
+        {
+            if (!settings.m_IsDirty)
+                continue;
+
+            auto node = FindNode(settings.m_ID);
+            if (node && node->m_RestoreState)
+                continue;
+
+            if (!node)
+                settings.m_DirtyReason = SaveReasonFlags::RemoveNode;
+
+            dirtyNodes.push_back(&settings);
+        }
+
+        vector<char> data;
+        m_Settings.SerializeBinary(data, dirtyNodes, m_Settings.m_DirtyReason);
+        if (m_Config.SaveBinary(data, m_Settings.m_DirtyReason))
+        {
+            for (auto settings : dirtyNodes)
+                settings->ClearDirty();
+
+            m_Settings.m_IsDirty     = false;
+            m_Settings.m_DirtyReason = SaveReasonFlags::None;
+        }
+    }
+    else
+    {
+        //if (m_Config.Save(m_Settings.Serialize(), m_Settings.m_DirtyReason))
+            m_Settings.ClearDirty();
+    }
 
     m_Config.EndSave();
 }
@@ -2216,17 +2686,98 @@ void ed::EditorContext::MakeDirty(SaveReasonFlags reason)
 void ed::EditorContext::MakeDirty(SaveReasonFlags reason, Node* node)
 {
     m_Settings.MakeDirty(reason, node);
+
+    if (node && (reason & (SaveReasonFlags::Position | SaveReasonFlags::Size)) != SaveReasonFlags::None)
+        m_NodeIndex.MarkDirty(node);
 }
 
 ed::Link* ed::EditorContext::FindLinkAt(const ImVec2& p)
 {
-    for (auto& link : m_Links)
+    auto area = ImRect(p, p);
+    area.Expand(c_LinkSelectThickness);
+    m_LinkIndex.Query(area, m_IndexQuery);
+
+    // First hit in m_Links order, which is sorted by id
+    std::sort(m_IndexQuery.begin(), m_IndexQuery.end(), [](Object* lhs, Object* rhs)
+    {
+        return lhs->AsLink()->m_ID.AsPointer() < rhs->AsLink()->m_ID.AsPointer();
+    });
+
+    for (auto object : m_IndexQuery)
+    {
+        auto link = object->AsLink();
         if (link->TestHit(p, c_LinkSelectThickness))
             return link;
+    }
 
     return nullptr;
 }
 
+void ed::EditorContext::MarkBoundsDirty(Object* object)
+{
+    if (object->AsNode())
+        m_NodeIndex.MarkDirty(object);
+    else if (object->AsLink())
+        m_LinkIndex.MarkDirty(object);
+}
+
+static void EraseConnectedLink(ed::Node* node, ed::Link* link)
+{
+    auto& links = node->m_ConnectedLinks;
+    auto it = std::find(links.begin(), links.end(), link);
+    if (it == links.end())
+        return;
+
+    *it = links.back();
+    links.pop_back();
+}
+
+void ed::EditorContext::UpdateLinkConnections(Link* link)
+{
+    Node* nodes[2] = { link->m_StartPin->m_Node, link->m_EndPin->m_Node };
+    if (nodes[0] == link->m_ConnectedNodes[0] && nodes[1] == link->m_ConnectedNodes[1])
+        return;
+
+    for (auto node : link->m_ConnectedNodes)
+        if (node)
+            EraseConnectedLink(node, link);
+
+    link->m_ConnectedNodes[0] = nodes[0];
+    link->m_ConnectedNodes[1] = nodes[1];
+
+    if (nodes[0])
+        nodes[0]->m_ConnectedLinks.push_back(link);
+    if (nodes[1] && nodes[1] != nodes[0])
+        nodes[1]->m_ConnectedLinks.push_back(link);
+}
+
+void ed::EditorContext::RemoveObject(Object* object)
+{
+    if (auto node = object->AsNode())
+    {
+        m_NodeIndex.Remove(node);
+        m_NodeMap.Erase(node->m_ID);
+
+        for (auto link : node->m_ConnectedLinks)
+            for (auto& connectedNode : link->m_ConnectedNodes)
+                if (connectedNode == node)
+                    connectedNode = nullptr;
+    }
+    else if (auto pin = object->AsPin())
+    {
+        m_PinMap.Erase(pin->m_ID);
+    }
+    else if (auto link = object->AsLink())
+    {
+        m_LinkIndex.Remove(link);
+        m_LinkMap.Erase(link->m_ID);
+
+        for (auto node : link->m_ConnectedNodes)
+            if (node)
+                EraseConnectedLink(node, link);
+    }
+}
+
 ImU32 ed::EditorContext::GetColor(StyleColor colorIndex) const
 {
     return ImColor(m_Style.Colors[colorIndex]);
@@ -2258,6 +2809,41 @@ int ed::EditorContext::GetNodeIds(NodeId* nodes, int size) const
     return result;
 }
 
+int ed::EditorContext::GetNodeRects(NodeId* nodes, ImVec4* rects, int size, bool visibleOnly)
+{
+    if (size <= 0)
+        return 0;
+
+    int result = 0;
+    auto add = [&](const Node* node)
+    {
+        nodes[result] = node->m_ID;
+        rects[result] = ImVec4(node->m_Bounds.Min.x, node->m_Bounds.Min.y, node->m_Bounds.Max.x, node->m_Bounds.Max.y);
+        return ++result < size;
+    };
+
+    if (visibleOnly)
+    {
+        m_NodeIndex.Query(GetViewRect(), m_IndexQuery);
+        for (auto object : m_IndexQuery)
+        {
+            auto node = object->AsNode();
+            if (node->m_IsLive && !add(node))
+                break;
+        }
+    }
+    else
+    {
+        for (auto node : m_Nodes)
+        {
+            if (node->m_IsLive && !add(node))
+                break;
+        }
+    }
+
+    return result;
+}
+
 void ed::EditorContext::RegisterAnimation(Animation* animation)
 {
     m_LiveAnimations.push_back(animation);
@@ -2741,16 +3327,30 @@ bool ed::NodeSettings::Parse(const json::value& data, NodeSettings& result)
 ed::NodeSettings* ed::Settings::AddNode(NodeId id)
 {
     m_Nodes.push_back(NodeSettings(id));
+
+    if (m_NodeMapData == m_Nodes.data())
+        m_NodeMap.Insert(id, &m_Nodes.back());
+
     return &m_Nodes.back();
 }
 
 ed::NodeSettings* ed::Settings::FindNode(NodeId id)
 {
-    for (auto& settings : m_Nodes)
-        if (settings.m_ID == id)
-            return &settings;
+    UpdateNodeMap();
 
-    return nullptr;
+    return m_NodeMap.Find(id);
+}
+
+void ed::Settings::UpdateNodeMap()
+{
+    // Map points into m_Nodes, rebuild it when storage moved (growth or copy)
+    if (m_NodeMapData == m_Nodes.data() && m_NodeMap.Size() == m_Nodes.size())
+        return;
+
+    m_NodeMap = ObjectIdMap<NodeSettings, NodeId>();
+    for (auto& settings : m_Nodes)
+        m_NodeMap.Insert(settings.m_ID, &settings);
+    m_NodeMapData = m_Nodes.data();
 }
 
 void ed::Settings::RemoveNode(NodeId id)
@@ -2794,6 +3394,156 @@ void ed::Settings::MakeDirty(SaveReasonFlags reason, Node* node)
     }
 }
 
+// Binary settings chunk, fields in host byte order:
+//   header:    u32 magic, u32 version, u32 node count, u32 selection count, u32 save reason,
+//              f32 scroll x/y, f32 zoom, f32 visible rect min x/y max x/y
+//   node:      u64 id, u32 dirty reason, f32 location x/y, f32 size x/y, f32 group size x/y
+//   selection: u64 id, u32 object type
+// Chunks may follow each other, they are applied in order. Node records with
+// RemoveNode reason drop the node from settings.
+template <typename T>
+static void BinaryWrite(char*& out, const T& value)
+{
+    memcpy(out, &value, sizeof(T));
+    out += sizeof(T);
+}
+
+template <typename T>
+static T BinaryRead(const char*& in)
+{
+    T value;
+    memcpy(&value, in, sizeof(T));
+    in += sizeof(T);
+    return value;
+}
+
+static const size_t c_BinaryHeaderSize   = 5 * sizeof(uint32_t) + 7 * sizeof(float);
+static const size_t c_BinaryNodeSize     = sizeof(uint64_t) + sizeof(uint32_t) + 6 * sizeof(float);
+static const size_t c_BinaryObjectIdSize = sizeof(uint64_t) + sizeof(uint32_t);
+
+void ed::Settings::SerializeBinary(vector<char>& data, const vector<NodeSettings*>& nodes, SaveReasonFlags reason) const
+{
+    const auto offset = data.size();
+    data.resize(offset + c_BinaryHeaderSize + nodes.size() * c_BinaryNodeSize + m_Selection.size() * c_BinaryObjectIdSize);
+
+    auto out = data.data() + offset;
+    BinaryWrite(out, c_BinarySettingsMagic);
+    BinaryWrite(out, c_BinarySettingsVersion);
+    BinaryWrite(out, static_cast<uint32_t>(nodes.size()));
+    BinaryWrite(out, static_cast<uint32_t>(m_Selection.size()));
+    BinaryWrite(out, static_cast<uint32_t>(reason));
+    BinaryWrite(out, m_ViewScroll.x);
+    BinaryWrite(out, m_ViewScroll.y);
+    BinaryWrite(out, m_ViewZoom);
+    BinaryWrite(out, m_VisibleRect.Min.x);
+    BinaryWrite(out, m_VisibleRect.Min.y);
+    BinaryWrite(out, m_VisibleRect.Max.x);
+    BinaryWrite(out, m_VisibleRect.Max.y);
+
+    for (auto node : nodes)
+    {
+        BinaryWrite(out, static_cast<uint64_t>(node->m_ID.Get()));
+        BinaryWrite(out, static_cast<uint32_t>(node->m_DirtyReason));
+        BinaryWrite(out, node->m_Location.x);
+        BinaryWrite(out, node->m_Location.y);
+        BinaryWrite(out, node->m_Size.x);
+        BinaryWrite(out, node->m_Size.y);
+        BinaryWrite(out, node->m_GroupSize.x);
+        BinaryWrite(out, node->m_GroupSize.y);
+    }
+
+    for (auto& id : m_Selection)
+    {
+        BinaryWrite(out, static_cast<uint64_t>(id.Get()));
+        BinaryWrite(out, static_cast<uint32_t>(id.Type()));
+    }
+
+    IM_ASSERT(out == data.data() + data.size());
+}
+
+bool ed::Settings::ParseBinary(const char* data, size_t size, Settings& settings)
+{
+    // Validate chunk layout up front, so a truncated buffer leaves settings untouched
+    size_t totalNodeCount = 0;
+    for (size_t offset = 0; offset < size; )
+    {
+        if (size - offset < c_BinaryHeaderSize)
+            return false;
+
+        auto in = data + offset;
+        if (BinaryRead<uint32_t>(in) != c_BinarySettingsMagic || BinaryRead<uint32_t>(in) != c_BinarySettingsVersion)
+            return false;
+
+        const auto nodeCount      = static_cast<size_t>(BinaryRead<uint32_t>(in));
+        const auto selectionCount = static_cast<size_t>(BinaryRead<uint32_t>(in));
+        const auto chunkSize      = c_BinaryHeaderSize + nodeCount * c_BinaryNodeSize + selectionCount * c_BinaryObjectIdSize;
+        if (size - offset < chunkSize)
+            return false;
+
+        offset += chunkSize;
+        totalNodeCount += nodeCount;
+    }
+
+    settings.m_Nodes.reserve(settings.m_Nodes.size() + totalNodeCount);
+
+    for (auto in = data, end = data + size; in < end; )
+    {
+        in += 2 * sizeof(uint32_t);
+        const auto nodeCount      = BinaryRead<uint32_t>(in);
+        const auto selectionCount = BinaryRead<uint32_t>(in);
+        in += sizeof(uint32_t);
+
+        settings.m_ViewScroll.x      = BinaryRead<float>(in);
+        settings.m_ViewScroll.y      = BinaryRead<float>(in);
+        settings.m_ViewZoom          = BinaryRead<float>(in);
+        settings.m_VisibleRect.Min.x = BinaryRead<float>(in);
+        settings.m_VisibleRect.Min.y = BinaryRead<float>(in);
+        settings.m_VisibleRect.Max.x = BinaryRead<float>(in);
+        settings.m_VisibleRect.Max.y = BinaryRead<float>(in);
+
+        for (uint32_t i = 0; i < nodeCount; ++i)
+        {
+            const auto id     = NodeId(static_cast<uintptr_t>(BinaryRead<uint64_t>(in)));
+            const auto reason = static_cast<SaveReasonFlags>(BinaryRead<uint32_t>(in));
+
+            auto node = settings.FindNode(id);
+            if ((reason & SaveReasonFlags::RemoveNode) != SaveReasonFlags::None)
+            {
+                if (node)
+                    *node = NodeSettings(id);
+                in += 6 * sizeof(float);
+                continue;
+            }
+
+            if (!node)
+                node = settings.AddNode(id);
+
+            node->m_Location.x  = BinaryRead<float>(in);
+            node->m_Location.y  = BinaryRead<float>(in);
+            node->m_Size.x      = BinaryRead<float>(in);
+            node->m_Size.y      = BinaryRead<float>(in);
+            node->m_GroupSize.x = BinaryRead<float>(in);
+            node->m_GroupSize.y = BinaryRead<float>(in);
+        }
+
+        settings.m_Selection.resize(0);
+        for (uint32_t i = 0; i < selectionCount; ++i)
+        {
+            const auto id   = static_cast<uintptr_t>(BinaryRead<uint64_t>(in));
+            const auto type = static_cast<ObjectType>(BinaryRead<uint32_t>(in));
+            switch (type)
+            {
+                case ObjectType::Node: settings.m_Selection.push_back(NodeId(id)); break;
+                case ObjectType::Link: settings.m_Selection.push_back(LinkId(id)); break;
+                case ObjectType::Pin:  settings.m_Selection.push_back(PinId(id));  break;
+                default: break;
+            }
+        }
+    }
+
+    return true;
+}
+
 /*std::string ed::Settings::Serialize()
 {
     json::value result;
@@ -3625,6 +4375,17 @@ ImRect ed::NavigateAction::GetViewRect() const
     return m_Canvas.CalcViewRect(GetView());
 }
 
+void ed::NavigateAction::CenterView(const ImVec2& canvasPoint)
+{
+    StopNavigation();
+
+    auto view = m_Canvas.CalcCenterView(canvasPoint);
+    m_Scroll      = -view.Origin;
+    m_VisibleRect = GetViewRect();
+
+    Editor->MakeDirty(SaveReasonFlags::Navigation);
+}
+
 float ed::NavigateAction::GetNextZoom(float steps)
 {
     if (this->Editor->GetConfig().EnableSmoothZoom)
@@ -3797,6 +4558,7 @@ bool ed::SizeAction::Process(const Control& control)
         }
 
         m_SizedNode = nullptr;
+        Editor->MarkNodeOrderDirty();
     }
 
     if (!m_IsActive)
@@ -3836,6 +4598,8 @@ bool ed::SizeAction::Process(const Control& control)
         m_SizedNode->m_GroupBounds.Min.y -= m_StartBounds.Min.y - m_StartGroupBounds.Min.y;
         m_SizedNode->m_GroupBounds.Max.x -= m_StartBounds.Max.x - m_StartGroupBounds.Max.x;
         m_SizedNode->m_GroupBounds.Max.y -= m_StartBounds.Max.y - m_StartGroupBounds.Max.y;
+
+        Editor->MarkBoundsDirty(m_SizedNode);
     }
     else if (!control.ActiveNode)
     {
@@ -4699,7 +5463,7 @@ bool ed::CreateItemAction::Process(const Control& control)
         auto drawList = Editor->GetDrawList();
         drawList->ChannelsSetCurrent(c_LinkChannel_NewLink);
 
-        candidate.UpdateEndpoints();
+        candidate.UpdateEndpoints(false);
         candidate.Draw(drawList, m_LinkColor, m_LinkThickness);
     }
     else if (m_CurrentStage == Possible || !control.ActivePin)
@@ -5224,7 +5988,10 @@ ed::Object* ed::DeleteItemsAction::DropCurrentItem()
 ed::NodeBuilder::NodeBuilder(EditorContext* editor):
     Editor(editor),
     m_CurrentNode(nullptr),
-    m_CurrentPin(nullptr)
+    m_CurrentPin(nullptr),
+    m_IsGroup(false),
+    m_SkipContents(false),
+    m_PreviousLastPin(nullptr)
 {
 }
 
@@ -5280,6 +6047,9 @@ void ed::NodeBuilder::Begin(NodeId nodeId)
 
     const auto alpha = ImGui::GetStyle().Alpha;
 
+    m_PreviousLastPin = m_CurrentNode->m_LastPin;
+    m_SkipContents    = false;
+
     m_CurrentNode->m_IsLive           = true;
     m_CurrentNode->m_LastPin          = nullptr;
     m_CurrentNode->m_Color            = Editor->GetColor(StyleColor_NodeBg, alpha);
@@ -5345,6 +6115,30 @@ void ed::NodeBuilder::End()
     m_NodeRect = ImGui_GetItemRect();
     m_NodeRect.Floor();
 
+    if (m_SkipContents)
+    {
+        // Nothing was submitted, revive pins from last frame and move them along with the node
+        const auto offset = m_CurrentNode->m_Bounds.Min - m_CurrentNode->m_PinOrigin;
+
+        m_CurrentNode->m_LastPin = m_PreviousLastPin;
+        for (auto pin = m_CurrentNode->m_LastPin; pin; pin = pin->m_PreviousPin)
+        {
+            if (pin->m_DeleteOnNewFrame)
+                continue;
+
+            pin->m_Bounds.Translate(offset);
+            pin->m_Pivot.Translate(offset);
+            pin->m_IsLive = true;
+        }
+
+        m_CurrentNode->m_PinOrigin = m_CurrentNode->m_Bounds.Min;
+        m_CurrentNode = nullptr;
+        return;
+    }
+
+    m_CurrentNode->m_PinOrigin   = m_CurrentNode->m_Bounds.Min;
+    m_CurrentNode->m_HasContents = true;
+
     if (m_CurrentNode->m_Bounds.GetSize() != m_NodeRect.GetSize())
     {
         m_CurrentNode->m_Bounds.Max = m_CurrentNode->m_Bounds.Min + m_NodeRect.GetSize();
@@ -5357,12 +6151,20 @@ void ed::NodeBuilder::End()
         for (auto pin = m_CurrentNode->m_LastPin; pin; pin = pin->m_PreviousPin)
             pin->Reset();
 
+        if (m_CurrentNode->m_Type != NodeType::Group || m_CurrentNode->m_GroupBounds.GetSize() != m_GroupBounds.GetSize())
+            Editor->MarkNodeOrderDirty();
+
         m_CurrentNode->m_Type        = NodeType::Group;
         m_CurrentNode->m_GroupBounds = m_GroupBounds;
         m_CurrentNode->m_LastPin     = nullptr;
     }
     else
+    {
+        if (m_CurrentNode->m_Type != NodeType::Node)
+            Editor->MarkNodeOrderDirty();
+
         m_CurrentNode->m_Type        = NodeType::Node;
+    }
 
     m_CurrentNode = nullptr;
 }
@@ -5504,6 +6306,22 @@ void ed::NodeBuilder::Group(const ImVec2& size)
     m_GroupBounds.Floor();
 }
 
+void ed::NodeBuilder::SetTitle(const char* title)
+{
+    IM_ASSERT(nullptr != m_CurrentNode);
+
+    if (m_CurrentNode->m_Title != title)
+        m_CurrentNode->m_Title = title;
+}
+
+void ed::NodeBuilder::SkipContents()
+{
+    IM_ASSERT(nullptr != m_CurrentNode);
+    IM_ASSERT(nullptr == m_CurrentNode->m_LastPin); // Pins were already submitted
+
+    m_SkipContents = true;
+}
+
 ImDrawList* ed::NodeBuilder::GetUserBackgroundDrawList() const
 {
     return GetUserBackgroundDrawList(m_CurrentNode);
@@ -5763,6 +6581,7 @@ float* ed::Style::GetVarFloatAddr(StyleVar idx)
         case StyleVar_SnapLinkToPinDir:         return &SnapLinkToPinDir;
         case StyleVar_HoveredNodeBorderOffset:  return &HoverNodeBorderOffset;
         case StyleVar_SelectedNodeBorderOffset: return &SelectedNodeBorderOffset;
+        case StyleVar_LodZoomThreshold:         return &LodZoomThreshold;
         default:                                return nullptr;
     }
 }
@@ -5850,6 +6669,23 @@ std::string ed::Config::LoadNode(NodeId nodeId)
     return data;
 }
 
+ed::vector<char> ed::Config::LoadBinary()
+{
+    vector<char> data;
+
+    if (LoadSettingsBinary)
+    {
+        const auto size = LoadSettingsBinary(nullptr, UserPointer);
+        if (size > 0)
+        {
+            data.resize(size);
+            LoadSettingsBinary(data.data(), UserPointer);
+        }
+    }
+
+    return data;
+}
+
 void ed::Config::BeginSave()
 {
     if (BeginSaveSession)
@@ -5882,6 +6718,14 @@ bool ed::Config::SaveNode(NodeId nodeId, const std::string& data, SaveReasonFlag
     return false;
 }
 
+bool ed::Config::SaveBinary(const vector<char>& data, SaveReasonFlags flags)
+{
+    if (SaveSettingsBinary)
+        return SaveSettingsBinary(data.data(), data.size(), flags, UserPointer);
+
+    return false;
+}
+
 void ed::Config::EndSave()
 {
     if (EndSaveSession)
@@ -95,6 +95,11 @@ using ConfigLoadSettings     = size_t (*)(char* data, void* userPointer);
 using ConfigSaveNodeSettings = bool   (*)(NodeId nodeId, const char* data, size_t size, SaveReasonFlags reason, void* userPointer);
 using ConfigLoadNodeSettings = size_t (*)(NodeId nodeId, char* data, void* userPointer);
 
+// Binary settings carry every dirty node in a single buffer. Saved buffers may be
+// concatenated by the host and returned as one from load, later records win.
+using ConfigSaveSettingsBinary = bool   (*)(const char* data, size_t size, SaveReasonFlags reason, void* userPointer);
+using ConfigLoadSettingsBinary = size_t (*)(char* data, void* userPointer);
+
 using ConfigSession          = void   (*)(void* userPointer);
 
 using NodeDraggedCallback    = void   (*)(NodeId nodeId, float oldX, float oldY, float newX, float newY, void* userPointer);
@@ -113,6 +118,8 @@ struct Config
     ConfigLoadSettings      LoadSettings;
     ConfigSaveNodeSettings  SaveNodeSettings;
     ConfigLoadNodeSettings  LoadNodeSettings;
+    ConfigSaveSettingsBinary SaveSettingsBinary;   // Replaces SaveSettings and SaveNodeSettings when set
+    ConfigLoadSettingsBinary LoadSettingsBinary;   // Replaces LoadSettings when set
     NodeDraggedCallback     NodeDraggedHook;
     NodeResizedCallback     NodeResizedHook;
     void*                   UserPointer;
@@ -133,6 +140,8 @@ struct Config
         , LoadSettings(nullptr)
         , SaveNodeSettings(nullptr)
         , LoadNodeSettings(nullptr)
+        , SaveSettingsBinary(nullptr)
+        , LoadSettingsBinary(nullptr)
         , NodeDraggedHook(nullptr)
         , NodeResizedHook(nullptr)
         , UserPointer(nullptr)
@@ -208,6 +217,7 @@ enum StyleVar
     StyleVar_SnapLinkToPinDir,
     StyleVar_HoveredNodeBorderOffset,
     StyleVar_SelectedNodeBorderOffset,
+    StyleVar_LodZoomThreshold,
 
     StyleVar_Count
 };
@@ -241,6 +251,7 @@ struct Style
     float   GroupBorderWidth;
     float   HighlightConnectedLinks;
     float   SnapLinkToPinDir; // when true link will start on the line defined by pin direction
+    float   LodZoomThreshold; // below this view scale nodes are drawn as titled rectangles and links as coarse curves, 0 disables
     ImVec4  Colors[StyleColor_Count];
 
     Style()
@@ -276,6 +287,7 @@ struct Style
         GroupBorderWidth         = 1.0f;
         HighlightConnectedLinks  = 0.0f;
         SnapLinkToPinDir         = 0.0f;
+        LodZoomThreshold         = 0.0f;
 
         Colors[StyleColor_Bg]                 = ImColor( 60,  60,  70, 200);
         Colors[StyleColor_Grid]               = ImColor(120, 120, 120,  40);
@@ -300,6 +312,49 @@ struct Style
 };
 
 
+//------------------------------------------------------------------------------
+enum class LayoutMode
+{
+    Auto,         // Layered, force directed for parts of the graph with many cycles
+    Layered,
+    ForceDirected
+};
+
+struct LayoutOptions
+{
+    LayoutMode Mode;
+    ImVec2     Spacing;              // Gap between layers (x) and between nodes of a layer (y)
+    float      ComponentSpacing;     // Gap between unconnected parts of the graph
+    int        SweepIterations;      // Crossing minimization passes over all layers
+    int        OrderingTrials;       // Independent crossing minimization runs per connected part, fewest crossings wins
+    int        ForceIterations;      // Force directed simulation steps
+    float      MaxReversedEdgeRatio; // Auto mode uses force directed when a larger fraction of links has to be reversed to break cycles
+    int        ThreadCount;          // Worker threads, 0 uses hardware concurrency
+
+    LayoutOptions()
+        : Mode(LayoutMode::Auto)
+        , Spacing(120.0f, 40.0f)
+        , ComponentSpacing(160.0f)
+        , SweepIterations(8)
+        , OrderingTrials(4)
+        , ForceIterations(300)
+        , MaxReversedEdgeRatio(0.25f)
+        , ThreadCount(0)
+    {
+    }
+};
+
+
+//------------------------------------------------------------------------------
+enum class MinimapLocation
+{
+    TopLeft,
+    TopRight,
+    BottomLeft,
+    BottomRight
+};
+
+
 //------------------------------------------------------------------------------
 struct EditorContext;
 
@@ -336,6 +391,11 @@ IMGUI_NODE_EDITOR_API void EndPin();
 IMGUI_NODE_EDITOR_API void Group(const ImVec2& size);
 IMGUI_NODE_EDITOR_API void EndNode();
 
+IMGUI_NODE_EDITOR_API bool IsNodeCulled(NodeId nodeId); // Returns true if node contents do not need to be submitted this frame (node is off screen or drawn at level of detail)
+IMGUI_NODE_EDITOR_API bool IsLodActive(); // Returns true if view is zoomed out below Style::LodZoomThreshold
+IMGUI_NODE_EDITOR_API void SetNodeTitle(const char* title); // Title drawn for current node at level of detail
+IMGUI_NODE_EDITOR_API void SkipNodeContents(); // Call between BeginNode/EndNode instead of submitting contents, node keeps its size and pins from last frame
+
 IMGUI_NODE_EDITOR_API bool BeginGroupHint(NodeId nodeId);
 IMGUI_NODE_EDITOR_API ImVec2 GetGroupMin();
 IMGUI_NODE_EDITOR_API ImVec2 GetGroupMax();
@@ -376,6 +436,15 @@ IMGUI_NODE_EDITOR_API void CenterNodeOnScreen(NodeId nodeId);
 IMGUI_NODE_EDITOR_API void SetNodeZPosition(NodeId nodeId, float z); // Sets node z position, nodes with higher value are drawn over nodes with lower value
 IMGUI_NODE_EDITOR_API float GetNodeZPosition(NodeId nodeId); // Returns node z position, defaults is 0.0f
 
+IMGUI_NODE_EDITOR_API void SetNodePositions(const NodeId* nodeIds, const ImVec2* editorPositions, int count); // Same as SetNodePosition for each node
+IMGUI_NODE_EDITOR_API void SetGroupSizes(const NodeId* nodeIds, const ImVec2* sizes, int count);              // Same as SetGroupSize for each node
+IMGUI_NODE_EDITOR_API void GetNodePositions(const NodeId* nodeIds, ImVec2* positions, int count);             // Same as GetNodePosition for each node
+IMGUI_NODE_EDITOR_API void GetNodeSizes(const NodeId* nodeIds, ImVec2* sizes, int count);                     // Same as GetNodeSize for each node
+IMGUI_NODE_EDITOR_API int GetNodeRects(NodeId* nodeIds, ImVec4* rects, int size, bool visibleOnly = false);   // Fills node id's with their bounds (min x, min y, max x, max y) in canvas space, optionally only nodes overlapping the view; up to 'size' elements are set. Returns actual size of filled id's.
+
+IMGUI_NODE_EDITOR_API void AutoLayout(const LayoutOptions& options = LayoutOptions());                                   // Positions every submitted node, call after End() so node sizes and links are known
+IMGUI_NODE_EDITOR_API void AutoLayoutNodes(const NodeId* nodeIds, int count, const LayoutOptions& options = LayoutOptions()); // Positions only given nodes next to the nodes they link to, others stay in place
+
 IMGUI_NODE_EDITOR_API void RestoreNodeState(NodeId nodeId);
 
 IMGUI_NODE_EDITOR_API void Suspend();
@@ -407,6 +476,8 @@ IMGUI_NODE_EDITOR_API int BreakLinks(PinId pinId); // Break all links connected
 IMGUI_NODE_EDITOR_API void NavigateToContent(float duration = -1);
 IMGUI_NODE_EDITOR_API void NavigateToSelection(bool zoomIn = false, float duration = -1);
 
+IMGUI_NODE_EDITOR_API void ShowMinimap(float sizeFraction = 0.2f, MinimapLocation location = MinimapLocation::BottomRight); // Call between Begin/End every frame it should be visible. Click or drag on it to move the view.
+
 IMGUI_NODE_EDITOR_API bool ShowNodeContextMenu(NodeId* nodeId);
 IMGUI_NODE_EDITOR_API bool ShowPinContextMenu(PinId* pinId);
 IMGUI_NODE_EDITOR_API bool ShowLinkContextMenu(LinkId* linkId);
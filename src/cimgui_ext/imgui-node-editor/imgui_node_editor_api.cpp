@@ -193,6 +193,26 @@ void ax::NodeEditor::EndNode()
     s_Editor->GetNodeBuilder().End();
 }
 
+bool ax::NodeEditor::IsNodeCulled(NodeId nodeId)
+{
+    return s_Editor->IsNodeCulled(nodeId);
+}
+
+bool ax::NodeEditor::IsLodActive()
+{
+    return s_Editor->IsLodActive();
+}
+
+void ax::NodeEditor::SetNodeTitle(const char* title)
+{
+    s_Editor->GetNodeBuilder().SetTitle(title);
+}
+
+void ax::NodeEditor::SkipNodeContents()
+{
+    s_Editor->GetNodeBuilder().SkipContents();
+}
+
 bool ax::NodeEditor::BeginGroupHint(NodeId nodeId)
 {
     return s_Editor->GetHintBuilder().Begin(nodeId);
@@ -407,6 +427,45 @@ ImVec2 ax::NodeEditor::GetNodeSize(NodeId nodeId)
     return s_Editor->GetNodeSize(nodeId);
 }
 
+void ax::NodeEditor::SetNodePositions(const NodeId* nodeIds, const ImVec2* positions, int count)
+{
+    for (int i = 0; i < count; ++i)
+        s_Editor->SetNodePosition(nodeIds[i], positions[i]);
+}
+
+void ax::NodeEditor::SetGroupSizes(const NodeId* nodeIds, const ImVec2* sizes, int count)
+{
+    for (int i = 0; i < count; ++i)
+        s_Editor->SetGroupSize(nodeIds[i], sizes[i]);
+}
+
+void ax::NodeEditor::GetNodePositions(const NodeId* nodeIds, ImVec2* positions, int count)
+{
+    for (int i = 0; i < count; ++i)
+        positions[i] = s_Editor->GetNodePosition(nodeIds[i]);
+}
+
+void ax::NodeEditor::GetNodeSizes(const NodeId* nodeIds, ImVec2* sizes, int count)
+{
+    for (int i = 0; i < count; ++i)
+        sizes[i] = s_Editor->GetNodeSize(nodeIds[i]);
+}
+
+int ax::NodeEditor::GetNodeRects(NodeId* nodeIds, ImVec4* rects, int size, bool visibleOnly)
+{
+    return s_Editor->GetNodeRects(nodeIds, rects, size, visibleOnly);
+}
+
+void ax::NodeEditor::AutoLayout(const LayoutOptions& options)
+{
+    s_Editor->AutoLayout(nullptr, 0, options);
+}
+
+void ax::NodeEditor::AutoLayoutNodes(const NodeId* nodeIds, int count, const LayoutOptions& options)
+{
+    s_Editor->AutoLayout(nodeIds, count, options);
+}
+
 void ax::NodeEditor::CenterNodeOnScreen(NodeId nodeId)
 {
     if (auto node = s_Editor->FindNode(nodeId))
@@ -576,6 +635,11 @@ void ax::NodeEditor::NavigateToSelection(bool zoomIn, float duration)
     s_Editor->NavigateTo(s_Editor->GetSelectionBounds(), zoomIn, duration);
 }
 
+void ax::NodeEditor::ShowMinimap(float sizeFraction, MinimapLocation location)
+{
+    s_Editor->GetMinimap().Show(sizeFraction, location);
+}
+
 bool ax::NodeEditor::ShowNodeContextMenu(NodeId* nodeId)
 {
     return s_Editor->GetContextMenu().ShowNodeContextMenu(nodeId);
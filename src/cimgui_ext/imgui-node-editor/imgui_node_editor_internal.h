@@ -32,6 +32,7 @@
 
 # include <vector>
 # include <string>
+# include <unordered_map>
 
 
 //------------------------------------------------------------------------------
@@ -201,6 +202,121 @@ struct ObjectWrapper
     }
 };
 
+// Open addressing (linear probing) map from object id to object.
+// Lookups are called per object per frame from the C API, so they must not
+// scan the object lists.
+template <typename T, typename Id = typename T::IdType>
+struct ObjectIdMap
+{
+    ObjectIdMap()
+        : m_Count(0)
+    {
+    }
+
+    T* Find(Id id) const
+    {
+        if (m_Slots.empty())
+            return nullptr;
+
+        const auto key  = Key(id);
+        const auto mask = m_Slots.size() - 1;
+        for (auto i = Hash(key) & mask; m_Slots[i].m_Object; i = (i + 1) & mask)
+            if (m_Slots[i].m_Key == key)
+                return m_Slots[i].m_Object;
+
+        return nullptr;
+    }
+
+    void Insert(Id id, T* object)
+    {
+        if ((m_Count + 1) * 2 > m_Slots.size())
+            Rehash(m_Slots.empty() ? 16 : m_Slots.size() * 2);
+
+        if (Place(Key(id), object))
+            ++m_Count;
+    }
+
+    void Erase(Id id)
+    {
+        if (m_Slots.empty())
+            return;
+
+        const auto key  = Key(id);
+        const auto mask = m_Slots.size() - 1;
+        auto i = Hash(key) & mask;
+        while (m_Slots[i].m_Object && m_Slots[i].m_Key != key)
+            i = (i + 1) & mask;
+        if (!m_Slots[i].m_Object)
+            return;
+
+        // Backward shift deletion, keeps probe sequences intact without tombstones
+        m_Slots[i].m_Object = nullptr;
+        --m_Count;
+        for (auto j = (i + 1) & mask; m_Slots[j].m_Object; j = (j + 1) & mask)
+        {
+            const auto home = Hash(m_Slots[j].m_Key) & mask;
+            const auto movable = (i <= j) ? (home <= i || home > j) : (home <= i && home > j);
+            if (!movable)
+                continue;
+
+            m_Slots[i] = m_Slots[j];
+            m_Slots[j].m_Object = nullptr;
+            i = j;
+        }
+    }
+
+    size_t Size() const { return m_Count; }
+
+private:
+    struct Slot
+    {
+        uintptr_t m_Key;
+        T*        m_Object;
+    };
+
+    static uintptr_t Key(Id id) { return reinterpret_cast<uintptr_t>(id.AsPointer()); }
+
+    static size_t Hash(uintptr_t key)
+    {
+        uint64_t h = key;
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        return static_cast<size_t>(h);
+    }
+
+    bool Place(uintptr_t key, T* object)
+    {
+        const auto mask = m_Slots.size() - 1;
+        auto i = Hash(key) & mask;
+        while (m_Slots[i].m_Object)
+        {
+            if (m_Slots[i].m_Key == key)
+            {
+                m_Slots[i].m_Object = object;
+                return false;
+            }
+            i = (i + 1) & mask;
+        }
+
+        m_Slots[i].m_Key    = key;
+        m_Slots[i].m_Object = object;
+        return true;
+    }
+
+    void Rehash(size_t capacity)
+    {
+        vector<Slot> slots(capacity, Slot{ 0, nullptr });
+        m_Slots.swap(slots);
+        for (auto& slot : slots)
+            if (slot.m_Object)
+                Place(slot.m_Key, slot.m_Object);
+    }
+
+    vector<Slot> m_Slots;
+    size_t       m_Count;
+};
+
 struct Object
 {
     enum DrawFlags
@@ -222,11 +338,21 @@ struct Object
     bool    m_IsSelected;
     bool    m_DeleteOnNewFrame;
 
+    // Owned by SpatialIndex
+    ImRect   m_IndexBounds;
+    bool     m_IsIndexed;
+    bool     m_IsIndexDirty;
+    uint32_t m_IndexQueryStamp;
+
     Object(EditorContext* editor)
         : Editor(editor)
         , m_IsLive(true)
         , m_IsSelected(false)
         , m_DeleteOnNewFrame(false)
+        , m_IndexBounds()
+        , m_IsIndexed(false)
+        , m_IsIndexDirty(false)
+        , m_IndexQueryStamp(0)
     {
     }
 
@@ -385,6 +511,7 @@ struct Node final: Object
     NodeType m_Type;
     ImRect   m_Bounds;
     float    m_ZPosition;
+    int      m_Order; // increases along m_Nodes, breaks ties between overlapping nodes
     int      m_Channel;
     Pin*     m_LastPin;
     ImVec2   m_DragStart;
@@ -405,12 +532,19 @@ struct Node final: Object
     bool     m_RestoreState;
     bool     m_CenterOnScreen;
 
+    string   m_Title;     // drawn at level of detail
+    ImVec2   m_PinOrigin; // node position when pins were last submitted
+    bool     m_HasContents;
+
+    vector<Link*> m_ConnectedLinks; // links whose start or end pin belongs to this node
+
     Node(EditorContext* editor, NodeId id)
         : Object(editor)
         , m_ID(id)
         , m_Type(NodeType::Node)
         , m_Bounds()
         , m_ZPosition(0.0f)
+        , m_Order(0)
         , m_Channel(0)
         , m_LastPin(nullptr)
         , m_DragStart()
@@ -422,6 +556,10 @@ struct Node final: Object
         , m_HighlightConnectedLinks(false)
         , m_RestoreState(false)
         , m_CenterOnScreen(false)
+        , m_Title()
+        , m_PinOrigin()
+        , m_HasContents(false)
+        , m_ConnectedLinks()
     {
     }
 
@@ -449,10 +587,42 @@ struct Node final: Object
     virtual Node* AsNode() override final { return this; }
 };
 
+// Everything a link's draw list output depends on, except color.
+struct LinkGeometryKey
+{
+    ImCubicBezierPoints m_Curve;
+    float  m_Thickness;
+    float  m_StartArrowSize;
+    float  m_StartArrowWidth;
+    float  m_EndArrowSize;
+    float  m_EndArrowWidth;
+    ImVec2 m_StartDirHint;
+    ImVec2 m_EndDirHint;
+    bool   m_HasStartDirHint;
+    bool   m_HasEndDirHint;
+    float  m_FringeScale;
+    ImVec2 m_TexUvWhitePixel;
+    int    m_DrawListFlags;
+
+    bool operator==(const LinkGeometryKey& rhs) const;
+};
+
+// Vertices and indices emitted for a link, appended to the draw list again
+// while the key matches instead of tessellating the curve every frame.
+struct LinkGeometry
+{
+    LinkGeometryKey      m_Key;
+    ImVector<ImDrawVert> m_Vertices;
+    ImVector<ImDrawIdx>  m_Indices; // relative to first vertex
+};
+
 struct Link final: Object
 {
     using IdType = LinkId;
 
+    // Regular look plus one of selected/hovered/highlighted
+    static const int c_GeometryCacheSize = 2;
+
     LinkId m_ID;
     Pin*   m_StartPin;
     Pin*   m_EndPin;
@@ -461,6 +631,14 @@ struct Link final: Object
     float  m_Thickness;
     ImVec2 m_Start;
     ImVec2 m_End;
+    ImCubicBezierPoints m_Curve;       // refreshed by UpdateEndpoints
+    ImRect              m_CurveBounds; // m_Curve with arrows
+    ImVec2              m_ArrowSizes;  // start and end arrow sizes m_CurveBounds was built with
+    bool                m_IsCurveValid;
+    Node*  m_ConnectedNodes[2];        // nodes listing this link in m_ConnectedLinks
+
+    mutable LinkGeometry m_Geometry[c_GeometryCacheSize];
+    mutable int          m_NextGeometry;
 
     Link(EditorContext* editor, LinkId id)
         : Object(editor)
@@ -469,6 +647,13 @@ struct Link final: Object
         , m_EndPin(nullptr)
         , m_Color(IM_COL32_WHITE)
         , m_Thickness(1.0f)
+        , m_Curve()
+        , m_CurveBounds()
+        , m_ArrowSizes()
+        , m_IsCurveValid(false)
+        , m_ConnectedNodes{ nullptr, nullptr }
+        , m_Geometry()
+        , m_NextGeometry(0)
     {
     }
 
@@ -479,9 +664,11 @@ struct Link final: Object
     virtual void Draw(ImDrawList* drawList, DrawFlags flags = None) override final;
     void Draw(ImDrawList* drawList, ImU32 color, float extraThickness = 0.0f) const;
 
-    void UpdateEndpoints();
+    // index = false for preview links that are not owned by the editor, they must never
+    // enter the spatial index
+    void UpdateEndpoints(bool index = true);
 
-    ImCubicBezierPoints GetCurve() const;
+    ImCubicBezierPoints GetCurve() const { return m_Curve; }
 
     virtual bool TestHit(const ImVec2& point, float extraThickness = 0.0f) const override final;
     virtual bool TestHit(const ImRect& rect, bool allowIntersect = true) const override final;
@@ -489,6 +676,51 @@ struct Link final: Object
     virtual ImRect GetBounds() const override final;
 
     virtual Link* AsLink() override final { return this; }
+
+private:
+    ImCubicBezierPoints CalculateCurve() const;
+    ImRect CalculateBounds() const;
+};
+
+// Uniform grid over object bounds in canvas space. Objects are re-inserted
+// lazily: moving one only marks it dirty, and the next query re-buckets the
+// dirty objects, so hit-testing never scans every node or link.
+struct SpatialIndex
+{
+    SpatialIndex(float cellSize = 256.0f)
+        : m_CellSize(cellSize)
+        , m_QueryStamp(0)
+        , m_Revision(0)
+    {
+    }
+
+    void MarkDirty(Object* object);
+    void Remove(Object* object);
+
+    // Changes whenever an indexed object moves, resizes or is removed.
+    uint32_t GetRevision() const { return m_Revision; }
+
+    // Objects whose bounds overlap rect, each reported once, in no particular order.
+    void Query(const ImRect& rect, vector<Object*>& result);
+
+private:
+    // Objects spanning more cells than this are kept in a list tested by every query.
+    static const int c_MaxCellsPerObject = 64;
+
+    bool GetCellRange(const ImRect& rect, int& minX, int& minY, int& maxX, int& maxY) const;
+    static uint64_t CellKey(int x, int y) { return (uint64_t)(uint32_t)x << 32 | (uint32_t)y; }
+
+    void Insert(Object* object);
+    void Unlink(Object* object);
+    void Flush();
+    void Collect(const vector<Object*>& objects, const ImRect& rect, vector<Object*>& result);
+
+    float                                        m_CellSize;
+    uint32_t                                     m_QueryStamp;
+    uint32_t                                     m_Revision;
+    std::unordered_map<uint64_t, vector<Object*>> m_Cells;
+    vector<Object*>                              m_Oversized;
+    vector<Object*>                              m_Dirty;
 };
 
 struct NodeSettings
@@ -541,6 +773,7 @@ struct Settings
         , m_ViewScroll(0, 0)
         , m_ViewZoom(1.0f)
         , m_VisibleRect()
+        , m_NodeMapData(nullptr)
     {
     }
 
@@ -554,6 +787,18 @@ struct Settings
     //std::string Serialize();
 
     //static bool Parse(const std::string& string, Settings& settings);
+
+    // Appends one chunk holding view, selection and the given node settings.
+    void SerializeBinary(vector<char>& data, const vector<NodeSettings*>& nodes, SaveReasonFlags reason) const;
+
+    // Applies every chunk in data in a single pass. Nothing is applied if data is malformed.
+    static bool ParseBinary(const char* data, size_t size, Settings& settings);
+
+private:
+    void UpdateNodeMap();
+
+    ObjectIdMap<NodeSettings, NodeId> m_NodeMap;
+    const NodeSettings*               m_NodeMapData; // m_Nodes storage the map points into
 };
 
 struct Control
@@ -866,6 +1111,7 @@ struct NavigateAction final: EditorAction
 
     void SetViewRect(const ImRect& rect);
     ImRect GetViewRect() const;
+    void CenterView(const ImVec2& canvasPoint);
 
 private:
     ImGuiEx::Canvas&   m_Canvas;
@@ -1189,6 +1435,9 @@ struct NodeBuilder
     ImRect m_GroupBounds;
     bool   m_IsGroup;
 
+    bool   m_SkipContents;
+    Pin*   m_PreviousLastPin;
+
     ImDrawListSplitter m_Splitter;
     ImDrawListSplitter m_PinSplitter;
 
@@ -1209,6 +1458,9 @@ struct NodeBuilder
 
     void Group(const ImVec2& size);
 
+    void SetTitle(const char* title);
+    void SkipContents();
+
     ImDrawList* GetUserBackgroundDrawList() const;
     ImDrawList* GetUserBackgroundDrawList(Node* node) const;
 };
@@ -1233,6 +1485,45 @@ struct HintBuilder
     ImDrawList* GetBackgroundDrawList();
 };
 
+// Overview of the whole graph in a corner of the canvas. Nodes and links are drawn
+// into a texture that is only redrawn when the spatial indices change, every frame
+// costs one image and the view rectangle (imgui_node_editor_minimap.cpp).
+struct Minimap
+{
+    EditorContext* const Editor;
+
+    Minimap(EditorContext* editor);
+    ~Minimap();
+
+    void Show(float sizeFraction, MinimapLocation location);
+
+    // Called in Begin, before any node claims the mouse. Uses last frame's placement.
+    void Process();
+    // Called in End, in screen space after the canvas.
+    void Draw(ImDrawList* drawList);
+
+private:
+    ImVec2 ToMinimap(const ImVec2& canvasPoint) const; // canvas space to 0..1 across m_ScreenRect
+    ImVec2 FromMinimap(const ImVec2& point) const;
+    bool   UpdateTexture(int width, int height); // true when the texture was recreated
+    void   Redraw();
+    void   Retire(ImTextureData* texture);
+    static void OnShutdown(ImGuiContext* context, ImGuiContextHook* hook);
+
+    bool            m_IsShown;
+    bool            m_WasShown;
+    float           m_SizeFraction;
+    MinimapLocation m_Location;
+    ImRect          m_ScreenRect;
+    ImRect          m_Content;     // canvas space shown, content bounds grown to the minimap aspect
+    ImTextureData*  m_Texture;
+    ImGuiContext*   m_TextureContext; // ImGui context the texture is registered with, cleared when it shuts down
+    ImGuiID         m_ShutdownHook;
+    uint32_t        m_Revision;    // geometry revision the texture was drawn for
+    uint64_t        m_SelectionId;
+    double          m_RedrawTime;
+};
+
 struct Style: ax::NodeEditor::Style
 {
     void PushColor(StyleColor colorIndex, const ImVec4& color);
@@ -1272,10 +1563,12 @@ struct Config: ax::NodeEditor::Config
 
     std::string Load();
     std::string LoadNode(NodeId nodeId);
+    vector<char> LoadBinary();
 
     void BeginSave();
     bool Save(const std::string& data, SaveReasonFlags flags);
     bool SaveNode(NodeId nodeId, const std::string& data, SaveReasonFlags flags);
+    bool SaveBinary(const vector<char>& data, SaveReasonFlags flags);
     void EndSave();
 };
 
@@ -1312,12 +1605,16 @@ struct EditorContext
     CreateItemAction& GetItemCreator() { return m_CreateItemAction; }
     DeleteItemsAction& GetItemDeleter() { return m_DeleteItemsAction; }
     ContextMenuAction& GetContextMenu() { return m_ContextMenuAction; }
+    Minimap& GetMinimap() { return m_Minimap; }
     ShortcutAction& GetShortcut() { return m_ShortcutAction; }
 
     const ImGuiEx::CanvasView& GetView() const { return m_Canvas.View(); }
     const ImRect& GetViewRect() const { return m_Canvas.ViewRect(); }
     const ImRect& GetRect() const { return m_Canvas.Rect(); }
 
+    bool IsLodActive() const;
+    bool IsNodeCulled(NodeId nodeId);
+
     void SetNodePosition(NodeId nodeId, const ImVec2& screenPosition);
     void SetGroupSize(NodeId nodeId, const ImVec2& size);
     ImVec2 GetNodePosition(NodeId nodeId);
@@ -1343,6 +1640,11 @@ struct EditorContext
     bool HasSelectionChanged();
     uint64_t GetSelectionId() const { return m_SelectionId; }
 
+    // Read access for overlays. The revision changes whenever a node or link moves, resizes or goes away.
+    const vector<ObjectWrapper<Node>>& GetNodes() const { return m_Nodes; }
+    const vector<ObjectWrapper<Link>>& GetLinks() const { return m_Links; }
+    uint32_t GetGeometryRevision() const { return m_NodeIndex.GetRevision() + m_LinkIndex.GetRevision(); }
+
     Node* FindNodeAt(const ImVec2& p);
     void FindNodesInRect(const ImRect& r, vector<Node*>& result, bool append = false, bool includeIntersecting = true);
     void FindLinksInRect(const ImRect& r, vector<Link*>& result, bool append = false);
@@ -1393,6 +1695,10 @@ struct EditorContext
 
     Link* FindLinkAt(const ImVec2& p);
 
+    void MarkBoundsDirty(Object* object);
+    void MarkNodeOrderDirty() { m_NodeOrderDirty = true; }
+    void UpdateLinkConnections(Link* link);
+
     template <typename T>
     ImRect GetBounds(const std::vector<T*>& objects)
     {
@@ -1430,6 +1736,10 @@ struct EditorContext
     ImU32 GetColor(StyleColor colorIndex, float alpha) const;
 
     int GetNodeIds(NodeId* nodes, int size) const;
+    int GetNodeRects(NodeId* nodes, ImVec4* rects, int size, bool visibleOnly);
+
+    // Positions nodeIds, or every live node when null (imgui_node_editor_layout.cpp)
+    void AutoLayout(const NodeId* nodeIds, int count, const LayoutOptions& options);
 
     void NavigateTo(const ImRect& bounds, bool zoomIn = false, float duration = -1)
     {
@@ -1437,6 +1747,8 @@ struct EditorContext
         m_NavigateAction.NavigateTo(bounds, zoomMode, duration);
     }
 
+    void CenterView(const ImVec2& canvasPoint) { m_NavigateAction.CenterView(canvasPoint); }
+
     void RegisterAnimation(Animation* animation);
     void UnregisterAnimation(Animation* animation);
 
@@ -1477,6 +1789,8 @@ private:
     void LoadSettings();
     void SaveSettings();
 
+    void RemoveObject(Object* object);
+
     Control BuildControl(bool allowOffscreen);
 
     void ShowMetrics(const Control& control);
@@ -1495,9 +1809,20 @@ private:
 
     Style               m_Style;
 
-    vector<ObjectWrapper<Node>> m_Nodes;
+    vector<ObjectWrapper<Node>> m_Nodes; // draw order: groups by area, then z position
     vector<ObjectWrapper<Pin>>  m_Pins;
     vector<ObjectWrapper<Link>> m_Links;
+    bool                m_NodeOrderDirty; // a z position, group size or node type changed since m_Nodes was sorted
+
+    ObjectIdMap<Node>   m_NodeMap;
+    ObjectIdMap<Pin>    m_PinMap;
+    ObjectIdMap<Link>   m_LinkMap;
+
+    SpatialIndex        m_NodeIndex;
+    SpatialIndex        m_LinkIndex;
+    vector<Object*>     m_IndexQuery;
+    vector<Node*>       m_VisibleNodes;
+    vector<Link*>       m_VisibleLinks;
 
     vector<Object*>     m_SelectedObjects;
 
@@ -1514,6 +1839,7 @@ private:
 
     NodeBuilder         m_NodeBuilder;
     HintBuilder         m_HintBuilder;
+    Minimap             m_Minimap;
 
     EditorAction*       m_CurrentAction;
     NavigateAction      m_NavigateAction;
@@ -0,0 +1,1018 @@
+//------------------------------------------------------------------------------
+// LICENSE
+//   This software is dual-licensed to the public domain and under the following
+//   license: you are granted a perpetual, irrevocable license to copy, modify,
+//   publish, and distribute this file as you see fit.
+//
+// Automatic graph layout. Connected components are laid out independently:
+// layered (Sugiyama) for mostly acyclic graphs, force directed otherwise.
+//------------------------------------------------------------------------------
+# include "imgui_node_editor_internal.h"
+# include <algorithm>
+# include <atomic>
+# include <climits>
+# include <cmath>
+# include <random>
+# include <thread>
+# include <unordered_map>
+
+
+namespace ax {
+namespace NodeEditor {
+namespace Detail {
+namespace Layout {
+
+
+//------------------------------------------------------------------------------
+static const float c_DummyGapScale      = 0.5f;   // separation next to edge dummies, relative to Spacing.y
+static const int   c_AlignPasses        = 4;      // coordinate assignment down/up passes
+static const int   c_MinTrialVertices   = 8;      // smaller layered graphs run a single ordering trial
+static const int   c_MaxTrialVertices   = 250000; // larger layered graphs (dummies included) run fewer trials
+static const int   c_OverlapPasses      = 16;     // force directed overlap removal passes
+
+
+//------------------------------------------------------------------------------
+// Runs f(0) ... f(count - 1) on up to threadCount threads.
+template <typename F>
+static void ParallelFor(int count, int threadCount, F&& f)
+{
+    threadCount = ImMin(threadCount, count);
+    if (threadCount <= 1)
+    {
+        for (int i = 0; i < count; ++i)
+            f(i);
+        return;
+    }
+
+    std::atomic<int> next(0);
+    auto worker = [&]()
+    {
+        for (int i = next++; i < count; i = next++)
+            f(i);
+    };
+
+    vector<std::thread> threads;
+    threads.reserve(threadCount - 1);
+    for (int i = 1; i < threadCount; ++i)
+        threads.emplace_back(worker);
+    worker();
+    for (auto& thread : threads)
+        thread.join();
+}
+
+
+//------------------------------------------------------------------------------
+// Nodes of a live link, from output pin to input pin.
+static bool GetLinkNodes(const Link* link, Node*& source, Node*& target)
+{
+    if (!link->m_IsLive || !link->m_StartPin || !link->m_EndPin)
+        return false;
+
+    source = link->m_StartPin->m_Node;
+    target = link->m_EndPin->m_Node;
+    if (link->m_StartPin->m_Kind == PinKind::Input && link->m_EndPin->m_Kind == PinKind::Output)
+        std::swap(source, target);
+
+    return source && target;
+}
+
+
+//------------------------------------------------------------------------------
+// Directed graph of one connected component, vertices are local indices.
+struct Component
+{
+    vector<Node*>       m_Nodes;
+    vector<ImVec2>      m_Sizes;
+    vector<vector<int>> m_Out;
+    int                 m_EdgeCount;
+
+    // Result, top-left corners relative to m_Size box at origin
+    vector<ImVec2>      m_Positions;
+    ImVec2              m_Size;
+
+    Component()
+        : m_EdgeCount(0)
+        , m_Size(0, 0)
+    {
+    }
+};
+
+// Layered form of a component. Dummy vertices follow the real ones and have zero size.
+struct LayeredGraph
+{
+    int                 m_RealCount;
+    vector<ImVec2>      m_Sizes;
+    vector<int>         m_Layer;
+    vector<vector<int>> m_Up;     // neighbours in previous layer
+    vector<vector<int>> m_Down;   // neighbours in next layer
+    vector<vector<int>> m_Layers; // initial order of vertices in each layer
+
+    LayeredGraph()
+        : m_RealCount(0)
+    {
+    }
+};
+
+struct Ordering
+{
+    vector<vector<int>> m_Layers;
+    int64_t             m_Crossings;
+
+    Ordering()
+        : m_Crossings(0)
+    {
+    }
+};
+
+
+//------------------------------------------------------------------------------
+// Reverses edges closing cycles (depth first back edges), returns the number reversed.
+static int MakeAcyclic(const vector<vector<int>>& out, vector<std::pair<int, int>>& edges)
+{
+    const int count = (int)out.size();
+
+    vector<int> inDegree(count, 0);
+    for (auto& targets : out)
+        for (auto v : targets)
+            ++inDegree[v];
+
+    // Start from sources so edges keep their direction where possible
+    vector<int> roots;
+    roots.reserve(count);
+    for (int v = 0; v < count; ++v)
+        if (inDegree[v] == 0)
+            roots.push_back(v);
+    for (int v = 0; v < count; ++v)
+        if (inDegree[v] != 0)
+            roots.push_back(v);
+
+    enum : uint8_t { Unvisited, OnStack, Done };
+    vector<uint8_t> state(count, Unvisited);
+    vector<std::pair<int, int>> stack;
+
+    int reversed = 0;
+    edges.resize(0);
+    for (auto root : roots)
+    {
+        if (state[root] != Unvisited)
+            continue;
+
+        state[root] = OnStack;
+        stack.push_back({ root, 0 });
+        while (!stack.empty())
+        {
+            auto& top = stack.back();
+            const auto u = top.first;
+            if (top.second < (int)out[u].size())
+            {
+                const auto v = out[u][top.second++];
+                if (state[v] == OnStack)
+                {
+                    if (u != v)
+                        edges.push_back({ v, u });
+                    ++reversed;
+                    continue;
+                }
+
+                edges.push_back({ u, v });
+                if (state[v] == Unvisited)
+                {
+                    state[v] = OnStack;
+                    stack.push_back({ v, 0 });
+                }
+            }
+            else
+            {
+                state[u] = Done;
+                stack.pop_back();
+            }
+        }
+    }
+
+    // Reversing may duplicate an existing edge
+    std::sort(edges.begin(), edges.end());
+    edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+    return reversed;
+}
+
+// Longest path layering with sources pulled next to their successors,
+// then long edges split by dummy vertices.
+static void BuildLayers(const Component& component, const vector<std::pair<int, int>>& edges, LayeredGraph& graph)
+{
+    const int count = (int)component.m_Nodes.size();
+
+    vector<vector<int>> out(count), in(count);
+    for (auto& edge : edges)
+    {
+        out[edge.first].push_back(edge.second);
+        in[edge.second].push_back(edge.first);
+    }
+
+    // Kahn topological order
+    vector<int> order;
+    order.reserve(count);
+    vector<int> pending(count);
+    for (int v = 0; v < count; ++v)
+    {
+        pending[v] = (int)in[v].size();
+        if (pending[v] == 0)
+            order.push_back(v);
+    }
+    for (size_t i = 0; i < order.size(); ++i)
+        for (auto v : out[order[i]])
+            if (--pending[v] == 0)
+                order.push_back(v);
+    IM_ASSERT((int)order.size() == count);
+
+    vector<int> layer(count, 0);
+    for (auto u : order)
+        for (auto v : out[u])
+            layer[v] = ImMax(layer[v], layer[u] + 1);
+
+    for (auto it = order.rbegin(); it != order.rend(); ++it)
+    {
+        const auto u = *it;
+        if (!in[u].empty() || out[u].empty())
+            continue;
+
+        int minLayer = INT_MAX;
+        for (auto v : out[u])
+            minLayer = ImMin(minLayer, layer[v]);
+        layer[u] = minLayer - 1;
+    }
+
+    int layerCount = 0;
+    for (auto l : layer)
+        layerCount = ImMax(layerCount, l + 1);
+
+    graph.m_RealCount = count;
+    graph.m_Sizes     = component.m_Sizes;
+    graph.m_Layer     = layer;
+    graph.m_Up.assign(count, {});
+    graph.m_Down.assign(count, {});
+
+    auto addVertex = [&graph](int l)
+    {
+        graph.m_Sizes.push_back(ImVec2(0, 0));
+        graph.m_Layer.push_back(l);
+        graph.m_Up.emplace_back();
+        graph.m_Down.emplace_back();
+        return (int)graph.m_Layer.size() - 1;
+    };
+
+    for (auto& edge : edges)
+    {
+        int u = edge.first;
+        for (int l = layer[edge.first] + 1; l < layer[edge.second]; ++l)
+        {
+            const auto dummy = addVertex(l);
+            graph.m_Down[u].push_back(dummy);
+            graph.m_Up[dummy].push_back(u);
+            u = dummy;
+        }
+        graph.m_Down[u].push_back(edge.second);
+        graph.m_Up[edge.second].push_back(u);
+    }
+
+    // Initial order from depth first traversal, keeps subtrees together
+    const int total = (int)graph.m_Layer.size();
+    graph.m_Layers.assign(layerCount, {});
+    vector<uint8_t> visited(total, 0);
+    vector<int> stack;
+    auto visit = [&](int root)
+    {
+        if (visited[root])
+            return;
+        visited[root] = 1;
+        stack.push_back(root);
+        while (!stack.empty())
+        {
+            const auto u = stack.back();
+            stack.pop_back();
+            graph.m_Layers[graph.m_Layer[u]].push_back(u);
+            for (auto it = graph.m_Down[u].rbegin(); it != graph.m_Down[u].rend(); ++it)
+            {
+                if (!visited[*it])
+                {
+                    visited[*it] = 1;
+                    stack.push_back(*it);
+                }
+            }
+        }
+    };
+
+    for (auto v : order)
+        if (in[v].empty())
+            visit(v);
+    for (int v = 0; v < total; ++v)
+        visit(v);
+}
+
+
+//------------------------------------------------------------------------------
+// Crossings between two adjacent layers, counted as inversions with a Fenwick tree.
+static int64_t CountCrossings(const vector<int>& upper, int lowerSize, const vector<vector<int>>& down,
+    const vector<int>& position, vector<int>& sequence, vector<int>& tree)
+{
+    sequence.resize(0);
+    for (auto u : upper)
+    {
+        const auto first = sequence.size();
+        for (auto v : down[u])
+            sequence.push_back(position[v]);
+        std::sort(sequence.begin() + first, sequence.end());
+    }
+
+    tree.assign(lowerSize + 1, 0);
+    int64_t crossings = 0;
+    int inserted = 0;
+    for (auto p : sequence)
+    {
+        int atMost = 0;
+        for (int i = p + 1; i > 0; i -= i & -i)
+            atMost += tree[i];
+        crossings += inserted - atMost;
+
+        for (int i = p + 1; i <= lowerSize; i += i & -i)
+            ++tree[i];
+        ++inserted;
+    }
+
+    return crossings;
+}
+
+static int64_t CountCrossings(const LayeredGraph& graph, const vector<vector<int>>& layers, const vector<int>& position,
+    vector<int>& sequence, vector<int>& tree)
+{
+    int64_t crossings = 0;
+    for (size_t l = 0; l + 1 < layers.size(); ++l)
+        crossings += CountCrossings(layers[l], (int)layers[l + 1].size(), graph.m_Down, position, sequence, tree);
+    return crossings;
+}
+
+struct SortKey
+{
+    float m_Barycenter;
+    int   m_Position; // ties keep the current order
+    int   m_Vertex;
+
+    bool operator<(const SortKey& rhs) const
+    {
+        return m_Barycenter < rhs.m_Barycenter || (m_Barycenter == rhs.m_Barycenter && m_Position < rhs.m_Position);
+    }
+};
+
+static void SortByBarycenter(vector<int>& layer, const vector<vector<int>>& adjacent, vector<int>& position, vector<SortKey>& keys)
+{
+    keys.resize(layer.size());
+    for (size_t i = 0; i < layer.size(); ++i)
+    {
+        const auto v = layer[i];
+        auto& key = keys[i];
+        key.m_Position = position[v];
+        key.m_Vertex   = v;
+        if (adjacent[v].empty())
+        {
+            key.m_Barycenter = (float)key.m_Position;
+            continue;
+        }
+
+        float sum = 0.0f;
+        for (auto a : adjacent[v])
+            sum += (float)position[a];
+        key.m_Barycenter = sum / adjacent[v].size();
+    }
+
+    std::sort(keys.begin(), keys.end());
+
+    for (int i = 0; i < (int)layer.size(); ++i)
+    {
+        layer[i] = keys[i].m_Vertex;
+        position[layer[i]] = i;
+    }
+}
+
+// Barycenter sweeps down and up, keeps the ordering with fewest crossings.
+static void MinimizeCrossings(const LayeredGraph& graph, int trial, int iterations, Ordering& result)
+{
+    auto layers = graph.m_Layers;
+    if (trial > 0)
+    {
+        std::mt19937 random((uint32_t)trial);
+        for (auto& layer : layers)
+            std::shuffle(layer.begin(), layer.end(), random);
+    }
+
+    vector<int>     position(graph.m_Layer.size());
+    vector<SortKey> keys;
+    vector<int>     sequence, tree;
+    for (auto& layer : layers)
+        for (int i = 0; i < (int)layer.size(); ++i)
+            position[layer[i]] = i;
+
+    result.m_Layers    = layers;
+    result.m_Crossings = CountCrossings(graph, layers, position, sequence, tree);
+
+    for (int i = 0; i < iterations && result.m_Crossings > 0; ++i)
+    {
+        for (size_t l = 1; l < layers.size(); ++l)
+            SortByBarycenter(layers[l], graph.m_Up, position, keys);
+        for (size_t l = layers.size() - 1; l-- > 0; )
+            SortByBarycenter(layers[l], graph.m_Down, position, keys);
+
+        const auto crossings = CountCrossings(graph, layers, position, sequence, tree);
+        if (crossings < result.m_Crossings)
+        {
+            result.m_Layers    = layers;
+            result.m_Crossings = crossings;
+        }
+    }
+}
+
+
+//------------------------------------------------------------------------------
+// Places vertices of one layer as close to desired tops as order and separation allow.
+// Average of the downward and upward packed solutions, both satisfy the constraints.
+static void PlaceLayer(const vector<int>& layer, const vector<float>& desired, const LayeredGraph& graph, float spacing,
+    vector<float>& top, vector<float>& forward)
+{
+    const int count = (int)layer.size();
+    forward.resize(count);
+
+    auto separation = [&](int a, int b)
+    {
+        const auto dummy = a >= graph.m_RealCount || b >= graph.m_RealCount;
+        return graph.m_Sizes[a].y + (dummy ? spacing * c_DummyGapScale : spacing);
+    };
+
+    for (int i = 0; i < count; ++i)
+    {
+        forward[i] = desired[layer[i]];
+        if (i > 0)
+            forward[i] = ImMax(forward[i], forward[i - 1] + separation(layer[i - 1], layer[i]));
+    }
+
+    float next = 0.0f;
+    for (int i = count - 1; i >= 0; --i)
+    {
+        auto backward = desired[layer[i]];
+        if (i < count - 1)
+            backward = ImMin(backward, next - separation(layer[i], layer[i + 1]));
+        next = backward;
+        top[layer[i]] = (forward[i] + backward) * 0.5f;
+    }
+}
+
+static void AssignCoordinates(const LayeredGraph& graph, const vector<vector<int>>& layers, const LayoutOptions& options,
+    Component& component)
+{
+    const int total = (int)graph.m_Layer.size();
+
+    vector<float> layerX(layers.size(), 0.0f);
+    float x = 0.0f;
+    for (size_t l = 0; l < layers.size(); ++l)
+    {
+        layerX[l] = x;
+        float width = 0.0f;
+        for (auto v : layers[l])
+            width = ImMax(width, graph.m_Sizes[v].x);
+        x += width + options.Spacing.x;
+    }
+
+    // Stack every layer, then pull vertices toward the centers of their neighbours
+    vector<float> top(total, 0.0f), desired(total, 0.0f), scratch;
+    for (auto& layer : layers)
+        PlaceLayer(layer, desired, graph, options.Spacing.y, top, scratch);
+
+    auto center = [&](int v) { return top[v] + graph.m_Sizes[v].y * 0.5f; };
+    auto align = [&](const vector<int>& layer, const vector<vector<int>>& adjacent)
+    {
+        for (auto v : layer)
+        {
+            if (adjacent[v].empty())
+            {
+                desired[v] = top[v];
+                continue;
+            }
+
+            float sum = 0.0f;
+            for (auto a : adjacent[v])
+                sum += center(a);
+            desired[v] = sum / adjacent[v].size() - graph.m_Sizes[v].y * 0.5f;
+        }
+        PlaceLayer(layer, desired, graph, options.Spacing.y, top, scratch);
+    };
+
+    for (int pass = 0; pass < c_AlignPasses; ++pass)
+    {
+        for (size_t l = 1; l < layers.size(); ++l)
+            align(layers[l], graph.m_Up);
+        for (size_t l = layers.size() - 1; l-- > 0; )
+            align(layers[l], graph.m_Down);
+    }
+
+    const int count = graph.m_RealCount;
+    component.m_Positions.resize(count);
+    for (int v = 0; v < count; ++v)
+        component.m_Positions[v] = ImVec2(layerX[graph.m_Layer[v]], top[v]);
+}
+
+
+//------------------------------------------------------------------------------
+static uint64_t CellKey(int x, int y) { return (uint64_t)(uint32_t)x << 32 | (uint32_t)y; }
+
+// Fruchterman-Reingold with grid limited repulsion, then overlap removal.
+static void ForceDirected(Component& component, const LayoutOptions& options)
+{
+    const int count = (int)component.m_Nodes.size();
+
+    // Repulsion keeps pairs about their combined radii apart, springs pull to the average
+    vector<float> radius(count);
+    float averageRadius = 0.0f, largestRadius = 0.0f;
+    for (int v = 0; v < count; ++v)
+    {
+        radius[v] = ImSqrt(ImLengthSqr(component.m_Sizes[v])) * 0.5f;
+        averageRadius += radius[v];
+        largestRadius  = ImMax(largestRadius, radius[v]);
+    }
+    averageRadius /= ImMax(count, 1);
+
+    const float k      = 2.0f * averageRadius + options.Spacing.x;
+    const float cell   = 2.0f * (2.0f * largestRadius + options.Spacing.x);
+    const float extent = k * std::sqrt((float)count);
+
+    // Start from current positions unless they are all stacked up
+    vector<ImVec2> position(count), displacement(count);
+    ImRect bounds(component.m_Nodes[0]->m_Bounds.GetCenter(), component.m_Nodes[0]->m_Bounds.GetCenter());
+    for (int v = 0; v < count; ++v)
+    {
+        position[v] = component.m_Nodes[v]->m_Bounds.GetCenter();
+        bounds.Add(position[v]);
+    }
+    if (count > 1 && bounds.GetWidth() < k && bounds.GetHeight() < k)
+    {
+        // Sunflower spiral, even spread without randomness
+        for (int v = 0; v < count; ++v)
+        {
+            const float r = k * std::sqrt((float)v);
+            const float a = v * 2.39996323f;
+            position[v] = ImVec2(r * std::cos(a), r * std::sin(a));
+        }
+    }
+
+    std::unordered_map<uint64_t, vector<int>> grid;
+    for (int iteration = 0; iteration < options.ForceIterations; ++iteration)
+    {
+        const float temperature = extent * 0.1f * (1.0f - (float)iteration / options.ForceIterations) + 1.0f;
+
+        grid.clear();
+        for (int v = 0; v < count; ++v)
+            grid[CellKey((int)std::floor(position[v].x / cell), (int)std::floor(position[v].y / cell))].push_back(v);
+
+        for (int v = 0; v < count; ++v)
+        {
+            displacement[v] = ImVec2(0, 0);
+            const int cx = (int)std::floor(position[v].x / cell);
+            const int cy = (int)std::floor(position[v].y / cell);
+            for (int y = cy - 1; y <= cy + 1; ++y)
+            {
+                for (int x = cx - 1; x <= cx + 1; ++x)
+                {
+                    auto it = grid.find(CellKey(x, y));
+                    if (it == grid.end())
+                        continue;
+
+                    for (auto u : it->second)
+                    {
+                        if (u == v)
+                            continue;
+
+                        auto delta = position[v] - position[u];
+                        auto distanceSq = ImLengthSqr(delta);
+                        if (distanceSq < 0.01f)
+                        {
+                            delta = ImVec2((float)((v * 7 + u) % 5) - 2.0f, 1.0f);
+                            distanceSq = ImLengthSqr(delta);
+                        }
+                        if (distanceSq > cell * cell)
+                            continue;
+
+                        const float separation = radius[u] + radius[v] + options.Spacing.x;
+                        displacement[v] += delta * (separation * separation / distanceSq);
+                    }
+                }
+            }
+        }
+
+        for (int u = 0; u < count; ++u)
+        {
+            for (auto v : component.m_Out[u])
+            {
+                const auto delta    = position[v] - position[u];
+                const auto distance = ImSqrt(ImLengthSqr(delta));
+                const auto force    = delta * (distance / k);
+                displacement[u] += force;
+                displacement[v] -= force;
+            }
+        }
+
+        for (int v = 0; v < count; ++v)
+        {
+            const auto length = ImSqrt(ImLengthSqr(displacement[v]));
+            if (length > 0.0f)
+                position[v] += displacement[v] * (ImMin(length, temperature) / length);
+        }
+    }
+
+    // Overlap removal. Cells fit the largest box, so overlapping pairs are always in neighbouring cells.
+    ImVec2 largest(0, 0);
+    for (auto& size : component.m_Sizes)
+        largest = ImMax(largest, size);
+    const float boxCell = ImMax(largest.x, largest.y) + options.Spacing.y;
+
+    auto forEachOverlap = [&](auto&& f)
+    {
+        grid.clear();
+        for (int v = 0; v < count; ++v)
+            grid[CellKey((int)std::floor(position[v].x / boxCell), (int)std::floor(position[v].y / boxCell))].push_back(v);
+
+        for (int v = 0; v < count; ++v)
+        {
+            const int cx = (int)std::floor(position[v].x / boxCell);
+            const int cy = (int)std::floor(position[v].y / boxCell);
+            for (int y = cy - 1; y <= cy + 1; ++y)
+            {
+                for (int x = cx - 1; x <= cx + 1; ++x)
+                {
+                    auto it = grid.find(CellKey(x, y));
+                    if (it == grid.end())
+                        continue;
+
+                    for (auto u : it->second)
+                    {
+                        if (u <= v)
+                            continue;
+
+                        const auto delta = position[u] - position[v];
+                        const auto need  = (component.m_Sizes[u] + component.m_Sizes[v]) * 0.5f + ImVec2(options.Spacing.y, options.Spacing.y);
+                        if (ImFabs(delta.x) < need.x && ImFabs(delta.y) < need.y)
+                            f(u, v, delta, need);
+                    }
+                }
+            }
+        }
+    };
+
+    // Push pairs apart along the axis of least overlap
+    for (int pass = 0; pass < c_OverlapPasses; ++pass)
+    {
+        bool moved = false;
+        forEachOverlap([&](int u, int v, ImVec2 delta, ImVec2 need)
+        {
+            const auto overlap = need - ImVec2(ImFabs(delta.x), ImFabs(delta.y));
+            auto push = overlap.x < overlap.y
+                ? ImVec2((delta.x < 0.0f ? -overlap.x : overlap.x) * 0.5f, 0.0f)
+                : ImVec2(0.0f, (delta.y < 0.0f ? -overlap.y : overlap.y) * 0.5f);
+            position[u] += push;
+            position[v] -= push;
+            moved = true;
+        });
+
+        if (!moved)
+            break;
+    }
+
+    // Dense clusters can keep pushing each other back, spread out whatever is left.
+    // Scaling only increases distances, so this cannot create new overlaps.
+    float scale = 1.0f;
+    forEachOverlap([&](int, int, ImVec2 delta, ImVec2 need)
+    {
+        float pairScale = FLT_MAX;
+        if (delta.x != 0.0f)
+            pairScale = need.x / ImFabs(delta.x);
+        if (delta.y != 0.0f)
+            pairScale = ImMin(pairScale, need.y / ImFabs(delta.y));
+        if (pairScale != FLT_MAX)
+            scale = ImMax(scale, pairScale);
+    });
+    if (scale > 1.0f)
+        for (auto& p : position)
+            p *= scale;
+
+    component.m_Positions.resize(count);
+    for (int v = 0; v < count; ++v)
+        component.m_Positions[v] = position[v] - component.m_Sizes[v] * 0.5f;
+}
+
+
+//------------------------------------------------------------------------------
+static void Normalize(Component& component)
+{
+    if (component.m_Positions.empty())
+        return;
+
+    ImRect bounds(component.m_Positions[0], component.m_Positions[0]);
+    for (size_t v = 0; v < component.m_Positions.size(); ++v)
+    {
+        bounds.Add(component.m_Positions[v]);
+        bounds.Add(component.m_Positions[v] + component.m_Sizes[v]);
+    }
+
+    for (auto& position : component.m_Positions)
+        position -= bounds.Min;
+    component.m_Size = bounds.GetSize();
+}
+
+// Splits nodes into connected components with deduplicated directed edges.
+static vector<Component> BuildComponents(const vector<Node*>& nodes)
+{
+    std::unordered_map<Node*, int> index;
+    index.reserve(nodes.size());
+    for (int i = 0; i < (int)nodes.size(); ++i)
+        index[nodes[i]] = i;
+
+    const int count = (int)nodes.size();
+    vector<vector<int>> out(count), undirected(count);
+    for (int u = 0; u < count; ++u)
+    {
+        for (auto link : nodes[u]->m_ConnectedLinks)
+        {
+            Node* source;
+            Node* target;
+            if (!GetLinkNodes(link, source, target) || source != nodes[u] || source == target)
+                continue;
+
+            auto it = index.find(target);
+            if (it == index.end())
+                continue;
+
+            out[u].push_back(it->second);
+            undirected[u].push_back(it->second);
+            undirected[it->second].push_back(u);
+        }
+
+        std::sort(out[u].begin(), out[u].end());
+        out[u].erase(std::unique(out[u].begin(), out[u].end()), out[u].end());
+    }
+
+    vector<Component> components;
+    vector<int> componentOf(count, -1), local(count, -1), stack;
+    for (int root = 0; root < count; ++root)
+    {
+        if (componentOf[root] >= 0)
+            continue;
+
+        const int id = (int)components.size();
+        components.emplace_back();
+        auto& component = components.back();
+
+        componentOf[root] = id;
+        stack.push_back(root);
+        while (!stack.empty())
+        {
+            const auto u = stack.back();
+            stack.pop_back();
+            local[u] = (int)component.m_Nodes.size();
+            component.m_Nodes.push_back(nodes[u]);
+            for (auto v : undirected[u])
+            {
+                if (componentOf[v] < 0)
+                {
+                    componentOf[v] = id;
+                    stack.push_back(v);
+                }
+            }
+        }
+    }
+
+    for (int u = 0; u < count; ++u)
+    {
+        auto& component = components[componentOf[u]];
+        if (component.m_Out.empty())
+        {
+            component.m_Out.resize(component.m_Nodes.size());
+            component.m_Sizes.resize(component.m_Nodes.size());
+        }
+
+        component.m_Sizes[local[u]] = nodes[u]->m_Bounds.GetSize();
+        for (auto v : out[u])
+            component.m_Out[local[u]].push_back(local[v]);
+        component.m_EdgeCount += (int)out[u].size();
+    }
+
+    return components;
+}
+
+} // namespace Layout
+} // namespace Detail
+} // namespace NodeEditor
+} // namespace ax
+
+
+//------------------------------------------------------------------------------
+void ax::NodeEditor::Detail::EditorContext::AutoLayout(const NodeId* nodeIds, int count, const LayoutOptions& options)
+{
+    using namespace Layout;
+
+    const bool incremental = nodeIds != nullptr;
+
+    vector<Node*> nodes;
+    if (incremental)
+    {
+        for (int i = 0; i < count; ++i)
+            if (auto node = FindNode(nodeIds[i]))
+                nodes.push_back(node);
+    }
+    else
+    {
+        for (auto node : m_Nodes)
+            nodes.push_back(node);
+    }
+
+    // Groups are comments around other nodes, they keep their place
+    nodes.erase(std::remove_if(nodes.begin(), nodes.end(), [](Node* node)
+    {
+        return !node->m_IsLive || node->m_Type == NodeType::Group;
+    }), nodes.end());
+    // Id order keeps the result independent of allocation addresses
+    auto byId = [](const Node* lhs, const Node* rhs) { return lhs->m_ID.Get() < rhs->m_ID.Get(); };
+    std::sort(nodes.begin(), nodes.end(), byId);
+    nodes.erase(std::unique(nodes.begin(), nodes.end()), nodes.end());
+    if (nodes.empty())
+        return;
+
+    // Keep the view roughly where it was
+    ImRect previous = nodes[0]->m_Bounds;
+    for (auto node : nodes)
+        previous.Add(node->m_Bounds);
+
+    auto components = BuildComponents(nodes);
+
+    const int threadCount = options.ThreadCount > 0 ? options.ThreadCount : ImMax(1, (int)std::thread::hardware_concurrency());
+
+    // Phase 1: break cycles, pick layered or force directed, build layers
+    vector<LayeredGraph> graphs(components.size());
+    vector<uint8_t> layered(components.size(), 0);
+    ParallelFor((int)components.size(), threadCount, [&](int i)
+    {
+        auto& component = components[i];
+        vector<std::pair<int, int>> edges;
+        const auto reversed = MakeAcyclic(component.m_Out, edges);
+
+        bool useLayers = options.Mode == LayoutMode::Layered;
+        if (options.Mode == LayoutMode::Auto)
+            useLayers = reversed <= options.MaxReversedEdgeRatio * component.m_EdgeCount;
+
+        if (useLayers)
+        {
+            BuildLayers(component, edges, graphs[i]);
+            layered[i] = 1;
+        }
+        else
+        {
+            ForceDirected(component, options);
+        }
+    });
+
+    // Phase 2: independent crossing minimization trials, large components get several
+    vector<std::pair<int, int>> trials;
+    for (int i = 0; i < (int)components.size(); ++i)
+    {
+        if (!layered[i])
+            continue;
+
+        const int vertexCount = (int)graphs[i].m_Layer.size();
+        const int trialCount  = vertexCount < c_MinTrialVertices ? 1 :
+            ImClamp(c_MaxTrialVertices / vertexCount, 1, ImMax(1, options.OrderingTrials));
+        for (int trial = 0; trial < trialCount; ++trial)
+            trials.push_back({ i, trial });
+    }
+
+    vector<Ordering> orderings(trials.size());
+    ParallelFor((int)trials.size(), threadCount, [&](int i)
+    {
+        MinimizeCrossings(graphs[trials[i].first], trials[i].second, options.SweepIterations, orderings[i]);
+    });
+
+    vector<int> best(components.size(), -1);
+    for (int i = 0; i < (int)trials.size(); ++i)
+    {
+        auto& current = best[trials[i].first];
+        if (current < 0 || orderings[i].m_Crossings < orderings[current].m_Crossings)
+            current = i;
+    }
+
+    // Phase 3: coordinates
+    ParallelFor((int)components.size(), threadCount, [&](int i)
+    {
+        if (layered[i])
+            AssignCoordinates(graphs[i], orderings[best[i]].m_Layers, options, components[i]);
+        Normalize(components[i]);
+    });
+
+    // Stack components, largest first
+    vector<int> stackOrder(components.size());
+    for (int i = 0; i < (int)stackOrder.size(); ++i)
+        stackOrder[i] = i;
+    std::stable_sort(stackOrder.begin(), stackOrder.end(), [&components](int lhs, int rhs)
+    {
+        return components[lhs].m_Nodes.size() > components[rhs].m_Nodes.size();
+    });
+
+    vector<ImVec2> offsets(components.size());
+    ImVec2 blockSize(0, 0);
+    for (auto i : stackOrder)
+    {
+        offsets[i] = ImVec2(0, blockSize.y);
+        blockSize.x = ImMax(blockSize.x, components[i].m_Size.x);
+        blockSize.y += components[i].m_Size.y + options.ComponentSpacing;
+    }
+    blockSize.y = ImMax(0.0f, blockSize.y - options.ComponentSpacing);
+
+    ImVec2 origin = previous.Min;
+    if (incremental)
+    {
+        // Place new nodes next to the nodes they connect to
+        auto isMoved = [&nodes, &byId](Node* node) { return std::binary_search(nodes.begin(), nodes.end(), node, byId); };
+
+        ImVec2 sourceCenter(0, 0), targetCenter(0, 0);
+        float  sourceRight = -FLT_MAX, targetLeft = FLT_MAX;
+        int    sourceCount = 0, targetCount = 0;
+        for (auto node : nodes)
+        {
+            for (auto link : node->m_ConnectedLinks)
+            {
+                Node* source;
+                Node* target;
+                if (!GetLinkNodes(link, source, target))
+                    continue;
+
+                if (target == node && source->m_IsLive && !isMoved(source))
+                {
+                    sourceCenter += source->m_Bounds.GetCenter();
+                    sourceRight   = ImMax(sourceRight, source->m_Bounds.Max.x);
+                    ++sourceCount;
+                }
+                else if (source == node && target->m_IsLive && !isMoved(target))
+                {
+                    targetCenter += target->m_Bounds.GetCenter();
+                    targetLeft    = ImMin(targetLeft, target->m_Bounds.Min.x);
+                    ++targetCount;
+                }
+            }
+        }
+
+        if (sourceCount > 0)
+        {
+            origin = ImVec2(sourceRight + options.Spacing.x, sourceCenter.y / sourceCount - blockSize.y * 0.5f);
+        }
+        else if (targetCount > 0)
+        {
+            origin = ImVec2(targetLeft - options.Spacing.x - blockSize.x, targetCenter.y / targetCount - blockSize.y * 0.5f);
+        }
+        else
+        {
+            bool   found = false;
+            ImRect others;
+            for (auto node : m_Nodes)
+            {
+                if (!node->m_IsLive || isMoved(node))
+                    continue;
+                if (!found)
+                    others = node->m_Bounds;
+                others.Add(node->m_Bounds);
+                found = true;
+            }
+            if (found)
+                origin = ImVec2(others.Min.x, others.Max.y + options.ComponentSpacing);
+        }
+
+        // Slide down past nodes that are in the way
+        for (int attempt = 0; attempt < (int)m_Nodes.size(); ++attempt)
+        {
+            ImRect area(origin, origin + blockSize);
+            area.Expand(options.Spacing.y);
+            m_NodeIndex.Query(area, m_IndexQuery);
+
+            float bottom = -FLT_MAX;
+            for (auto object : m_IndexQuery)
+            {
+                auto node = object->AsNode();
+                if (node && node->m_IsLive && node->m_Type != NodeType::Group && !isMoved(node))
+                    bottom = ImMax(bottom, node->m_Bounds.Max.y);
+            }
+            if (bottom == -FLT_MAX)
+                break;
+
+            origin.y = bottom + options.Spacing.y;
+        }
+    }
+
+    for (size_t i = 0; i < components.size(); ++i)
+    {
+        auto& component = components[i];
+        for (size_t v = 0; v < component.m_Nodes.size(); ++v)
+            SetNodePosition(component.m_Nodes[v]->m_ID, ImFloor(origin + offsets[i] + component.m_Positions[v]));
+    }
+}
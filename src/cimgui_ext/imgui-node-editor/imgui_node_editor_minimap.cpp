@@ -0,0 +1,352 @@
+//------------------------------------------------------------------------------
+// LICENSE
+//   This software is dual-licensed to the public domain and under the following
+//   license: you are granted a perpetual, irrevocable license to copy, modify,
+//   publish, and distribute this file as you see fit.
+//
+// Minimap overlay. Node rectangles and link polylines are rasterized on the CPU
+// into a user texture, redrawn only when the spatial indices report a change.
+//------------------------------------------------------------------------------
+# include "imgui_node_editor_internal.h"
+# include "texture_ext.h"
+
+
+namespace ed = ax::NodeEditor::Detail;
+
+
+//------------------------------------------------------------------------------
+static const float  c_MinimapMargin         = 10.0f; // distance from the canvas edge, in pixels
+static const float  c_MinimapMinSize        = 32.0f;
+static const float  c_MinimapContentPadding = 0.05f; // fraction of the content size left around it
+static const int    c_MinimapTextureStep    = 32;    // texture sizes are rounded up to this, so resizing the canvas does not recreate it every frame
+static const int    c_MinimapMaxTextureSize = 512;
+static const double c_MinimapRedrawInterval = 0.1;   // seconds, limits redraws while nodes are dragged
+static const int    c_MinimapMaxLinkSegments = 8;
+
+
+//------------------------------------------------------------------------------
+// Software rasterizer over an RGBA32 texture, colors are blended over the contents.
+namespace {
+
+struct Raster
+{
+    ImU32* m_Pixels;
+    int    m_Width;
+    int    m_Height;
+
+    void Clear(ImU32 color)
+    {
+        for (int i = 0, count = m_Width * m_Height; i < count; ++i)
+            m_Pixels[i] = color;
+    }
+
+    void Blend(int x, int y, ImU32 color)
+    {
+        auto& pixel = m_Pixels[y * m_Width + x];
+
+        const ImU32 alpha = (color >> IM_COL32_A_SHIFT) & 0xFF;
+        if (alpha == 0xFF)
+        {
+            pixel = color;
+            return;
+        }
+
+        const auto blend = [alpha](ImU32 src, ImU32 dst, int shift) -> ImU32
+        {
+            const ImU32 s = (src >> shift) & 0xFF;
+            const ImU32 d = (dst >> shift) & 0xFF;
+            return ((s * alpha + d * (255 - alpha)) / 255) << shift;
+        };
+
+        const ImU32 dstAlpha = (pixel >> IM_COL32_A_SHIFT) & 0xFF;
+        const ImU32 outAlpha = alpha + dstAlpha * (255 - alpha) / 255;
+        pixel = blend(color, pixel, IM_COL32_R_SHIFT) | blend(color, pixel, IM_COL32_G_SHIFT) | blend(color, pixel, IM_COL32_B_SHIFT)
+              | (outAlpha << IM_COL32_A_SHIFT);
+    }
+
+    // Covers at least one texel so small nodes stay visible.
+    void FillRect(const ImVec2& min, const ImVec2& max, ImU32 color)
+    {
+        const int x0 = ImClamp((int)min.x, 0, m_Width  - 1);
+        const int y0 = ImClamp((int)min.y, 0, m_Height - 1);
+        const int x1 = ImClamp((int)ImCeil(max.x), x0 + 1, m_Width);
+        const int y1 = ImClamp((int)ImCeil(max.y), y0 + 1, m_Height);
+        if (max.x < 0.0f || max.y < 0.0f || min.x >= m_Width || min.y >= m_Height)
+            return;
+
+        for (int y = y0; y < y1; ++y)
+            for (int x = x0; x < x1; ++x)
+                Blend(x, y, color);
+    }
+
+    void Line(const ImVec2& a, const ImVec2& b, ImU32 color)
+    {
+        int x0 = (int)a.x, y0 = (int)a.y;
+        const int x1 = (int)b.x, y1 = (int)b.y;
+        const int dx =  ImAbs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+        const int dy = -ImAbs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+
+        int error = dx + dy;
+        for (;;)
+        {
+            if (x0 >= 0 && y0 >= 0 && x0 < m_Width && y0 < m_Height)
+                Blend(x0, y0, color);
+            if (x0 == x1 && y0 == y1)
+                break;
+
+            const int e2 = 2 * error;
+            if (e2 >= dy) { error += dy; x0 += sx; }
+            if (e2 <= dx) { error += dx; y0 += sy; }
+        }
+    }
+};
+
+} // namespace
+
+
+//------------------------------------------------------------------------------
+ed::Minimap::Minimap(EditorContext* editor)
+    : Editor(editor)
+    , m_IsShown(false)
+    , m_WasShown(false)
+    , m_SizeFraction(0.2f)
+    , m_Location(MinimapLocation::BottomRight)
+    , m_ScreenRect()
+    , m_Content()
+    , m_Texture(nullptr)
+    , m_TextureContext(nullptr)
+    , m_ShutdownHook(0)
+    , m_Revision(0)
+    , m_SelectionId(0)
+    , m_RedrawTime(0.0)
+{
+}
+
+ed::Minimap::~Minimap()
+{
+    if (m_TextureContext)
+        ImGui::RemoveContextHook(m_TextureContext, m_ShutdownHook);
+    if (m_Texture)
+        Retire(m_Texture);
+}
+
+void ed::Minimap::Show(float sizeFraction, MinimapLocation location)
+{
+    m_IsShown      = true;
+    m_SizeFraction = ImClamp(sizeFraction, 0.0f, 1.0f);
+    m_Location     = location;
+}
+
+void ed::Minimap::Process()
+{
+    if (!m_WasShown || !m_Texture || m_ScreenRect.GetWidth() <= 0.0f || m_ScreenRect.GetHeight() <= 0.0f)
+        return;
+
+    // Canvas is still in last frame's view, so its local space matches m_ScreenRect
+    const auto cursor = ImGui::GetCursorScreenPos();
+    const auto min    = Editor->ToCanvas(m_ScreenRect.Min);
+    const auto max    = Editor->ToCanvas(m_ScreenRect.Max);
+
+    ImGui::SetCursorScreenPos(min);
+    ImGui::InvisibleButton("##minimap", max - min);
+    if (ImGui::IsItemActive())
+        Editor->CenterView(FromMinimap(Editor->ToScreen(ImGui::GetMousePos())));
+
+    ImGui::SetCursorScreenPos(cursor);
+}
+
+void ed::Minimap::Draw(ImDrawList* drawList)
+{
+    m_WasShown = m_IsShown;
+    if (!m_IsShown)
+        return;
+    m_IsShown = false;
+
+    const auto canvasRect = Editor->GetRect();
+    const auto size       = ImMax(canvasRect.GetSize() * m_SizeFraction, ImVec2(c_MinimapMinSize, c_MinimapMinSize));
+
+    const bool left = m_Location == MinimapLocation::TopLeft    || m_Location == MinimapLocation::BottomLeft;
+    const bool top  = m_Location == MinimapLocation::TopLeft    || m_Location == MinimapLocation::TopRight;
+    const auto min  = ImVec2(
+        left ? canvasRect.Min.x + c_MinimapMargin : canvasRect.Max.x - c_MinimapMargin - size.x,
+        top  ? canvasRect.Min.y + c_MinimapMargin : canvasRect.Max.y - c_MinimapMargin - size.y);
+    m_ScreenRect = ImRect(ImFloor(min), ImFloor(min + size));
+
+    auto textureSize = [](float size)
+    {
+        const int steps = ((int)ImCeil(size) + c_MinimapTextureStep - 1) / c_MinimapTextureStep;
+        return ImMin(steps * c_MinimapTextureStep, c_MinimapMaxTextureSize);
+    };
+
+    const bool created = UpdateTexture(textureSize(m_ScreenRect.GetWidth()), textureSize(m_ScreenRect.GetHeight()));
+    const bool changed = m_Revision != Editor->GetGeometryRevision() || m_SelectionId != Editor->GetSelectionId();
+    const auto time    = ImGui::GetTime();
+    if (created || (changed && time - m_RedrawTime >= c_MinimapRedrawInterval))
+    {
+        Redraw();
+        m_RedrawTime = time;
+    }
+
+    drawList->AddImage(m_Texture->GetTexRef(), m_ScreenRect.Min, m_ScreenRect.Max);
+
+    const auto viewRect = Editor->GetViewRect();
+    const auto viewMin  = m_ScreenRect.Min + ToMinimap(viewRect.Min) * m_ScreenRect.GetSize();
+    const auto viewMax  = m_ScreenRect.Min + ToMinimap(viewRect.Max) * m_ScreenRect.GetSize();
+    drawList->PushClipRect(m_ScreenRect.Min, m_ScreenRect.Max, true);
+    drawList->AddRectFilled(viewMin, viewMax, Editor->GetColor(StyleColor_NodeSelRect));
+    drawList->AddRect(viewMin, viewMax, Editor->GetColor(StyleColor_NodeSelRectBorder));
+    drawList->PopClipRect();
+
+    drawList->AddRect(m_ScreenRect.Min, m_ScreenRect.Max, Editor->GetColor(StyleColor_NodeBorder));
+}
+
+ImVec2 ed::Minimap::ToMinimap(const ImVec2& canvasPoint) const
+{
+    const auto size = m_Content.GetSize();
+    return ImVec2(
+        size.x > 0.0f ? (canvasPoint.x - m_Content.Min.x) / size.x : 0.5f,
+        size.y > 0.0f ? (canvasPoint.y - m_Content.Min.y) / size.y : 0.5f);
+}
+
+ImVec2 ed::Minimap::FromMinimap(const ImVec2& point) const
+{
+    const auto size = m_ScreenRect.GetSize();
+    const auto t    = ImVec2(
+        size.x > 0.0f ? (point.x - m_ScreenRect.Min.x) / size.x : 0.5f,
+        size.y > 0.0f ? (point.y - m_ScreenRect.Min.y) / size.y : 0.5f);
+    return m_Content.Min + t * m_Content.GetSize();
+}
+
+bool ed::Minimap::UpdateTexture(int width, int height)
+{
+    if (m_Texture && m_Texture->Width == width && m_Texture->Height == height)
+        return false;
+
+    if (m_Texture)
+        Retire(m_Texture);
+
+    m_Texture = IM_NEW(ImTextureData)();
+    m_Texture->Create(ImTextureFormat_RGBA32, width, height);
+    ImGui::RegisterUserTexture(m_Texture);
+
+    auto context = ImGui::GetCurrentContext();
+    IM_ASSERT(m_TextureContext == nullptr || m_TextureContext == context);
+    if (!m_TextureContext)
+    {
+        ImGuiContextHook hook;
+        hook.Type     = ImGuiContextHookType_Shutdown;
+        hook.Callback = OnShutdown;
+        hook.UserData = this;
+        m_ShutdownHook   = ImGui::AddContextHook(context, &hook);
+        m_TextureContext = context;
+    }
+
+    return true;
+}
+
+void ed::Minimap::Retire(ImTextureData* texture)
+{
+    // The editor may be destroyed while another ImGui context is current
+    auto previous = ImGui::GetCurrentContext();
+    ImGui::SetCurrentContext(m_TextureContext);
+    ImRetireUserTexture(texture);
+    ImGui::SetCurrentContext(previous);
+}
+
+void ed::Minimap::OnShutdown(ImGuiContext* context, ImGuiContextHook* hook)
+{
+    // The backend is already shut down, nothing is left to wait for
+    auto minimap = reinterpret_cast<Minimap*>(hook->UserData);
+    if (minimap->m_Texture)
+    {
+        ImGui::UnregisterUserTexture(minimap->m_Texture);
+        IM_DELETE(minimap->m_Texture);
+        minimap->m_Texture = nullptr;
+    }
+    ImGui::RemoveContextHook(context, hook->HookId);
+    minimap->m_TextureContext = nullptr;
+}
+
+void ed::Minimap::Redraw()
+{
+    m_Revision    = Editor->GetGeometryRevision();
+    m_SelectionId = Editor->GetSelectionId();
+
+    const auto& nodes = Editor->GetNodes();
+    const auto& links = Editor->GetLinks();
+
+    // Content bounds grown to the texture aspect, so the image is not stretched
+    bool   hasContent = false;
+    ImRect content;
+    for (auto node : nodes)
+    {
+        if (!node->m_IsLive)
+            continue;
+        if (!hasContent)
+            content = node->m_Bounds;
+        content.Add(node->m_Bounds);
+        hasContent = true;
+    }
+    if (!hasContent)
+        content = Editor->GetViewRect();
+
+    content.Expand(ImMax(content.GetWidth(), content.GetHeight()) * c_MinimapContentPadding + 1.0f);
+
+    const auto width  = m_Texture->Width;
+    const auto height = m_Texture->Height;
+    const auto aspect = (float)width / height;
+    auto contentSize  = content.GetSize();
+    if (contentSize.x < contentSize.y * aspect)
+        contentSize.x = contentSize.y * aspect;
+    else
+        contentSize.y = contentSize.x / aspect;
+    m_Content = ImRect(content.GetCenter() - contentSize * 0.5f, content.GetCenter() + contentSize * 0.5f);
+
+    const auto scale   = ImVec2(width / contentSize.x, height / contentSize.y);
+    const auto toTexel = [this, &scale](const ImVec2& p) { return (p - m_Content.Min) * scale; };
+
+    Raster raster{ reinterpret_cast<ImU32*>(m_Texture->Pixels), width, height };
+    raster.Clear(Editor->GetColor(StyleColor_Bg));
+
+    // Same layering as the editor: groups, links, nodes
+    const auto groupColor    = Editor->GetColor(StyleColor_GroupBorder);
+    const auto nodeColor     = Editor->GetColor(StyleColor_NodeBorder);
+    const auto selectedColor = Editor->GetColor(StyleColor_SelNodeBorder);
+    for (auto node : nodes)
+        if (node->m_IsLive && node->m_Type == NodeType::Group)
+            raster.FillRect(toTexel(node->m_Bounds.Min), toTexel(node->m_Bounds.Max), node->m_IsSelected ? selectedColor : groupColor);
+
+    for (auto link : links)
+    {
+        if (!link->m_IsLive || !link->m_IsCurveValid)
+            continue;
+
+        const auto& curve    = link->m_Curve;
+        const auto  start    = toTexel(curve.P0);
+        const auto  end      = toTexel(curve.P3);
+        const auto  length   = ImLength(end - start);
+        const int   segments = ImClamp((int)(length / 4.0f) + 1, 1, c_MinimapMaxLinkSegments);
+
+        auto previous = start;
+        for (int i = 1; i <= segments; ++i)
+        {
+            const auto point = i == segments ? end : toTexel(ImCubicBezier(curve.P0, curve.P1, curve.P2, curve.P3, (float)i / segments));
+            raster.Line(previous, point, link->m_Color);
+            previous = point;
+        }
+    }
+
+    for (auto node : nodes)
+        if (node->m_IsLive && node->m_Type != NodeType::Group)
+            raster.FillRect(toTexel(node->m_Bounds.Min), toTexel(node->m_Bounds.Max), node->m_IsSelected ? selectedColor : nodeColor);
+
+    // Full upload, unless the backend has yet to create it or an update is already queued
+    if (m_Texture->Status == ImTextureStatus_OK)
+    {
+        ImTextureRect rect = { 0, 0, (unsigned short)width, (unsigned short)height };
+        m_Texture->Updates.resize(0);
+        m_Texture->Updates.push_back(rect);
+        m_Texture->UpdateRect = rect;
+        m_Texture->SetStatus(ImTextureStatus_WantUpdates);
+    }
+}
@@ -5,8 +5,396 @@ namespace cimgui
     #include "cimplot_manual.h"
 }
 #include "implot.h"
+#include "implot_internal.h"
+#include <stdint.h>
+#include <algorithm>
 
 CIMGUI_API void cimgui::ImPlotSpec_Construct(cimgui::ImPlotSpec *spec)
 {
     *(reinterpret_cast<::ImPlotSpec*>(spec)) = ::ImPlotSpec();
 }
+
+//-----------------------------------------------------------------------------
+// ImPlotRingSeries
+//-----------------------------------------------------------------------------
+
+struct cimgui::ImPlotRingSeries
+{
+    // Sequence numbers of the samples that can still become the window min (or max),
+    // oldest first. A sample is dropped from the back once a newer one is at least as
+    // extreme, and from the front once it leaves the window, so every sample enters
+    // and leaves at most once.
+    struct MonotonicDeque
+    {
+        uint64_t* Data = nullptr;
+        int Capacity = 0;
+        int Head = 0;
+        int Size = 0;
+
+        uint64_t Front() const { return Data[Head]; }
+        uint64_t Back() const { return Data[(Head + Size - 1) % Capacity]; }
+        void PopFront() { Head = (Head + 1) % Capacity; Size--; }
+        void PopBack() { Size--; }
+        void PushBack(uint64_t seq) { Data[(Head + Size++) % Capacity] = seq; }
+    };
+
+    int Capacity;
+    int Count;
+    uint64_t Pushed;  // sequence number of the next sample
+    double* Xs;
+    double* Ys;
+    MonotonicDeque Min;
+    MonotonicDeque Max;
+
+    int Slot(uint64_t seq) const { return (int)(seq % (uint64_t)Capacity); }
+    // Index of the oldest sample, used as the plot offset
+    int Start() const { return Count < Capacity ? 0 : Slot(Pushed); }
+
+    void Push(double x, double y)
+    {
+        const uint64_t seq = Pushed++;
+        if (seq >= (uint64_t)Capacity)
+        {
+            const uint64_t evicted = seq - Capacity;
+            while (Min.Size && Min.Front() <= evicted) Min.PopFront();
+            while (Max.Size && Max.Front() <= evicted) Max.PopFront();
+        }
+        const int slot = Slot(seq);
+        Xs[slot] = x;
+        Ys[slot] = y;
+        if (Count < Capacity)
+            Count++;
+        if (y != y)
+            return;
+        while (Min.Size && Ys[Slot(Min.Back())] >= y) Min.PopBack();
+        Min.PushBack(seq);
+        while (Max.Size && Ys[Slot(Max.Back())] <= y) Max.PopBack();
+        Max.PushBack(seq);
+    }
+
+    void Clear()
+    {
+        Count = 0;
+        Pushed = 0;
+        Min.Head = Min.Size = 0;
+        Max.Head = Max.Size = 0;
+    }
+};
+
+CIMGUI_API cimgui::ImPlotRingSeries* cimgui::ImPlotRingSeries_Create(int capacity)
+{
+    IM_ASSERT(capacity > 0);
+    ImPlotRingSeries* series = IM_NEW(ImPlotRingSeries)();
+    series->Capacity = capacity;
+    series->Count = 0;
+    series->Pushed = 0;
+    series->Xs = (double*)IM_ALLOC(sizeof(double) * capacity);
+    series->Ys = (double*)IM_ALLOC(sizeof(double) * capacity);
+    series->Min.Data = (uint64_t*)IM_ALLOC(sizeof(uint64_t) * capacity);
+    series->Min.Capacity = capacity;
+    series->Max.Data = (uint64_t*)IM_ALLOC(sizeof(uint64_t) * capacity);
+    series->Max.Capacity = capacity;
+    return series;
+}
+
+CIMGUI_API void cimgui::ImPlotRingSeries_Destroy(cimgui::ImPlotRingSeries* series)
+{
+    if (!series)
+        return;
+    IM_FREE(series->Xs);
+    IM_FREE(series->Ys);
+    IM_FREE(series->Min.Data);
+    IM_FREE(series->Max.Data);
+    IM_DELETE(series);
+}
+
+CIMGUI_API void cimgui::ImPlotRingSeries_Clear(cimgui::ImPlotRingSeries* series)
+{
+    series->Clear();
+}
+
+CIMGUI_API void cimgui::ImPlotRingSeries_Push(cimgui::ImPlotRingSeries* series, double x, double y)
+{
+    series->Push(x, y);
+}
+
+CIMGUI_API void cimgui::ImPlotRingSeries_PushBatch(cimgui::ImPlotRingSeries* series, const double* xs, const double* ys, int count)
+{
+    // Only the last Capacity samples survive, skip the rest
+    int first = count > series->Capacity ? count - series->Capacity : 0;
+    if (first > 0)
+        series->Pushed += first;
+    for (int i = first; i < count; i++)
+        series->Push(xs[i], ys[i]);
+}
+
+CIMGUI_API int cimgui::ImPlotRingSeries_GetCount(const cimgui::ImPlotRingSeries* series)
+{
+    return series->Count;
+}
+
+CIMGUI_API int cimgui::ImPlotRingSeries_GetCapacity(const cimgui::ImPlotRingSeries* series)
+{
+    return series->Capacity;
+}
+
+CIMGUI_API bool cimgui::ImPlotRingSeries_GetBounds(const cimgui::ImPlotRingSeries* series, cimgui::ImPlotRect* bounds)
+{
+    if (series->Count == 0 || series->Min.Size == 0)
+        return false;
+    const int start = series->Start();
+    bounds->X.Min = series->Xs[start];
+    bounds->X.Max = series->Xs[series->Slot(series->Pushed - 1)];
+    bounds->Y.Min = series->Ys[series->Slot(series->Min.Front())];
+    bounds->Y.Max = series->Ys[series->Slot(series->Max.Front())];
+    return true;
+}
+
+static ::ImPlotSpec RingSpec(const cimgui::ImPlotRingSeries* series, const cimgui::ImPlotSpec& spec)
+{
+    ::ImPlotSpec result = reinterpret_cast<const ::ImPlotSpec&>(spec);
+    result.Offset = series->Start();
+    result.Stride = sizeof(double);
+    return result;
+}
+
+CIMGUI_API void cimgui::ImPlotRingSeries_PlotLine(const cimgui::ImPlotRingSeries* series, const char* label_id, const cimgui::ImPlotSpec spec)
+{
+    ImPlot::PlotLine(label_id, series->Xs, series->Ys, series->Count, RingSpec(series, spec));
+}
+
+CIMGUI_API void cimgui::ImPlotRingSeries_PlotShaded(const cimgui::ImPlotRingSeries* series, const char* label_id, double yref, const cimgui::ImPlotSpec spec)
+{
+    ImPlot::PlotShaded(label_id, series->Xs, series->Ys, series->Count, yref, RingSpec(series, spec));
+}
+
+//-----------------------------------------------------------------------------
+// ImPlotPyramidSeries
+//-----------------------------------------------------------------------------
+
+struct cimgui::ImPlotPyramidSeries
+{
+    // Each level merges Fanout buckets of the one below, bucket i of level L
+    // covering raw samples [i << (L * FanoutShift), (i + 1) << (L * FanoutShift)).
+    // With a fanout of 4 the whole pyramid holds a third as many buckets as samples.
+    static const int FanoutShift = 2;
+    static const int Fanout = 1 << FanoutShift;
+
+    struct Level
+    {
+        ImVector<double> X;     // x of the first sample
+        ImVector<double> Min;
+        ImVector<double> Max;
+        ImVector<double> Mean;
+        ImVector<int> Count;    // finite samples in the bucket
+    };
+
+    ImVector<double> Xs;
+    ImVector<double> Ys;
+    ImVector<Level*> Levels;    // Levels[L - 1] is level L
+    bool Dirty = false;         // partial tail buckets need refreshing
+
+    ~ImPlotPyramidSeries() { Clear(); }
+
+    void Clear()
+    {
+        for (Level* level : Levels)
+            IM_DELETE(level);
+        Levels.clear();
+        Xs.clear();
+        Ys.clear();
+        Dirty = false;
+    }
+
+    static int BucketSize(int l) { return 1 << (l * FanoutShift); }
+
+    // Recompute bucket i of level l from its children
+    void Update(int l, int i)
+    {
+        Level& dst = *Levels[l - 1];
+        double mn = HUGE_VAL, mx = -HUGE_VAL, sum = 0;
+        int count = 0;
+        double x;
+        const int c0 = i * Fanout;
+        if (l == 1)
+        {
+            const int c1 = ImMin(c0 + Fanout, Ys.Size);
+            x = Xs[c0];
+            for (int c = c0; c < c1; c++)
+            {
+                const double y = Ys[c];
+                if (y != y)
+                    continue;
+                mn = ImMin(mn, y);
+                mx = ImMax(mx, y);
+                sum += y;
+                count++;
+            }
+        }
+        else
+        {
+            const Level& src = *Levels[l - 2];
+            const int c1 = ImMin(c0 + Fanout, src.X.Size);
+            x = src.X[c0];
+            for (int c = c0; c < c1; c++)
+            {
+                if (!src.Count[c])
+                    continue;
+                mn = ImMin(mn, src.Min[c]);
+                mx = ImMax(mx, src.Max[c]);
+                sum += src.Mean[c] * src.Count[c];
+                count += src.Count[c];
+            }
+        }
+        if (i == dst.X.Size)
+        {
+            dst.X.push_back(0); dst.Min.push_back(0); dst.Max.push_back(0);
+            dst.Mean.push_back(0); dst.Count.push_back(0);
+        }
+        dst.X[i] = x;
+        dst.Min[i] = count ? mn : NAN;
+        dst.Max[i] = count ? mx : NAN;
+        dst.Mean[i] = count ? sum / count : NAN;
+        dst.Count[i] = count;
+    }
+
+    // Buckets are finalized as they fill, which is amortized O(1) per sample.
+    // A level exists once its first bucket is full.
+    void Push(double x, double y)
+    {
+        IM_ASSERT(Xs.Size == 0 || x >= Xs.back());
+        Xs.push_back(x);
+        Ys.push_back(y);
+        Dirty = true;
+        const int count = Xs.Size;
+        for (int l = 1; l * FanoutShift < 31 && (count & (BucketSize(l) - 1)) == 0; l++)
+        {
+            if (l > Levels.Size)
+                Levels.push_back(IM_NEW(Level)());
+            Update(l, (count >> (l * FanoutShift)) - 1);
+        }
+    }
+
+    // Bring the last, partially filled bucket of each level up to date
+    void Flush()
+    {
+        if (!Dirty)
+            return;
+        const int last = Xs.Size - 1;
+        for (int l = 1; l <= Levels.Size; l++)
+            Update(l, last >> (l * FanoutShift));
+        Dirty = false;
+    }
+
+    void Reserve(int capacity)
+    {
+        Xs.reserve(capacity);
+        Ys.reserve(capacity);
+    }
+};
+
+CIMGUI_API cimgui::ImPlotPyramidSeries* cimgui::ImPlotPyramidSeries_Create(void)
+{
+    return IM_NEW(ImPlotPyramidSeries)();
+}
+
+CIMGUI_API void cimgui::ImPlotPyramidSeries_Destroy(cimgui::ImPlotPyramidSeries* series)
+{
+    if (series)
+        IM_DELETE(series);
+}
+
+CIMGUI_API void cimgui::ImPlotPyramidSeries_Clear(cimgui::ImPlotPyramidSeries* series)
+{
+    series->Clear();
+}
+
+CIMGUI_API void cimgui::ImPlotPyramidSeries_Reserve(cimgui::ImPlotPyramidSeries* series, int capacity)
+{
+    series->Reserve(capacity);
+}
+
+CIMGUI_API void cimgui::ImPlotPyramidSeries_Push(cimgui::ImPlotPyramidSeries* series, double x, double y)
+{
+    series->Push(x, y);
+}
+
+CIMGUI_API void cimgui::ImPlotPyramidSeries_PushBatch(cimgui::ImPlotPyramidSeries* series, const double* xs, const double* ys, int count)
+{
+    series->Reserve(series->Xs.Size + count);
+    for (int i = 0; i < count; i++)
+        series->Push(xs[i], ys[i]);
+}
+
+CIMGUI_API int cimgui::ImPlotPyramidSeries_GetCount(const cimgui::ImPlotPyramidSeries* series)
+{
+    return series->Xs.Size;
+}
+
+CIMGUI_API bool cimgui::ImPlotPyramidSeries_GetBounds(cimgui::ImPlotPyramidSeries* series, cimgui::ImPlotRect* bounds)
+{
+    series->Flush();
+    // The top level holds at most Fanout buckets
+    const double* mins = series->Ys.Data;
+    const double* maxs = series->Ys.Data;
+    int count = series->Ys.Size;
+    if (series->Levels.Size)
+    {
+        const ImPlotPyramidSeries::Level& top = *series->Levels.back();
+        mins = top.Min.Data;
+        maxs = top.Max.Data;
+        count = top.X.Size;
+    }
+    double mn = HUGE_VAL, mx = -HUGE_VAL;
+    for (int i = 0; i < count; i++)
+    {
+        if (mins[i] != mins[i])
+            continue;
+        mn = ImMin(mn, mins[i]);
+        mx = ImMax(mx, maxs[i]);
+    }
+    if (mn > mx)
+        return false;
+    bounds->X.Min = series->Xs[0];
+    bounds->X.Max = series->Xs.back();
+    bounds->Y.Min = mn;
+    bounds->Y.Max = mx;
+    return true;
+}
+
+CIMGUI_API int cimgui::ImPlotPyramidSeries_Plot(cimgui::ImPlotPyramidSeries* series, const char* label_id, const cimgui::ImPlotSpec spec)
+{
+    series->Flush();
+    ::ImPlotSpec s = reinterpret_cast<const ::ImPlotSpec&>(spec);
+    s.Offset = 0;
+    s.Stride = sizeof(double);
+    const ImVector<double>& xs = series->Xs;
+    int lo = 0, hi = xs.Size;
+    // While fitting, submit the whole history so the axes see its full extent
+    if (!ImPlot::FitThisFrame() && xs.Size)
+    {
+        const ::ImPlotRect limits = ImPlot::GetPlotLimits();
+        // Keep one sample either side so the line runs off the plot edges
+        lo = ImMax(0, (int)(std::lower_bound(xs.begin(), xs.end(), limits.X.Min) - xs.begin()) - 1);
+        hi = ImMin(xs.Size, (int)(std::upper_bound(xs.begin(), xs.end(), limits.X.Max) - xs.begin()) + 1);
+        if (hi < lo)
+            hi = lo;
+    }
+    // Up to two samples or buckets per pixel
+    const int budget = 2 * ImMax(1, (int)ImPlot::GetPlotSize().x);
+    int level = 0;
+    while (level < series->Levels.Size && ((hi - lo) >> (level * ImPlotPyramidSeries::FanoutShift)) > budget)
+        level++;
+    if (level == 0)
+    {
+        ImPlot::PlotLine(label_id, xs.Data + lo, series->Ys.Data + lo, hi - lo, s);
+        return 0;
+    }
+    const ImPlotPyramidSeries::Level& lv = *series->Levels[level - 1];
+    const int shift = level * ImPlotPyramidSeries::FanoutShift;
+    const int b0 = lo >> shift;
+    const int b1 = hi > lo ? ((hi - 1) >> shift) + 1 : b0;
+    ImPlot::PlotShaded(label_id, lv.X.Data + b0, lv.Min.Data + b0, lv.Max.Data + b0, b1 - b0, s);
+    ImPlot::PlotLine(label_id, lv.X.Data + b0, lv.Mean.Data + b0, b1 - b0, s);
+    return level;
+}
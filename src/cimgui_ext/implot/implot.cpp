@@ -482,6 +482,7 @@ void DestroyContext(ImPlotContext* ctx) {
         ctx = GImPlot;
     if (GImPlot == ctx)
         SetCurrentContext(nullptr);
+    DestroyHeatmapCaches(ctx);
     IM_DELETE(ctx);
 }
 
@@ -500,6 +501,8 @@ void Initialize(ImPlotContext* ctx) {
     ResetCtxForNextPlot(ctx);
     ResetCtxForNextAlignedPlots(ctx);
     ResetCtxForNextSubplot(ctx);
+    ctx->HeatmapHookContext = nullptr;
+    ctx->HeatmapHooks[0] = ctx->HeatmapHooks[1] = 0;
 
     const ImU32 Deep[]     = {4289753676, 4283598045, 4285048917, 4283584196, 4289950337, 4284512403, 4291005402, 4287401100, 4285839820, 4291671396                        };
     const ImU32 Dark[]     = {4280031972, 4290281015, 4283084621, 4288892568, 4278222847, 4281597951, 4280833702, 4290740727, 4288256409                                    };
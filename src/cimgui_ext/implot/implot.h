@@ -259,6 +259,9 @@ enum ImPlotLineFlags_ {
     ImPlotLineFlags_SkipNaN     = 1 << 12, // NaNs values will be skipped instead of rendered as missing data
     ImPlotLineFlags_NoClip      = 1 << 13, // markers (if displayed) on the edge of a plot will not be clipped
     ImPlotLineFlags_Shaded      = 1 << 14, // a filled region between the line and horizontal origin will be rendered; use PlotShaded for more advanced cases
+    ImPlotLineFlags_Decimate    = 1 << 15, // with more points than pixels, only the first, last, min and max point of each pixel column is rendered (xs should be ascending)
+    ImPlotLineFlags_DecimateLTTB= 1 << 16, // with more points than pixels, points are reduced to two per pixel with largest-triangle-three-buckets (xs should be ascending)
+    ImPlotLineFlags_SortedX     = 1 << 17, // xs are ascending and not NaN, lets decimation skip checking every point each frame
 };
 
 // Flags for PlotScatter. Used by setting ImPlotSpec::Flags.
@@ -334,6 +337,8 @@ enum ImPlotPieChartFlags_ {
 enum ImPlotHeatmapFlags_ {
     ImPlotHeatmapFlags_None     = 0,       // default
     ImPlotHeatmapFlags_ColMajor = 1 << 10, // data will be read in column major order
+    ImPlotHeatmapFlags_SkipMin  = 1 << 11, // cells at or below scale_min are left empty, so sparse grids only emit their non-empty cells
+    ImPlotHeatmapFlags_Texture  = 1 << 12, // draw from a cached texture that is only re-uploaded when cell colors change (linear axes, up to 2048 cells per side)
 };
 
 // Flags for PlotHistogram and PlotHistogram2D. Used by setting ImPlotSpec::Flags.
@@ -343,7 +348,9 @@ enum ImPlotHistogramFlags_ {
     ImPlotHistogramFlags_Cumulative = 1 << 11, // each bin will contain its count plus the counts of all previous bins (not supported by PlotHistogram2D)
     ImPlotHistogramFlags_Density    = 1 << 12, // counts will be normalized, i.e. the PDF will be visualized, or the CDF will be visualized if Cumulative is also set
     ImPlotHistogramFlags_NoOutliers = 1 << 13, // exclude values outside the specified histogram range from the count toward normalizing and cumulative counts
-    ImPlotHistogramFlags_ColMajor   = 1 << 14  // data will be read in column major order (not supported by PlotHistogram)
+    ImPlotHistogramFlags_ColMajor   = 1 << 14, // data will be read in column major order (not supported by PlotHistogram)
+    ImPlotHistogramFlags_SkipEmpty  = 1 << 15, // empty bins are left undrawn (not supported by PlotHistogram)
+    ImPlotHistogramFlags_Texture    = 1 << 16  // draw bins from a cached texture, see ImPlotHeatmapFlags_Texture (not supported by PlotHistogram)
 };
 
 // Flags for PlotDigital (placeholder). Used by setting ImPlotSpec::Flags.
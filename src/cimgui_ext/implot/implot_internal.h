@@ -1043,6 +1043,19 @@ struct ImPlotItemGroup
     void        Reset()                          { ItemPool.Clear(); Legend.Reset(); ColormapIdx = 0;            }
 };
 
+// Heatmap drawn from a texture, re-uploaded only when its cell colors change
+struct ImPlotHeatmapCache
+{
+    ImTextureData*  Texture;
+    ImVector<ImU32> Colors;     // cell colors of the last upload, in data order
+    int             Rows, Cols;
+    int             Scale;      // texels per cell side
+    bool            ColMajor;
+    int             LastFrame;
+
+    ImPlotHeatmapCache() { Texture = nullptr; Rows = Cols = Scale = 0; ColMajor = false; LastFrame = -1; }
+};
+
 // Holds Plot state information that must persist after EndPlot
 struct ImPlotPlot
 {
@@ -1255,6 +1268,13 @@ struct ImPlotContext {
     // Temp data for general use
     ImVector<double>   TempDouble1, TempDouble2;
     ImVector<int>      TempInt1;
+    ImVector<ImU32>    TempU32;
+    ImVector<ImPlotPoint> TempPoints;
+
+    // Textures of heatmaps plotted with ImPlotHeatmapFlags_Texture, by item ID
+    ImPool<ImPlotHeatmapCache> HeatmapCaches;
+    ImGuiContext*              HeatmapHookContext; // ImGui context sweeping the caches every frame, set once a texture was made
+    ImGuiID                    HeatmapHooks[2];    // its NewFramePre and Shutdown hooks
 
     // Misc
     int                DigitalPlotItemCnt;
@@ -1291,6 +1311,8 @@ IMPLOT_API void ResetCtxForNextPlot(ImPlotContext* ctx);
 IMPLOT_API void ResetCtxForNextAlignedPlots(ImPlotContext* ctx);
 // Resets an ImPlot context for the next call to BeginSubplot
 IMPLOT_API void ResetCtxForNextSubplot(ImPlotContext* ctx);
+// Hands the heatmap cache textures of a context to the backend for destruction and removes its ImGui context hooks
+IMPLOT_API void DestroyHeatmapCaches(ImPlotContext* ctx);
 
 //-----------------------------------------------------------------------------
 // [SECTION] Plot Utils
@@ -64,6 +64,11 @@ static IMPLOT_INLINE float  ImInvSqrt(float x) { return _mm_cvtss_f32(_mm_rsqrt_
 static IMPLOT_INLINE float  ImInvSqrt(float x) { return 1.0f / sqrtf(x); }
 #endif
 
+// Vector path of the heatmap colormap lookup
+#include "simd_ext.h"
+// Release of heatmap textures
+#include "texture_ext.h"
+
 #define IMPLOT_NORMALIZE2F_OVER_ZERO(VX,VY) do { float d2 = VX*VX + VY*VY; if (d2 > 0.0f) { float inv_len = ImInvSqrt(d2); VX *= inv_len; VY *= inv_len; } } while (0)
 
 // Support for pre-1.82 versions. Users on 1.82+ can use 0 (default) flags to mean "all corners" but in order to support older versions we are more explicit.
@@ -902,6 +907,201 @@ struct Transformer2 {
     Transformer1 Ty;
 };
 
+//-----------------------------------------------------------------------------
+// [SECTION] Decimation
+//-----------------------------------------------------------------------------
+
+/// Points produced by a decimator
+struct GetterPoints {
+    GetterPoints(const ImPlotPoint* data, int count) : Data(data), Count(count) { }
+    template <typename I> IMPLOT_INLINE ImPlotPoint operator[](I idx) const {
+        return Data[idx];
+    }
+    const ImPlotPoint* const Data;
+    const int Count;
+    typedef ImPlotPoint value_type;
+};
+
+/// Consecutive sub-range of another getter
+template <typename _Getter>
+struct GetterRange {
+    GetterRange(const _Getter& getter, int first, int count) : Getter(getter), First(first), Count(count) { }
+    template <typename I> IMPLOT_INLINE ImPlotPoint operator[](I idx) const {
+        return Getter[First + idx];
+    }
+    const _Getter& Getter;
+    const int First;
+    const int Count;
+    typedef ImPlotPoint value_type;
+};
+
+// Decimation needs ascending x. Evenly spaced values are ascending by construction, anything
+// else is checked point by point on every call (NaN x counts as unsorted) unless the caller
+// vouches for it with ImPlotLineFlags_SortedX.
+template <typename _Getter>
+bool IsAscendingX(const _Getter& getter) {
+    double prev = -HUGE_VAL;
+    for (int i = 0; i < getter.Count; ++i) {
+        const double x = getter[i].x;
+        if (!(x >= prev))
+            return false;
+        prev = x;
+    }
+    return true;
+}
+
+template <typename _IndexerY>
+bool IsAscendingX(const GetterXY<IndexerLin,_IndexerY>& getter) {
+    return getter.IndexerX.M >= 0;
+}
+
+// Index range of ascending x values inside [x_min, x_max], widened by one point on each side so
+// the strip stays connected to the plot edges. A NaN x (only possible with a wrong SortedX flag)
+// compares as inside the range, the result is then off but always a valid index range.
+template <typename _Getter>
+void VisibleRangeX(const _Getter& getter, double x_min, double x_max, int* first, int* last) {
+    // first point with x >= x_min
+    int lo = 0, hi = getter.Count;
+    while (lo < hi) {
+        const int mid = lo + (hi - lo) / 2;
+        if (getter[mid].x < x_min)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    *first = ImMax(lo - 1, 0);
+    // first point with x > x_max
+    hi = getter.Count;
+    while (lo < hi) {
+        const int mid = lo + (hi - lo) / 2;
+        if (getter[mid].x <= x_max)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    *last = ImMin(lo, getter.Count - 1);
+}
+
+// Min/max (M4) decimation: for each run of points falling in the same pixel column, keeps the
+// first, min, max and last point in index order. Spikes survive and consecutive columns stay
+// connected, so at most 4 points per column are rendered. NaN points are kept as line breaks.
+template <typename _Getter>
+void DecimateMinMax(const _Getter& getter, const Transformer1& tx, ImVector<ImPlotPoint>& out) {
+    out.resize(0);
+    // on linear axes, points inside the current column's x interval skip the transform
+    const bool linear = tx.TransformFwd == nullptr && tx.M != 0;
+    double x_lo = 1, x_hi = 0;
+    bool open = false;
+    int column = 0;
+    int idx[4]; // first, min, max, last
+    double y_min = 0, y_max = 0;
+    auto flush = [&]() {
+        if (!open)
+            return;
+        open = false;
+        if (idx[1] > idx[2])
+            ImSwap(idx[1], idx[2]);
+        for (int k = 0; k < 4; ++k) {
+            if (k == 0 || idx[k] != idx[k - 1])
+                out.push_back(getter[idx[k]]);
+        }
+    };
+    for (int i = 0; i < getter.Count; ++i) {
+        const ImPlotPoint p = getter[i];
+        if (p.x != p.x || p.y != p.y) {
+            flush();
+            out.push_back(p);
+            continue;
+        }
+        if (!(open && p.x >= x_lo && p.x < x_hi)) {
+            const int c = (int)ImFloor(ImClamp(tx(p.x), -1.0e9f, 1.0e9f));
+            if (!open || c != column) {
+                flush();
+                open = true;
+                column = c;
+                idx[0] = idx[1] = idx[2] = idx[3] = i;
+                y_min = y_max = p.y;
+                if (linear) {
+                    x_lo = tx.PltMin + (c - tx.PixMin) / tx.M;
+                    x_hi = tx.PltMin + (c + 1 - tx.PixMin) / tx.M;
+                    if (x_lo > x_hi)
+                        ImSwap(x_lo, x_hi);
+                }
+                continue;
+            }
+        }
+        if (p.y < y_min) { y_min = p.y; idx[1] = i; }
+        if (p.y > y_max) { y_max = p.y; idx[2] = i; }
+        idx[3] = i;
+    }
+    flush();
+}
+
+// Largest-triangle-three-buckets: keeps threshold points, the first and last plus the point of
+// each bucket forming the largest triangle with the previous pick and the next bucket's average.
+// NaN points are neither averaged nor picked (a NaN would poison every area it takes part in),
+// so they are not rendered as line breaks and buckets holding nothing else are dropped.
+template <typename _Getter>
+void DecimateLTTB(const _Getter& getter, int threshold, ImVector<ImPlotPoint>& out) {
+    const int count = getter.Count;
+    out.resize(0);
+    if (threshold < 3 || threshold >= count) {
+        out.resize(count);
+        for (int i = 0; i < count; ++i)
+            out[i] = getter[i];
+        return;
+    }
+    out.reserve(threshold);
+    const double every = (double)(count - 2) / (threshold - 2);
+    out.push_back(getter[0]);
+    // triangles start from the first real point
+    int start = 0;
+    while (start < count - 1 && (ImNan(getter[start].x) || ImNan(getter[start].y)))
+        ++start;
+    ImPlotPoint a = getter[start];
+    for (int b = 0; b < threshold - 2; ++b) {
+        const int avg_start = (int)((b + 1) * every) + 1;
+        const int avg_end   = ImMin((int)((b + 2) * every) + 1, count);
+        double avg_x = 0, avg_y = 0;
+        int avg_count = 0;
+        for (int i = avg_start; i < avg_end; ++i) {
+            const ImPlotPoint p = getter[i];
+            if (ImNan(p.x) || ImNan(p.y))
+                continue;
+            avg_x += p.x;
+            avg_y += p.y;
+            ++avg_count;
+        }
+        if (avg_count > 0) {
+            avg_x /= avg_count;
+            avg_y /= avg_count;
+        }
+        else {
+            avg_x = a.x;
+            avg_y = a.y;
+        }
+        const int range_start = (int)(b * every) + 1;
+        const int range_end   = (int)((b + 1) * every) + 1;
+        ImPlotPoint picked;
+        double max_area = -1;
+        for (int i = range_start; i < range_end; ++i) {
+            const ImPlotPoint p = getter[i];
+            if (ImNan(p.x) || ImNan(p.y))
+                continue;
+            const double area = ImAbs((a.x - avg_x) * (p.y - a.y) - (a.x - p.x) * (avg_y - a.y));
+            if (area > max_area) {
+                max_area = area;
+                picked = p;
+            }
+        }
+        if (max_area < 0)
+            continue;
+        out.push_back(picked);
+        a = picked;
+    }
+    out.push_back(getter[count - 1]);
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] Renderers
 //-----------------------------------------------------------------------------
@@ -1774,6 +1974,46 @@ void RenderMarkers(const _Getter& getter, ImPlotMarker marker, float size, bool
 // [SECTION] PlotLine
 //-----------------------------------------------------------------------------
 
+template <typename _Getter>
+void RenderLineEx(const _Getter& getter, const ImPlotSpec& spec) {
+    const ImPlotNextItemData& s = GetItemData();
+    if (getter.Count > 1) {
+        if (ImHasFlag(spec.Flags, ImPlotLineFlags_Shaded) && s.RenderFill) {
+            const ImU32 col_fill = ImGui::GetColorU32(s.Spec.FillColor);
+            GetterOverrideY<_Getter> getter2(getter, 0);
+            RenderPrimitives2<RendererShaded>(getter,getter2,col_fill);
+        }
+        if (s.RenderLine) {
+            const ImU32 col_line = ImGui::GetColorU32(s.Spec.LineColor);
+            if (ImHasFlag(spec.Flags,ImPlotLineFlags_Segments)) {
+                RenderPrimitives1<RendererLineSegments1>(getter,col_line,s.Spec.LineWeight);
+            }
+            else if (ImHasFlag(spec.Flags, ImPlotLineFlags_Loop)) {
+                if (ImHasFlag(spec.Flags, ImPlotLineFlags_SkipNaN))
+                    RenderPrimitives1<RendererLineStripSkip>(GetterLoop<_Getter>(getter),col_line,s.Spec.LineWeight);
+                else
+                    RenderPrimitives1<RendererLineStrip>(GetterLoop<_Getter>(getter),col_line,s.Spec.LineWeight);
+            }
+            else {
+                if (ImHasFlag(spec.Flags, ImPlotLineFlags_SkipNaN))
+                    RenderPrimitives1<RendererLineStripSkip>(getter,col_line,s.Spec.LineWeight);
+                else
+                    RenderPrimitives1<RendererLineStrip>(getter,col_line,s.Spec.LineWeight);
+            }
+        }
+    }
+    // render markers
+    if (s.RenderMarkers) {
+        if (ImHasFlag(spec.Flags, ImPlotLineFlags_NoClip)) {
+            PopPlotClipRect();
+            PushPlotClipRect(s.Spec.MarkerSize);
+        }
+        const ImU32 col_line = ImGui::GetColorU32(s.Spec.MarkerLineColor);
+        const ImU32 col_fill = ImGui::GetColorU32(s.Spec.MarkerFillColor);
+        RenderMarkers<_Getter>(getter, s.Spec.Marker, s.Spec.MarkerSize, s.RenderMarkerFill, col_fill, s.RenderMarkerLine, col_line, s.Spec.LineWeight);
+    }
+}
+
 template <typename _Getter>
 void PlotLineEx(const char* label_id, const _Getter& getter, const ImPlotSpec& spec) {
     if (BeginItemEx(label_id, Fitter1<_Getter>(getter), spec, spec.LineColor, spec.Marker)) {
@@ -1781,42 +2021,33 @@ void PlotLineEx(const char* label_id, const _Getter& getter, const ImPlotSpec& s
             EndItem();
             return;
         }
-        const ImPlotNextItemData& s = GetItemData();
-        if (getter.Count > 1) {
-            if (ImHasFlag(spec.Flags, ImPlotLineFlags_Shaded) && s.RenderFill) {
-                const ImU32 col_fill = ImGui::GetColorU32(s.Spec.FillColor);
-                GetterOverrideY<_Getter> getter2(getter, 0);
-                RenderPrimitives2<RendererShaded>(getter,getter2,col_fill);
-            }
-            if (s.RenderLine) {
-                const ImU32 col_line = ImGui::GetColorU32(s.Spec.LineColor);
-                if (ImHasFlag(spec.Flags,ImPlotLineFlags_Segments)) {
-                    RenderPrimitives1<RendererLineSegments1>(getter,col_line,s.Spec.LineWeight);
-                }
-                else if (ImHasFlag(spec.Flags, ImPlotLineFlags_Loop)) {
-                    if (ImHasFlag(spec.Flags, ImPlotLineFlags_SkipNaN))
-                        RenderPrimitives1<RendererLineStripSkip>(GetterLoop<_Getter>(getter),col_line,s.Spec.LineWeight);
+        // decimate strips with more than two points per pixel column, only the visible x range
+        // is considered (unsorted data is drawn as is, SortedX skips the sortedness scan)
+        const ImPlotPlot& plot = *GetCurrentPlot();
+        const int columns = ImMax((int)plot.PlotRect.GetWidth(), 1);
+        if (ImHasFlag(spec.Flags, ImPlotLineFlags_Decimate) || ImHasFlag(spec.Flags, ImPlotLineFlags_DecimateLTTB)) {
+            if (!ImHasFlag(spec.Flags, ImPlotLineFlags_Segments) && !ImHasFlag(spec.Flags, ImPlotLineFlags_Loop) && getter.Count > 2 * columns &&
+                (ImHasFlag(spec.Flags, ImPlotLineFlags_SortedX) || IsAscendingX(getter))) {
+                const Transformer1 tx = Transformer2(plot).Tx;
+                int first, last;
+                VisibleRangeX(getter, tx.PltMin, tx.PltMax, &first, &last);
+                GetterRange<_Getter> visible(getter, first, last - first + 1);
+                if (visible.Count > 2 * columns) {
+                    ImVector<ImPlotPoint>& points = GImPlot->TempPoints;
+                    if (ImHasFlag(spec.Flags, ImPlotLineFlags_DecimateLTTB))
+                        DecimateLTTB(visible, 2 * columns, points);
                     else
-                        RenderPrimitives1<RendererLineStrip>(GetterLoop<_Getter>(getter),col_line,s.Spec.LineWeight);
+                        DecimateMinMax(visible, tx, points);
+                    RenderLineEx(GetterPoints(points.Data, points.Size), spec);
                 }
                 else {
-                    if (ImHasFlag(spec.Flags, ImPlotLineFlags_SkipNaN))
-                        RenderPrimitives1<RendererLineStripSkip>(getter,col_line,s.Spec.LineWeight);
-                    else
-                        RenderPrimitives1<RendererLineStrip>(getter,col_line,s.Spec.LineWeight);
+                    RenderLineEx(visible, spec);
                 }
+                EndItem();
+                return;
             }
         }
-        // render markers
-        if (s.RenderMarkers) {
-            if (ImHasFlag(spec.Flags, ImPlotLineFlags_NoClip)) {
-                PopPlotClipRect();
-                PushPlotClipRect(s.Spec.MarkerSize);
-            }
-            const ImU32 col_line = ImGui::GetColorU32(s.Spec.MarkerLineColor);
-            const ImU32 col_fill = ImGui::GetColorU32(s.Spec.MarkerFillColor);
-            RenderMarkers<_Getter>(getter, s.Spec.Marker, s.Spec.MarkerSize, s.RenderMarkerFill, col_fill, s.RenderMarkerLine, col_line, s.Spec.LineWeight);
-        }
+        RenderLineEx(getter, spec);
         EndItem();
     }
 }
@@ -2786,51 +3017,150 @@ CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
 // [SECTION] PlotHeatmap
 //-----------------------------------------------------------------------------
 
-template <typename _Indexer>
-struct GetterHeatmapRowMaj {
-    GetterHeatmapRowMaj(_Indexer indexer, int rows, int cols, double scale_min, double scale_max, double width, double height, double xref, double yref, double ydir) :
-        Indexer(indexer),
-        Count(rows*cols),
-        Rows(rows),
-        Cols(cols),
-        ScaleMin(scale_min),
-        ScaleMax(scale_max),
-        Width(width),
-        Height(height),
-        XRef(xref),
-        YRef(yref),
-        YDir(ydir),
-        HalfSize(Width*0.5, Height*0.5)
-    { }
-    template <typename I> IMPLOT_INLINE RectC operator[](I idx) const {
-        double val = (double)Indexer[idx];
-        const int r = idx / Cols;
-        const int c = idx % Cols;
-        const ImPlotPoint p(XRef + HalfSize.x + c*Width, YRef + YDir * (HalfSize.y + r*Height));
-        RectC rect;
-        rect.Pos = p;
-        rect.HalfSize = HalfSize;
-        const float t = ImClamp((float)ImRemap01(val, ScaleMin, ScaleMax),0.0f,1.0f);
+// Colormap lookup for heatmap cells, equivalent to LerpTable on the value remapped to [0,1] and clamped.
+// NaN maps to the top of the scale. With skip_min, values at or below scale_min (and NaN) get no color.
+struct HeatmapColorizer {
+    HeatmapColorizer(ImPlotColormap cmap, double scale_min, double scale_max, bool skip_min) {
         ImPlotContext& gp = *GImPlot;
-        rect.Color = gp.ColormapData.LerpTable(gp.Style.Colormap, t);
-        return rect;
-    }
-    const _Indexer Indexer;
-    const int Count, Rows, Cols;
-    const double ScaleMin, ScaleMax, Width, Height, XRef, YRef, YDir;
-    const ImPlotPoint HalfSize;
-    typedef RectC value_type;
+        const int size  = gp.ColormapData.GetTableSize(cmap);
+        const bool qual = gp.ColormapData.IsQual(cmap);
+        Table   = gp.ColormapData.GetTable(cmap);
+        Min     = scale_min;
+        Range   = scale_max - scale_min;
+        Mul     = (float)(qual ? size : size - 1);
+        Add     = qual ? 0.0f : 0.5f;
+        MaxIdx  = (float)(size - 1);
+        SkipMin = skip_min;
+    }
+    IMPLOT_INLINE ImU32 operator()(double val) const {
+        float t = (float)((val - Min) / Range);
+        t = t < 1.0f ? t : 1.0f;
+        t = t > 0.0f ? t : 0.0f;
+        const float i = t * Mul + Add;
+        const ImU32 col = Table[(int)(i < MaxIdx ? i : MaxIdx)];
+        return SkipMin && !(val > Min) ? 0 : col;
+    }
+    const ImU32* Table;
+    double Min, Range;
+    float Mul, Add, MaxIdx;
+    bool SkipMin;
 };
 
 template <typename _Indexer>
-struct GetterHeatmapColMaj {
-    GetterHeatmapColMaj(_Indexer indexer, int rows, int cols, double scale_min, double scale_max, double width, double height, double xref, double yref, double ydir) :
-        Indexer(indexer),
-        Count(rows*cols),
+static void HeatmapColors(const HeatmapColorizer& colorizer, const _Indexer& indexer, int count, ImU32* out) {
+    for (int i = 0; i < count; ++i)
+        out[i] = colorizer(indexer[i]);
+}
+
+#if defined(IMGUI_EXT_SSE2) || defined(IMGUI_EXT_NEON)
+// Colors four values given as two pairs of doubles, with the scalar path's arithmetic
+#ifdef IMGUI_EXT_SSE2
+static IMPLOT_INLINE void HeatmapColors4(const HeatmapColorizer& colorizer, __m128d lo, __m128d hi, ImU32* out) {
+    const __m128d min   = _mm_set1_pd(colorizer.Min);
+    const __m128d range = _mm_set1_pd(colorizer.Range);
+    __m128 t = _mm_movelh_ps(_mm_cvtpd_ps(_mm_div_pd(_mm_sub_pd(lo, min), range)),
+                             _mm_cvtpd_ps(_mm_div_pd(_mm_sub_pd(hi, min), range)));
+    // min/max return their second operand on NaN, so NaN clamps to 1 like the scalar path
+    t = _mm_max_ps(_mm_min_ps(t, _mm_set1_ps(1.0f)), _mm_setzero_ps());
+    const __m128 i = _mm_min_ps(_mm_add_ps(_mm_mul_ps(t, _mm_set1_ps(colorizer.Mul)), _mm_set1_ps(colorizer.Add)), _mm_set1_ps(colorizer.MaxIdx));
+    int idx[4];
+    _mm_storeu_si128((__m128i*)idx, _mm_cvttps_epi32(i));
+    const int keep = colorizer.SkipMin ? _mm_movemask_pd(_mm_cmpgt_pd(lo, min)) | (_mm_movemask_pd(_mm_cmpgt_pd(hi, min)) << 2) : 0xF;
+    for (int k = 0; k < 4; ++k)
+        out[k] = (keep >> k) & 1 ? colorizer.Table[idx[k]] : 0;
+}
+#else
+static IMPLOT_INLINE void HeatmapColors4(const HeatmapColorizer& colorizer, float64x2_t lo, float64x2_t hi, ImU32* out) {
+    const float64x2_t min   = vdupq_n_f64(colorizer.Min);
+    const float64x2_t range = vdupq_n_f64(colorizer.Range);
+    float32x4_t t = vcombine_f32(vcvt_f32_f64(vdivq_f64(vsubq_f64(lo, min), range)),
+                                 vcvt_f32_f64(vdivq_f64(vsubq_f64(hi, min), range)));
+    // minnm/maxnm return the number on NaN, so NaN clamps to 1 like the scalar path
+    t = vmaxnmq_f32(vminnmq_f32(t, vdupq_n_f32(1.0f)), vdupq_n_f32(0.0f));
+    const float32x4_t i = vminq_f32(vaddq_f32(vmulq_f32(t, vdupq_n_f32(colorizer.Mul)), vdupq_n_f32(colorizer.Add)), vdupq_n_f32(colorizer.MaxIdx));
+    int32_t idx[4];
+    vst1q_s32(idx, vcvtq_s32_f32(i));
+    int keep = 0xF;
+    if (colorizer.SkipMin) {
+        const uint64x2_t keep_lo = vcgtq_f64(lo, min);
+        const uint64x2_t keep_hi = vcgtq_f64(hi, min);
+        keep = (int)(vgetq_lane_u64(keep_lo, 0) & 1) | (int)(vgetq_lane_u64(keep_lo, 1) & 2) |
+               (int)(vgetq_lane_u64(keep_hi, 0) & 4) | (int)(vgetq_lane_u64(keep_hi, 1) & 8);
+    }
+    for (int k = 0; k < 4; ++k)
+        out[k] = (keep >> k) & 1 ? colorizer.Table[idx[k]] : 0;
+}
+#endif
+
+static void HeatmapColorsContiguous(const HeatmapColorizer& colorizer, const double* values, int count, ImU32* out) {
+    int i = 0;
+#ifdef IMGUI_EXT_SSE2
+    for (; i + 4 <= count; i += 4)
+        HeatmapColors4(colorizer, _mm_loadu_pd(values + i), _mm_loadu_pd(values + i + 2), out + i);
+#else
+    for (; i + 4 <= count; i += 4)
+        HeatmapColors4(colorizer, vld1q_f64(values + i), vld1q_f64(values + i + 2), out + i);
+#endif
+    for (; i < count; ++i)
+        out[i] = colorizer(values[i]);
+}
+
+static void HeatmapColorsContiguous(const HeatmapColorizer& colorizer, const float* values, int count, ImU32* out) {
+    int i = 0;
+#ifdef IMGUI_EXT_SSE2
+    for (; i + 4 <= count; i += 4) {
+        const __m128 v = _mm_loadu_ps(values + i);
+        HeatmapColors4(colorizer, _mm_cvtps_pd(v), _mm_cvtps_pd(_mm_movehl_ps(v, v)), out + i);
+    }
+#else
+    for (; i + 4 <= count; i += 4) {
+        const float32x4_t v = vld1q_f32(values + i);
+        HeatmapColors4(colorizer, vcvt_f64_f32(vget_low_f32(v)), vcvt_high_f64_f32(v), out + i);
+    }
+#endif
+    for (; i < count; ++i)
+        out[i] = colorizer((double)values[i]);
+}
+
+// Contiguous float and double data take the vector path, everything else goes through the indexer
+static void HeatmapColors(const HeatmapColorizer& colorizer, const IndexerIdx<float>& indexer, int count, ImU32* out) {
+    if (indexer.Offset == 0 && indexer.Stride == sizeof(float))
+        HeatmapColorsContiguous(colorizer, indexer.Data, count, out);
+    else
+        HeatmapColors<IndexerIdx<float>>(colorizer, indexer, count, out);
+}
+
+static void HeatmapColors(const HeatmapColorizer& colorizer, const IndexerIdx<double>& indexer, int count, ImU32* out) {
+    if (indexer.Offset == 0 && indexer.Stride == sizeof(double))
+        HeatmapColorsContiguous(colorizer, indexer.Data, count, out);
+    else
+        HeatmapColors<IndexerIdx<double>>(colorizer, indexer, count, out);
+}
+#endif
+
+// Index range [first, last) of the n cells of signed size `size` starting at `ref` that overlap [lo, hi]
+static void HeatmapVisibleCells(double lo, double hi, double ref, double size, int n, int* first, int* last) {
+    double a = (lo - ref) / size;
+    double b = (hi - ref) / size;
+    if (a > b)
+        ImSwap(a, b);
+    *first = (int)ImClamp(floor(a), 0.0, (double)n);
+    *last  = (int)ImClamp(floor(b) + 1, 0.0, (double)n);
+    if (*last < *first)
+        *last = *first;
+}
+
+// Heatmap cells with precomputed colors, limited to the visible rows and columns
+struct GetterHeatmapCells {
+    GetterHeatmapCells(const ImU32* colors, int rows, int cols, bool col_maj, int row0, int row1, int col0, int col1, double width, double height, double xref, double yref, double ydir) :
+        Colors(colors),
+        Count((row1 - row0) * (col1 - col0)),
         Rows(rows),
         Cols(cols),
-        ScaleMin(scale_min),
-        ScaleMax(scale_max),
+        Row0(row0),
+        Col0(col0),
+        VisibleCols(col1 - col0),
+        ColMaj(col_maj),
         Width(width),
         Height(height),
         XRef(xref),
@@ -2839,28 +3169,169 @@ struct GetterHeatmapColMaj {
         HalfSize(Width*0.5, Height*0.5)
     { }
     template <typename I> IMPLOT_INLINE RectC operator[](I idx) const {
-        double val = (double)Indexer[idx];
-        const int r = idx % Rows;
-        const int c = idx / Rows;
-        const ImPlotPoint p(XRef + HalfSize.x + c*Width, YRef + YDir * (HalfSize.y + r*Height));
+        const int r = Row0 + (int)idx / VisibleCols;
+        const int c = Col0 + (int)idx % VisibleCols;
         RectC rect;
-        rect.Pos = p;
+        rect.Pos = ImPlotPoint(XRef + HalfSize.x + c*Width, YRef + YDir * (HalfSize.y + r*Height));
         rect.HalfSize = HalfSize;
-        const float t = ImClamp((float)ImRemap01(val, ScaleMin, ScaleMax),0.0f,1.0f);
-        ImPlotContext& gp = *GImPlot;
-        rect.Color = gp.ColormapData.LerpTable(gp.Style.Colormap, t);
+        rect.Color = Colors[ColMaj ? c * Rows + r : r * Cols + c];
         return rect;
     }
-    // const T* const Values;
-    const _Indexer Indexer;
-    const int Count, Rows, Cols;
-    const double ScaleMin, ScaleMax, Width, Height, XRef, YRef, YDir;
+    const ImU32* const Colors;
+    const int Count, Rows, Cols, Row0, Col0, VisibleCols;
+    const bool ColMaj;
+    const double Width, Height, XRef, YRef, YDir;
     const ImPlotPoint HalfSize;
     typedef RectC value_type;
 };
 
+static const int HeatmapTextureMaxCells  = 2048; // per side, larger heatmaps are drawn as cells
+static const int HeatmapTextureMaxTexels = 1024; // cells are repeated up to this size so linear filtering only blurs their edges
+static const int HeatmapTextureMaxScale  = 8;
+static const int HeatmapCacheMaxUnused   = 60;   // frames before an unused cache releases its texture
+
+static void SweepHeatmapCaches(ImPlotContext* ctx, int frame) {
+    for (int i = 0; i < ctx->HeatmapCaches.GetBufSize(); ++i) {
+        ImPlotHeatmapCache& cache = *ctx->HeatmapCaches.GetByIndex(i);
+        if (cache.Texture && frame - cache.LastFrame > HeatmapCacheMaxUnused) {
+            ImRetireUserTexture(cache.Texture);
+            cache.Texture = nullptr;
+            cache.Colors.clear();
+        }
+    }
+}
+
+// Sweeps the caches of an ImPlot context at the start of every frame, whether or not its heatmaps are drawn
+static void HeatmapCacheHook(ImGuiContext* imgui_ctx, ImGuiContextHook* hook) {
+    ImPlotContext* ctx = (ImPlotContext*)hook->UserData;
+    if (hook->Type == ImGuiContextHookType_NewFramePre) {
+        SweepHeatmapCaches(ctx, imgui_ctx->FrameCount);
+        return;
+    }
+    // The backend has already been shut down, nothing is left to wait for
+    for (int i = 0; i < ctx->HeatmapCaches.GetBufSize(); ++i) {
+        ImPlotHeatmapCache& cache = *ctx->HeatmapCaches.GetByIndex(i);
+        if (cache.Texture) {
+            ImGui::UnregisterUserTexture(cache.Texture);
+            IM_DELETE(cache.Texture);
+        }
+        cache.Texture = nullptr;
+        cache.Colors.clear();
+    }
+    ImGui::RemoveContextHook(imgui_ctx, ctx->HeatmapHooks[0]);
+    ImGui::RemoveContextHook(imgui_ctx, ctx->HeatmapHooks[1]);
+    ctx->HeatmapHookContext = nullptr;
+}
+
+static void AddHeatmapCacheHooks(ImPlotContext* ctx) {
+    ImGuiContext* imgui_ctx = ImGui::GetCurrentContext();
+    IM_ASSERT_USER_ERROR(ctx->HeatmapHookContext == nullptr || ctx->HeatmapHookContext == imgui_ctx, "Textured heatmaps of an ImPlot context must all be drawn with the same ImGui context!");
+    if (ctx->HeatmapHookContext != nullptr)
+        return;
+    // Created first so its hooks run before ours and never get added while ours run
+    ImGetRetiredTextures();
+    ImGuiContextHook hook;
+    hook.Callback = HeatmapCacheHook;
+    hook.UserData = ctx;
+    hook.Type = ImGuiContextHookType_NewFramePre;
+    ctx->HeatmapHooks[0] = ImGui::AddContextHook(imgui_ctx, &hook);
+    hook.Type = ImGuiContextHookType_Shutdown;
+    ctx->HeatmapHooks[1] = ImGui::AddContextHook(imgui_ctx, &hook);
+    ctx->HeatmapHookContext = imgui_ctx;
+}
+
+void DestroyHeatmapCaches(ImPlotContext* ctx) {
+    if (ctx == nullptr)
+        return;
+    // Without hooks the ImGui context is gone or no texture was made, and its shutdown freed them
+    ImGuiContext* imgui_ctx = ctx->HeatmapHookContext;
+    if (imgui_ctx != nullptr) {
+        ImGuiContext* prev_ctx = ImGui::GetCurrentContext();
+        ImGui::SetCurrentContext(imgui_ctx);
+        ImGui::RemoveContextHook(imgui_ctx, ctx->HeatmapHooks[0]);
+        ImGui::RemoveContextHook(imgui_ctx, ctx->HeatmapHooks[1]);
+        for (int i = 0; i < ctx->HeatmapCaches.GetBufSize(); ++i) {
+            ImPlotHeatmapCache& cache = *ctx->HeatmapCaches.GetByIndex(i);
+            if (cache.Texture)
+                ImRetireUserTexture(cache.Texture);
+            cache.Texture = nullptr;
+        }
+        ImGui::SetCurrentContext(prev_ctx);
+        ctx->HeatmapHookContext = nullptr;
+    }
+    ctx->HeatmapCaches.Clear();
+}
+
+// Draws the cells as a single textured quad, re-uploading the texture only when their colors
+// changed since the last frame. Returns false when the axes are not linear or the heatmap is too large.
+static bool RenderHeatmapTexture(ImDrawList& draw_list, ImGuiID id, const ImU32* colors, int rows, int cols, bool col_maj, const ImPlotPoint& bounds_min, const ImPlotPoint& bounds_max, double yref, double ydir) {
+    ImPlotContext& gp = *GImPlot;
+    ImPlotPlot& plot = *gp.CurrentPlot;
+    if (plot.Axes[plot.CurrentX].TransformForward != nullptr || plot.Axes[plot.CurrentY].TransformForward != nullptr)
+        return false;
+    if (rows > HeatmapTextureMaxCells || cols > HeatmapTextureMaxCells)
+        return false;
+
+    AddHeatmapCacheHooks(&gp);
+    ImPlotHeatmapCache& cache = *gp.HeatmapCaches.GetOrAddByKey(id);
+    cache.LastFrame = ImGui::GetFrameCount();
+    const int count  = rows * cols;
+    const int scale  = ImClamp(HeatmapTextureMaxTexels / ImMax(rows, cols), 1, HeatmapTextureMaxScale);
+    // one texel of border repeating the edge cells keeps the repeat sampler from wrapping
+    const int width  = cols * scale + 2;
+    const int height = rows * scale + 2;
+    bool upload = false;
+    if (!cache.Texture || cache.Texture->Width != width || cache.Texture->Height != height) {
+        if (cache.Texture)
+            ImRetireUserTexture(cache.Texture);
+        cache.Texture = IM_NEW(ImTextureData)();
+        cache.Texture->Create(ImTextureFormat_RGBA32, width, height);
+        ImGui::RegisterUserTexture(cache.Texture);
+        upload = true;
+    }
+    if (upload || cache.Rows != rows || cache.Cols != cols || cache.ColMajor != col_maj || memcmp(cache.Colors.Data, colors, sizeof(ImU32) * count) != 0) {
+        cache.Rows     = rows;
+        cache.Cols     = cols;
+        cache.Scale    = scale;
+        cache.ColMajor = col_maj;
+        cache.Colors.resize(count);
+        memcpy(cache.Colors.Data, colors, sizeof(ImU32) * count);
+        ImU32* pixels = (ImU32*)cache.Texture->Pixels;
+        for (int y = 0; y < height; ++y) {
+            ImU32* texels = pixels + (size_t)y * width;
+            const int r = ImClamp((y - 1) / scale, 0, rows - 1);
+            if (y > 1 && y < height - 1 && (y - 1) % scale != 0) {
+                memcpy(texels, texels - width, sizeof(ImU32) * width);
+                continue;
+            }
+            for (int x = 0; x < width; ++x) {
+                const int c = ImClamp((x - 1) / scale, 0, cols - 1);
+                texels[x] = colors[col_maj ? c * rows + r : r * cols + c];
+            }
+        }
+        // Full upload, unless the backend has yet to create it or an update is already queued
+        if (cache.Texture->Status == ImTextureStatus_OK) {
+            ImTextureRect rect = { 0, 0, (unsigned short)width, (unsigned short)height };
+            cache.Texture->Updates.resize(0);
+            cache.Texture->Updates.push_back(rect);
+            cache.Texture->UpdateRect = rect;
+            cache.Texture->SetStatus(ImTextureStatus_WantUpdates);
+        }
+    }
+
+    Transformer2 transformer;
+    const ImVec2 uv0(1.0f / width, 1.0f / height);
+    const ImVec2 uv1(1.0f - 1.0f / width, 1.0f - 1.0f / height);
+    // corners of cell (0,0) and (rows-1,cols-1)
+    const ImVec2 p0 = transformer(bounds_min.x, yref);
+    const ImVec2 p1 = transformer(bounds_max.x, yref + ydir * (bounds_max.y - bounds_min.y));
+    draw_list.AddImage(cache.Texture->GetTexRef(), p0, p1, uv0, uv1);
+    return true;
+}
+
+// Colors every cell once, then emits quads for the visible cells only, or a single cached texture when texture_id is set
 template <typename T>
-void RenderHeatmap(ImDrawList& draw_list, IndexerIdx<T> indexer, int rows, int cols, double scale_min, double scale_max, const char* fmt, const ImPlotPoint& bounds_min, const ImPlotPoint& bounds_max, bool reverse_y, bool col_maj) {
+void RenderHeatmap(ImDrawList& draw_list, IndexerIdx<T> indexer, int rows, int cols, double scale_min, double scale_max, const char* fmt, const ImPlotPoint& bounds_min, const ImPlotPoint& bounds_max, bool reverse_y, bool col_maj, bool skip_min, ImGuiID texture_id) {
     ImPlotContext& gp = *GImPlot;
     Transformer2 transformer;
     if (scale_min == 0 && scale_max == 0) {
@@ -2875,12 +3346,19 @@ void RenderHeatmap(ImDrawList& draw_list, IndexerIdx<T> indexer, int rows, int c
     }
     const double yref = reverse_y ? bounds_max.y : bounds_min.y;
     const double ydir = reverse_y ? -1 : 1;
-    if (col_maj) {
-        GetterHeatmapColMaj<IndexerIdx<T>> getter(indexer, rows, cols, scale_min, scale_max, (bounds_max.x - bounds_min.x) / cols, (bounds_max.y - bounds_min.y) / rows, bounds_min.x, yref, ydir);
-        RenderPrimitives1<RendererRectC>(getter);
-    }
-    else {
-        GetterHeatmapRowMaj<IndexerIdx<T>> getter(indexer, rows, cols, scale_min, scale_max, (bounds_max.x - bounds_min.x) / cols, (bounds_max.y - bounds_min.y) / rows, bounds_min.x, yref, ydir);
+    ImVector<ImU32>& colors = gp.TempU32;
+    colors.resize(rows*cols);
+    HeatmapColors(HeatmapColorizer(gp.Style.Colormap, scale_min, scale_max, skip_min), indexer, rows*cols, colors.Data);
+    if (texture_id == 0 || !RenderHeatmapTexture(draw_list, texture_id, colors.Data, rows, cols, col_maj, bounds_min, bounds_max, yref, ydir)) {
+        const double w = (bounds_max.x - bounds_min.x) / cols;
+        const double h = (bounds_max.y - bounds_min.y) / rows;
+        const ImPlotPlot& plot = *gp.CurrentPlot;
+        const ImPlotRange& x_range = plot.Axes[plot.CurrentX].Range;
+        const ImPlotRange& y_range = plot.Axes[plot.CurrentY].Range;
+        int row0, row1, col0, col1;
+        HeatmapVisibleCells(x_range.Min, x_range.Max, bounds_min.x, w, cols, &col0, &col1);
+        HeatmapVisibleCells(y_range.Min, y_range.Max, yref, ydir * h, rows, &row0, &row1);
+        GetterHeatmapCells getter(colors.Data, rows, cols, col_maj, row0, row1, col0, col1, w, h, bounds_min.x, yref, ydir);
         RenderPrimitives1<RendererRectC>(getter);
     }
     // labels
@@ -2936,9 +3414,11 @@ void PlotHeatmap(const char* label_id, const T* values, int rows, int cols, doub
             return;
         }
         ImDrawList& draw_list = *GetPlotDrawList();
-        const bool col_maj = ImHasFlag(spec.Flags, ImPlotHeatmapFlags_ColMajor);
+        const bool col_maj  = ImHasFlag(spec.Flags, ImPlotHeatmapFlags_ColMajor);
+        const bool skip_min = ImHasFlag(spec.Flags, ImPlotHeatmapFlags_SkipMin);
+        const ImGuiID texture_id = ImHasFlag(spec.Flags, ImPlotHeatmapFlags_Texture) ? GImPlot->CurrentItem->ID : 0;
         IndexerIdx<T> indexer(values,rows*cols,spec.Offset,Stride<T>(spec));
-        RenderHeatmap(draw_list, indexer, rows, cols, scale_min, scale_max, fmt, bounds_min, bounds_max, true, col_maj);
+        RenderHeatmap(draw_list, indexer, rows, cols, scale_min, scale_max, fmt, bounds_min, bounds_max, true, col_maj, skip_min, texture_id);
         EndItem();
     }
 }
@@ -3106,8 +3586,10 @@ double PlotHistogram2D(const char* label_id, const T* xs, const T* ys, int count
             return max_count;
         }
         ImDrawList& draw_list = *GetPlotDrawList();
+        const bool skip_empty = ImHasFlag(spec.Flags, ImPlotHistogramFlags_SkipEmpty);
+        const ImGuiID texture_id = ImHasFlag(spec.Flags, ImPlotHistogramFlags_Texture) ? GImPlot->CurrentItem->ID : 0;
         IndexerIdx<double> indexer_bin(bin_counts.begin(), y_bins*x_bins, 0, sizeof(double));
-        RenderHeatmap(draw_list, indexer_bin, y_bins, x_bins, 0, max_count, nullptr, range.Min(), range.Max(), false, col_maj);
+        RenderHeatmap(draw_list, indexer_bin, y_bins, x_bins, 0, max_count, nullptr, range.Min(), range.Max(), false, col_maj, skip_empty, texture_id);
         EndItem();
     }
     return max_count;
@@ -33,6 +33,8 @@ CIMGUI_API bool igExtSpinner(const char* label, float radius, int thickness, int
 CIMGUI_API bool igExtComboButton(const char* id, const char* preview_value);
 CIMGUI_API void igExtRenderArrow(float frameX, float frameY);
 CIMGUI_API int igExtPlot(int plotType, const char* label, float (*values_getter)(void* data, int idx), int (*get_tooltip)(void* data, int idx, char* buffer), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, float size_x, float size_y);
+// igExtPlot reading a strided float array directly. stride is in bytes (0 = packed), xs is optional, ascending and shares the stride.
+CIMGUI_API int igExtPlotArray(int plotType, const char* label, const float* values, const float* xs, int values_count, int values_offset, int stride, int (*get_tooltip)(void* data, int idx, char* buffer), void* data, const char* overlay_text, float scale_min, float scale_max, float size_x, float size_y);
 CIMGUI_API bool igButtonEx2(const char* label, float sizeX, float sizeY, int drawFlags);
 CIMGUI_API void igExtUseTitlebar(float *restoreX, float *restoreY);
 //draw list
@@ -41,10 +43,30 @@ CIMGUI_API void igExtDrawListAddTriangleMesh(void* drawlist, float* vertices, in
 CIMGUI_API bool igBuildFontAtlas(void* atlas);
 //memory editor
 typedef void* memoryedit_t;
+typedef void* memoryedit_source_t;
 
 CIMGUI_API memoryedit_t igExtMemoryEditInit();
 CIMGUI_API void igExtMemoryEditDrawContents(memoryedit_t memedit, void *mem_data_void_ptr, size_t mem_size, size_t base_display_addr);
+// highlights bytes differing from diff_data_ptr, which is only read during the call
+CIMGUI_API void igExtMemoryEditDrawContentsDiff(memoryedit_t memedit, void *mem_data_void_ptr, size_t mem_size, const void *diff_data_ptr, size_t diff_size, size_t base_display_addr);
+// draws a paged source, memory is only read for the visible rows and search. writes go to the source's patch list
+CIMGUI_API void igExtMemoryEditDrawSource(memoryedit_t memedit, memoryedit_source_t source, size_t base_display_addr, bool read_only);
 CIMGUI_API void igExtMemoryEditFree(memoryedit_t memedit);
+// struct templates overlaid on the hex view. data_type is an ImGuiDataType scalar, flags: 1 = string, 2 = hex
+CIMGUI_API int igExtMemoryEditAddStruct(memoryedit_t memedit, const char* name, size_t size);
+CIMGUI_API void igExtMemoryEditAddStructField(memoryedit_t memedit, int struct_id, const char* name, int data_type, size_t offset, int count, int flags);
+CIMGUI_API void igExtMemoryEditAddStructOverlay(memoryedit_t memedit, int struct_id, size_t addr, size_t count);
+CIMGUI_API void igExtMemoryEditClearStructOverlays(memoryedit_t memedit);
+CIMGUI_API void igExtMemoryEditClearStructs(memoryedit_t memedit);
+// paged source: read_callback fills buffer with up to size bytes at offset and returns the count read
+// returns NULL when page_size * page_count is over INT_MAX bytes
+typedef size_t (*memoryedit_read_t)(void* user_data, size_t offset, void* buffer, size_t size);
+CIMGUI_API memoryedit_source_t igExtMemoryEditSourceCreate(memoryedit_read_t read_callback, void* user_data, size_t size, size_t page_size, int page_count);
+CIMGUI_API void igExtMemoryEditSourceInvalidate(memoryedit_source_t source);
+CIMGUI_API int igExtMemoryEditSourceGetPatchCount(memoryedit_source_t source);
+CIMGUI_API int igExtMemoryEditSourceGetPatches(memoryedit_source_t source, size_t* addrs, uint8_t* values, int count);
+CIMGUI_API void igExtMemoryEditSourceClearPatches(memoryedit_source_t source);
+CIMGUI_API void igExtMemoryEditSourceFree(memoryedit_source_t source);
 
 //
 CIMGUI_API int igExtInputFloat(const char* label, float* v, float step, float step_fast, const char* format, int flags);
@@ -57,6 +79,18 @@ CIMGUI_API int igExtInputInt3(const char* label, int v[3], int flags);
 CIMGUI_API int igExtInputInt4(const char* label, int v[4], int flags);
 CIMGUI_API int igExtInputDouble(const char* label, double* v, double step, double step_fast, const char* format, int flags);
 CIMGUI_API int igExtInputIntPreview(const char *label, const char *preview, int* v);
+//expression input: registered names are shared by every igExtInput* widget
+//calls with more than 16 arguments fail to compile
+typedef double (*expression_function)(const double* args, int count, void* userdata);
+CIMGUI_API int igExtExpressionSetVariable(const char* name, double value);
+CIMGUI_API int igExtExpressionRegisterFunction(const char* name, expression_function callback, void* userdata);
+CIMGUI_API void igExtExpressionFlushCache();
+CIMGUI_API int igExtExpressionEvaluate(const char* text, double* result);
+//batch expressions: columns name the variables read from each row of bindings (row i starts at bindings + i * stride)
+typedef void* expression_program_t;
+CIMGUI_API expression_program_t igExtExpressionProgramCreate(const char* text, const char* const* columns, int columnCount);
+CIMGUI_API int igExtExpressionProgramEvaluate(expression_program_t program, const double* bindings, int stride, int count, double* results, unsigned char* errors);
+CIMGUI_API void igExtExpressionProgramFree(expression_program_t program);
 
 //layout hack
 CIMGUI_API void igTableFullRowBegin();
@@ -74,9 +108,15 @@ CIMGUI_API void igExtTextEditorSetMode(texteditor_t textedit, texteditor_mode_t
 CIMGUI_API void igExtTextEditorSetReadOnly(texteditor_t textedit, int readonly);
 CIMGUI_API void igExtFree(void *mem);
 CIMGUI_API void igExtTextEditorSetText(texteditor_t textedit, const char *text);
+CIMGUI_API int igExtTextEditorGetInvalidUtf8(texteditor_t textedit, size_t *firstOffset); // invalid sequences since last SetText
 CIMGUI_API int igExtTextEditorGetUndoIndex(texteditor_t textedit);
 CIMGUI_API void igExtTextEditorGetCoordinates(texteditor_t textedit, int32_t *x, int32_t *y);
 CIMGUI_API void igExtTextEditorRender(texteditor_t textedit, const char *id);
+CIMGUI_API void igExtTextEditorSetAutoComplete(texteditor_t textedit, int enabled);
+CIMGUI_API void igExtTextEditorAddAutoCompleteWords(texteditor_t textedit, const char *words, size_t size); // newline separated UTF-8
+CIMGUI_API void igExtTextEditorClearAutoCompleteWords(texteditor_t textedit);
+CIMGUI_API void igExtTextEditorSetAppendOnly(texteditor_t textedit, int enabled, int maxLines); // maxLines 0 = unlimited
+CIMGUI_API void igExtTextEditorAppendText(texteditor_t textedit, const char *text, size_t size);
 CIMGUI_API void igExtTextEditorFree(texteditor_t textedit);
 //guizmo
 CIMGUI_API void igGuizmoBeginFrame();
@@ -86,6 +126,7 @@ CIMGUI_API int igGuizmoIsOver();
 CIMGUI_API void igGuizmoSetID(int id);
 CIMGUI_API void igGuizmoSetRect(float x, float y, float width, float height);
 CIMGUI_API int igGuizmoManipulate(float* view, float* projection, int operation, int mode, float* matrix, float* delta);
+CIMGUI_API int igGuizmoManipulateBatch(float* view, float* projection, int operation, int mode, int pivot, float* matrices, int count, int active, float* delta);
 CIMGUI_API void igGuizmoSetDrawlist();
 CIMGUI_API void igGuizmoSetImGuiContext(void* ctx);
 //node editor
@@ -179,6 +220,7 @@ typedef enum
     axStyleVar_SnapLinkToPinDir,
     axStyleVar_HoveredNodeBorderOffset,
     axStyleVar_SelectedNodeBorderOffset,
+    axStyleVar_LodZoomThreshold,
 
     axStyleVar_Count
 } axStyleVar;
@@ -223,6 +265,7 @@ typedef struct {
     float   GroupBorderWidth;
     float   HighlightConnectedLinks;
     float   SnapLinkToPinDir; // when true link will start on the line defined by pin direction
+    float   LodZoomThreshold; // below this view scale nodes are drawn as titled rectangles and links as coarse curves, 0 disables
     axVec4  Colors[axStyleColor_Count];
 } axStyle;
 
@@ -244,6 +287,8 @@ typedef int (*axConfigSaveSettings)(const char* data, size_t size, axSaveReasonF
 typedef size_t (*axConfigLoadSettings)(char* data, void* userPointer);
 typedef int (*axConfigSaveNodeSettings)(axNodeId nodeId, const char* data, size_t size, axSaveReasonFlags reason, void* userPointer);
 typedef size_t (*axConfigLoadNodeSettings)(axNodeId nodeId, char* data, void* userPointer);
+typedef int (*axConfigSaveSettingsBinary)(const char* data, size_t size, axSaveReasonFlags reason, void* userPointer);
+typedef size_t (*axConfigLoadSettingsBinary)(char* data, void* userPointer);
 typedef void (*axConfigSession)(void* userPointer);
 typedef void (*axNodeDraggedCallback)(axNodeId nodeId, float oldX, float oldY, float newX, float newY, void* userPointer);
 typedef void (*axNodeResizedCallback)(axNodeId nodeId, axResizeCallbackData *data, void* userPointer);
@@ -272,6 +317,12 @@ CIMGUI_API void axConfig_set_SaveNodeSettings(axConfig *config, axConfigSaveNode
 CIMGUI_API axConfigLoadNodeSettings axConfig_get_LoadNodeSettings(axConfig *config);
 CIMGUI_API void axConfig_set_LoadNodeSettings(axConfig *config, axConfigLoadNodeSettings loadNodeSettings);
 
+CIMGUI_API axConfigSaveSettingsBinary axConfig_get_SaveSettingsBinary(axConfig *config);
+CIMGUI_API void axConfig_set_SaveSettingsBinary(axConfig *config, axConfigSaveSettingsBinary saveSettingsBinary);
+
+CIMGUI_API axConfigLoadSettingsBinary axConfig_get_LoadSettingsBinary(axConfig *config);
+CIMGUI_API void axConfig_set_LoadSettingsBinary(axConfig *config, axConfigLoadSettingsBinary loadSettingsBinary);
+
 CIMGUI_API axNodeDraggedCallback axConfig_get_NodeDraggedHook(axConfig *config);
 CIMGUI_API void axConfig_set_NodeDraggedHook(axConfig *config, axNodeDraggedCallback nodeDraggedHook);
 
@@ -338,6 +389,11 @@ CIMGUI_API void axEndPin();
 CIMGUI_API void axGroup(axVec2* size);
 CIMGUI_API void axEndNode();
 
+CIMGUI_API int axIsNodeCulled(axNodeId nodeId);
+CIMGUI_API int axIsLodActive();
+CIMGUI_API void axSetNodeTitle(const char* title);
+CIMGUI_API void axSkipNodeContents();
+
 CIMGUI_API int axBeginGroupHint(axNodeId nodeId);
 CIMGUI_API void axGetGroupMin(axVec2 *gmin);
 CIMGUI_API void axGetGroupMax(axVec2 *gmax);
@@ -376,6 +432,40 @@ CIMGUI_API void axGetNodeSize(axNodeId nodeId, axVec2* sz);
 CIMGUI_API void axCenterNodeOnScreen(axNodeId nodeId);
 CIMGUI_API void axSetNodeZPosition(axNodeId nodeId, float z); // Sets node z position, nodes with higher value are drawn over nodes with lower value
 CIMGUI_API float axGetNodeZPosition(axNodeId nodeId); // Returns node z position, defaults is 0.0f
+CIMGUI_API void axSetNodePositions(const axNodeId* nodeIds, const axVec2* editorPositions, int count);
+CIMGUI_API void axSetGroupSizes(const axNodeId* nodeIds, const axVec2* sizes, int count);
+CIMGUI_API void axGetNodePositions(const axNodeId* nodeIds, axVec2* positions, int count);
+CIMGUI_API void axGetNodeSizes(const axNodeId* nodeIds, axVec2* sizes, int count);
+CIMGUI_API int axGetNodeRects(axNodeId* nodeIds, axVec4* rects, int size, int visibleOnly); // rects are min x, min y, max x, max y in canvas space
+
+typedef enum
+{
+    axLayoutMode_Auto,
+    axLayoutMode_Layered,
+    axLayoutMode_ForceDirected
+} axLayoutMode;
+
+typedef enum {
+    axMinimapLocation_TopLeft,
+    axMinimapLocation_TopRight,
+    axMinimapLocation_BottomLeft,
+    axMinimapLocation_BottomRight
+} axMinimapLocation;
+
+typedef struct {
+    axLayoutMode Mode;
+    axVec2 Spacing;
+    float ComponentSpacing;
+    int SweepIterations;
+    int OrderingTrials;
+    int ForceIterations;
+    float MaxReversedEdgeRatio;
+    int ThreadCount;
+} axLayoutOptions;
+
+CIMGUI_API void axLayoutOptions_Init(axLayoutOptions* options);
+CIMGUI_API void axAutoLayout(const axLayoutOptions* options);
+CIMGUI_API void axAutoLayoutNodes(const axNodeId* nodeIds, int count, const axLayoutOptions* options);
 
 CIMGUI_API void axRestoreNodeState(axNodeId nodeId);
 
@@ -407,6 +497,7 @@ CIMGUI_API int axPinBreakLinks(axPinId pinId); // Break all links connected to t
 
 CIMGUI_API void axNavigateToContent(float duration);
 CIMGUI_API void axNavigateToSelection(int zoomIn, float duration);
+CIMGUI_API void axShowMinimap(float sizeFraction, axMinimapLocation location);
 
 CIMGUI_API int axShowNodeContextMenu(axNodeId* nodeId);
 CIMGUI_API int axShowPinContextMenu(axPinId* pinId);
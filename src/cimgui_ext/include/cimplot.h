@@ -249,6 +249,9 @@ enum ImPlotLineFlags_
     ImPlotLineFlags_SkipNaN = 1 << 12,
     ImPlotLineFlags_NoClip = 1 << 13,
     ImPlotLineFlags_Shaded = 1 << 14,
+    ImPlotLineFlags_Decimate = 1 << 15,
+    ImPlotLineFlags_DecimateLTTB = 1 << 16,
+    ImPlotLineFlags_SortedX = 1 << 17,
 };
 enum ImPlotLocation_
 {
@@ -6,6 +6,41 @@ extern "C" {
 #endif
 CIMGUI_API void ImPlotSpec_Construct(ImPlotSpec *spec);
 
+// Fixed capacity ring buffer of (x, y) samples for streaming plots.
+// Once full, each push overwrites the oldest sample. The series is plotted
+// straight from its storage, and the Y min/max of the current window is
+// maintained incrementally, so a frame costs O(new samples).
+typedef struct ImPlotRingSeries ImPlotRingSeries;
+CIMGUI_API ImPlotRingSeries* ImPlotRingSeries_Create(int capacity);
+CIMGUI_API void ImPlotRingSeries_Destroy(ImPlotRingSeries* series);
+CIMGUI_API void ImPlotRingSeries_Clear(ImPlotRingSeries* series);
+CIMGUI_API void ImPlotRingSeries_Push(ImPlotRingSeries* series, double x, double y);
+CIMGUI_API void ImPlotRingSeries_PushBatch(ImPlotRingSeries* series, const double* xs, const double* ys, int count);
+CIMGUI_API int ImPlotRingSeries_GetCount(const ImPlotRingSeries* series);
+CIMGUI_API int ImPlotRingSeries_GetCapacity(const ImPlotRingSeries* series);
+// X range spans the oldest to newest sample, Y range is the window min/max (NaN ignored).
+// Returns false if the series holds no finite Y value.
+CIMGUI_API bool ImPlotRingSeries_GetBounds(const ImPlotRingSeries* series, ImPlotRect* bounds);
+CIMGUI_API void ImPlotRingSeries_PlotLine(const ImPlotRingSeries* series, const char* label_id, const ImPlotSpec spec);
+CIMGUI_API void ImPlotRingSeries_PlotShaded(const ImPlotRingSeries* series, const char* label_id, double yref, const ImPlotSpec spec);
+
+// Append-only (x, y) series with a min/max/mean pyramid for long histories.
+// X must be non-decreasing. Each level is a quarter the size of the one below.
+// Buckets are summarized once as they fill, and plotting only walks the visible
+// range at the first level with no more than two buckets per pixel.
+typedef struct ImPlotPyramidSeries ImPlotPyramidSeries;
+CIMGUI_API ImPlotPyramidSeries* ImPlotPyramidSeries_Create(void);
+CIMGUI_API void ImPlotPyramidSeries_Destroy(ImPlotPyramidSeries* series);
+CIMGUI_API void ImPlotPyramidSeries_Clear(ImPlotPyramidSeries* series);
+CIMGUI_API void ImPlotPyramidSeries_Reserve(ImPlotPyramidSeries* series, int capacity);
+CIMGUI_API void ImPlotPyramidSeries_Push(ImPlotPyramidSeries* series, double x, double y);
+CIMGUI_API void ImPlotPyramidSeries_PushBatch(ImPlotPyramidSeries* series, const double* xs, const double* ys, int count);
+CIMGUI_API int ImPlotPyramidSeries_GetCount(const ImPlotPyramidSeries* series);
+CIMGUI_API bool ImPlotPyramidSeries_GetBounds(ImPlotPyramidSeries* series, ImPlotRect* bounds);
+// Raw samples are drawn as a line. Coarser levels draw the min/max envelope with
+// the fill color and the bucket mean with the line color. Offset and Stride are ignored.
+// Returns the pyramid level drawn, 0 being the raw samples.
+CIMGUI_API int ImPlotPyramidSeries_Plot(ImPlotPyramidSeries* series, const char* label_id, const ImPlotSpec spec);
 
 #ifdef __cplusplus
 }
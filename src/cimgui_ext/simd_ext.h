@@ -0,0 +1,17 @@
+// MIT License - Copyright (c) Callum McGing
+// This file is subject to the terms and conditions defined in
+// LICENSE, which is part of this source code package
+
+// Vector instruction sets available to the hand written SIMD paths in this library.
+// SSE2 is part of every x86-64 target and NEON of every AArch64 target, so no runtime
+// dispatch is needed. Code checks IMGUI_EXT_SSE2 / IMGUI_EXT_NEON and keeps a scalar
+// fallback for everything else.
+#pragma once
+
+#if defined(__SSE2__) || defined(__x86_64__) || defined(_M_X64)
+#define IMGUI_EXT_SSE2
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define IMGUI_EXT_NEON
+#include <arm_neon.h>
+#endif
@@ -0,0 +1,94 @@
+// MIT License - Copyright (c) Callum McGing
+// This file is subject to the terms and conditions defined in
+// LICENSE, which is part of this source code package
+
+// User textures handed back to the backend. ImGui only lists a texture for the backend while it
+// is registered, so a retired texture has to stay registered (and allocated) until the backend
+// reports it destroyed. The waiting textures belong to the ImGui context they were registered
+// with: a context hook releases the destroyed ones at the start of every frame and frees the rest
+// when the context shuts down, so the plot or editor that made them can go away in the meantime.
+#pragma once
+
+#include "imgui.h"
+#include "imgui_internal.h"
+
+struct ImRetiredTextures
+{
+    ImVector<ImTextureData*> Textures;
+};
+
+static inline ImGuiID ImRetiredTexturesOwner() { return ImHashStr("##RetiredUserTextures"); }
+
+static void ImRetiredTexturesHook(ImGuiContext* ctx, ImGuiContextHook* hook)
+{
+    ImRetiredTextures* retired = (ImRetiredTextures*)hook->UserData;
+    const bool shutdown = hook->Type == ImGuiContextHookType_Shutdown;
+    for (int i = 0; i < retired->Textures.Size; )
+    {
+        ImTextureData* texture = retired->Textures[i];
+        // The backend is shut down before the context, nothing will change after this
+        if (!shutdown && texture->Status != ImTextureStatus_Destroyed)
+        {
+            ++i;
+            continue;
+        }
+        ImGui::UnregisterUserTexture(texture);
+        IM_DELETE(texture);
+        retired->Textures.erase(retired->Textures.Data + i);
+    }
+    if (shutdown)
+    {
+        for (ImGuiContextHook& other : ctx->Hooks)
+        {
+            if (other.Owner == hook->Owner)
+                other.Type = ImGuiContextHookType_PendingRemoval_;
+        }
+        IM_DELETE(retired);
+    }
+}
+
+// Retired textures of the current ImGui context, created with its hooks on first use. Hooks that
+// may retire textures should call this when they are added, it must not add hooks while they run.
+static inline ImRetiredTextures* ImGetRetiredTextures()
+{
+    ImGuiContext& g = *GImGui;
+    const ImGuiID owner = ImRetiredTexturesOwner();
+    for (ImGuiContextHook& hook : g.Hooks)
+    {
+        if (hook.Owner == owner && hook.Type == ImGuiContextHookType_NewFramePre)
+            return (ImRetiredTextures*)hook.UserData;
+    }
+    ImRetiredTextures* retired = IM_NEW(ImRetiredTextures)();
+    ImGuiContextHook hook;
+    hook.Owner = owner;
+    hook.Callback = ImRetiredTexturesHook;
+    hook.UserData = retired;
+    hook.Type = ImGuiContextHookType_NewFramePre;
+    ImGui::AddContextHook(&g, &hook);
+    hook.Type = ImGuiContextHookType_Shutdown;
+    ImGui::AddContextHook(&g, &hook);
+    return retired;
+}
+
+// Hands a registered user texture to the backend for destruction and frees it once that happened
+static inline void ImRetireUserTexture(ImTextureData* texture)
+{
+    // Never uploaded, nothing for the backend to release
+    if (texture->Status == ImTextureStatus_WantCreate)
+    {
+        if (ImGui::GetCurrentContext())
+            ImGui::UnregisterUserTexture(texture);
+        IM_DELETE(texture);
+        return;
+    }
+    // Without a context there is no backend left to wait for
+    if (ImGui::GetCurrentContext() == nullptr)
+    {
+        IM_DELETE(texture);
+        return;
+    }
+    texture->WantDestroyNextFrame = true;
+    texture->UnusedFrames = 1;
+    texture->SetStatus(ImTextureStatus_WantDestroy);
+    ImGetRetiredTextures()->Textures.push_back(texture);
+}